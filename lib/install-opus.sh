@@ -4,6 +4,7 @@ rm -rf libopus
 mkdir libopus libopus/include libopus/src libopus/celt libopus/silk libopus/silk/fixed
 cp opus/include/*.h libopus/include/.
 cp opus.config.h libopus/include/config.h
+cp opus_multistream_scratch.h libopus/include/.
 
 celt="arch.h bands.c bands.h celt.c celt_decoder.c celt.h celt_lpc.c celt_lpc.h cpu_support.h cwrs.c cwrs.h ecintrin.h entcode.c entcode.h entdec.c entdec.h entenc.c entenc.h fixed_debug.h fixed_generic.h float_cast.h kiss_fft.c _kiss_fft_guts.h kiss_fft.h laplace.c laplace.h mathops.c mathops.h mdct.c mdct.h mfrngcod.h modes.c modes.h os_support.h pitch.c pitch.h quant_bands.c quant_bands.h rate.c rate.h stack_alloc.h static_modes_fixed.h static_modes_float.h vq.c vq.h"
 cd opus/celt
@@ -54,11 +55,13 @@ done
 sed -i s/HAVE_CONFIG_H/__STDC__/g ../../../libopus/silk/fixed/*.[ch]
 
 cd ../../src
-src="opus.c opus_decoder.c opus_private.h"
+src="opus.c opus_decoder.c opus_multistream.c opus_multistream_decoder.c opus_private.h"
 for i in $src; do
     cp -i $i ../../libopus/src/$i
 done
-incs="config.h opus_custom.h opus_defines.h opus.h opus_multistream.h opus_projection.h opus_types.h"
+# Multistream decode with a caller supplied buffer, see opus_multistream_scratch.c
+cp -i ../../opus_multistream_scratch.c ../../libopus/src/.
+incs="config.h opus_custom.h opus_defines.h opus.h opus_multistream.h opus_multistream_scratch.h opus_projection.h opus_types.h"
 for i in $incs; do
     echo '#include "../include/'$i'"' > ../../libopus/src/$i
 done
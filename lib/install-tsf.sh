@@ -2,12 +2,19 @@
 
 rm -rf libtinysoundfont
 mkdir libtinysoundfont
-cp TinySoundFont/tsf.h TinySoundFont/README* TinySoundFont/LICENSE TinySoundFont/fast*.h TinySoundFont/cast.h libtinysoundfont/.
+cp TinySoundFont/README* TinySoundFont/LICENSE TinySoundFont/fast*.h TinySoundFont/cast.h libtinysoundfont/.
+# tsf.h carries our fixed-point renderer, streaming and filter changes, so keep it (and its notes) rather than
+# taking the submodule's copy.  Upstream changes need merging by hand.
+cp ../src/libtinysoundfont/tsf.h ../src/libtinysoundfont/README.ESP8266Audio.md libtinysoundfont/.
+if ! diff -q TinySoundFont/tsf.h libtinysoundfont/tsf.h > /dev/null; then
+    echo "Kept src/libtinysoundfont/tsf.h; merge any wanted changes from lib/TinySoundFont/tsf.h by hand"
+fi
 cd TinySoundFont/examples
 bash build-linux-gcc.sh
 cd ../..
 ./TinySoundFont/examples/dump-linux-x86_64 midi-sources/1mgm.sf2 libtinysoundfont/1mgm.h
 ./TinySoundFont/examples/dump-linux-x86_64 midi-sources/Scratch2010.sf2 libtinysoundfont/scratch2010.h
+python3 tsf-keyspans.py libtinysoundfont/1mgm.h libtinysoundfont/scratch2010.h
 for i in venture furelise jm_mozdi; do
     xxd -i midi-sources/$i.mid | sed '$ d' | sed 's/unsigned.*/const unsigned char _mid[] PROGMEM = {/' > ../examples/PlayMIDIFromROM/"$i"_mid.h
 done
@@ -0,0 +1,33 @@
+/* ESP8266Audio: not part of upstream Opus.  install-opus.sh copies this into libopus/include
+   next to the upstream headers, which it regenerates unchanged. */
+
+#ifndef OPUS_MULTISTREAM_SCRATCH_H
+#define OPUS_MULTISTREAM_SCRATCH_H
+
+#include "opus_multistream.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** As opus_multistream_decode(), but each elementary stream is decoded into
+  * <code>scratch</code> instead of a buffer on the stack, as 120 ms of stereo
+  * doesn't fit in the ESP8266's 4K stack.
+  * @param scratch <tt>opus_int16*</tt>: Room for <code>2*frame_size</code>
+  *                                     samples (fixed point builds only).
+  */
+OPUS_EXPORT OPUS_WARN_UNUSED_RESULT int opus_multistream_decode_scratch(
+    OpusMSDecoder *st,
+    const unsigned char *data,
+    opus_int32 len,
+    opus_int16 *pcm,
+    int frame_size,
+    int decode_fec,
+    opus_int16 *scratch
+) OPUS_ARG_NONNULL(1) OPUS_ARG_NONNULL(4) OPUS_ARG_NONNULL(7);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OPUS_MULTISTREAM_SCRATCH_H */
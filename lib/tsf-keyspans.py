@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+#
+# Adds the per-preset keySpans tables to SoundFont headers written by the TinySoundFont dump tool,
+# so note-on in a PROGMEM bank only tests the regions that can cover a key.  Each of the 64 words
+# holds two keys, the even one in its low half, as (first region) | (one past the last region) << 8,
+# the same index tsf_load builds in RAM.  Run again on a header that has them to regenerate them.
+#
+# Usage: tsf-keyspans.py HEADER.H [HEADER.H...]
+
+import re
+import sys
+
+REGIONS = re.compile(r'^static const struct tsf_region preset_(\d+)_regions\[\] PROGMEM = \{$')
+KEYS = re.compile(r'^ \.lokey=(\d+), \.hikey=(\d+),')
+PRESETS = 'static const struct tsf_preset presets[] PROGMEM = {'
+MAX_REGIONS = 255
+
+
+def key_spans(keys):
+    spans = [0] * 64
+    for key in range(128):
+        first, end = 0, 0
+        for i, (lo, hi) in enumerate(keys):
+            if lo <= key <= hi:
+                if not end:
+                    first = i
+                end = i + 1
+        spans[key >> 1] |= (first | (end << 8)) << ((key & 1) * 16)
+    return spans
+
+
+def add_key_spans(path):
+    with open(path) as f:
+        lines = f.read().split('\n')
+
+    # Drop any tables from an earlier run, and the references to them
+    out, skip = [], False
+    for line in lines:
+        if re.match(r'^static const tsf_u32 preset_\d+_keyspans\[64\] PROGMEM = \{$', line):
+            skip = True
+        elif skip:
+            skip = (line != '};')
+        elif line.startswith(' .keySpans='):
+            out[-1] = out[-1].rstrip(',')
+        else:
+            out.append(line)
+    lines = out
+
+    # Region key ranges, in the order note-on walks them
+    regions, preset = {}, None
+    for line in lines:
+        m = REGIONS.match(line)
+        if m:
+            preset = int(m.group(1))
+            regions[preset] = []
+            continue
+        m = KEYS.match(line)
+        if m and preset is not None:
+            regions[preset].append((int(m.group(1)), int(m.group(2))))
+        elif line == PRESETS:
+            preset = None
+
+    out = []
+    for line in lines:
+        m = re.match(r'^ \.regions=preset_(\d+)_regions,$', line)
+        if m:
+            preset = int(m.group(1))
+        if line == PRESETS:
+            for p in sorted(regions):
+                if len(regions[p]) > MAX_REGIONS:
+                    continue
+                spans = key_spans(regions[p])
+                out.append('static const tsf_u32 preset_%d_keyspans[64] PROGMEM = {' % p)
+                for row in range(0, 64, 8):
+                    out.append(' ' + ' '.join('0x%08x,' % w for w in spans[row:row + 8]))
+                out.append('};')
+        elif re.match(r'^ \.regionNum=\d+$', line) and preset is not None and len(regions.get(preset, [])) <= MAX_REGIONS:
+            out.append(line + ',')
+            line = ' .keySpans=preset_%d_keyspans' % preset
+            preset = None
+        out.append(line)
+
+    with open(path, 'w') as f:
+        f.write('\n'.join(out))
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 2:
+        sys.exit('usage: tsf-keyspans.py HEADER.H [HEADER.H...]')
+    for header in sys.argv[1:]:
+        add_key_spans(header)
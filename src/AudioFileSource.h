@@ -60,6 +60,17 @@ public:
     virtual bool loop() {
         return true;
     };
+    // Zero-copy access for sources holding the whole file in addressable memory.  Returns the
+    // bytes at the current position and sets avail to how many follow, or NULL if the data can
+    // only be copied out with read().  The bytes are read-only and stay valid until close().
+    virtual const uint8_t *peek(uint32_t *avail) {
+        *avail = 0;
+        return NULL;
+    };
+    // Step over bytes used straight from peek()
+    virtual bool consume(uint32_t len) {
+        return seek(len, SEEK_CUR);
+    };
 
 public:
     virtual bool RegisterMetadataCB(AudioStatus::metadataCBFn fn, void *data) {
@@ -0,0 +1,166 @@
+/*
+    AudioFileSourceMMAP
+    Memory-mapped file source for host (non-Arduino) builds, which
+    decoders can use in place through peek() and consume()
+
+    Copyright (C) 2025  Earle F. Philhower, III
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <Arduino.h>
+#ifndef ARDUINO
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "AudioFileSourceMMAP.h"
+
+// How far ahead of the read position the kernel is asked to fault pages in
+static const uint32_t readAheadLen = 1024 * 1024;
+
+AudioFileSourceMMAP::AudioFileSourceMMAP() {
+    opened = false;
+    map = NULL;
+    size = 0;
+    pos = 0;
+    advised = 0;
+}
+
+AudioFileSourceMMAP::AudioFileSourceMMAP(const char *filename) : AudioFileSourceMMAP() {
+    open(filename);
+}
+
+AudioFileSourceMMAP::~AudioFileSourceMMAP() {
+    close();
+}
+
+bool AudioFileSourceMMAP::open(const char *filename) {
+    close();
+    int fd = ::open(filename, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) || (st.st_size > 0xffffffffLL)) {
+        ::close(fd);
+        return false;
+    }
+    size = st.st_size;
+    if (size) {
+        void *m = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (m == MAP_FAILED) {
+            ::close(fd);
+            size = 0;
+            return false;
+        }
+        map = reinterpret_cast<const uint8_t *>(m);
+        // Audio is read front to back, so let the kernel read ahead hard and drop pages behind us
+        madvise(m, size, MADV_SEQUENTIAL);
+#ifdef POSIX_FADV_SEQUENTIAL
+        posix_fadvise(fd, 0, size, POSIX_FADV_SEQUENTIAL);
+#endif
+    }
+    // The mapping keeps the file alive, so the descriptor isn't needed any more
+    ::close(fd);
+    opened = true;
+    pos = 0;
+    advised = 0;
+    readAhead();
+    return true;
+}
+
+// Keep the next readAheadLen bytes on their way in, in page sized steps
+void AudioFileSourceMMAP::readAhead() {
+    if (!map || (advised >= size) || (pos + readAheadLen / 2 < advised)) {
+        return;
+    }
+    uint32_t page = sysconf(_SC_PAGESIZE);
+    uint32_t start = (pos > advised) ? pos : advised;
+    start &= ~(page - 1);
+    uint32_t len = (size - start > readAheadLen) ? readAheadLen : size - start;
+    madvise(const_cast<uint8_t *>(map) + start, len, MADV_WILLNEED);
+    advised = start + len;
+}
+
+uint32_t AudioFileSourceMMAP::read(void *data, uint32_t len) {
+    if (!opened || (pos >= size)) {
+        return 0;
+    }
+    if (len > size - pos) {
+        len = size - pos;
+    }
+    memcpy(data, map + pos, len);
+    pos += len;
+    readAhead();
+    return len;
+}
+
+const uint8_t *AudioFileSourceMMAP::peek(uint32_t *avail) {
+    if (!opened || !map) {
+        *avail = 0;
+        return NULL;
+    }
+    *avail = size - pos;
+    return map + pos;
+}
+
+bool AudioFileSourceMMAP::consume(uint32_t len) {
+    if (!opened || (len > size - pos)) {
+        return false;
+    }
+    pos += len;
+    readAhead();
+    return true;
+}
+
+bool AudioFileSourceMMAP::seek(int32_t offset, int dir) {
+    if (!opened) {
+        return false;
+    }
+    int64_t newPos;
+    switch (dir) {
+    case SEEK_SET: newPos = offset; break;
+    case SEEK_CUR: newPos = (int64_t)pos + offset; break;
+    case SEEK_END: newPos = (int64_t)size + offset; break;
+    default: return false;
+    }
+    if ((newPos < 0) || (newPos > size)) {
+        return false;
+    }
+    pos = newPos;
+    // Start the read-ahead over from wherever we landed
+    advised = pos;
+    readAhead();
+    return true;
+}
+
+bool AudioFileSourceMMAP::close() {
+    if (map) {
+        munmap(const_cast<uint8_t *>(map), size);
+    }
+    opened = false;
+    map = NULL;
+    size = 0;
+    pos = 0;
+    advised = 0;
+    return true;
+}
+
+bool AudioFileSourceMMAP::isOpen() {
+    return opened;
+}
+
+#endif
@@ -0,0 +1,63 @@
+/*
+    AudioFileSourceMMAP
+    Memory-mapped file source for host (non-Arduino) builds, which
+    decoders can use in place through peek() and consume()
+
+    Copyright (C) 2025  Earle F. Philhower, III
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _AUDIOFILESOURCEMMAP_H
+#define _AUDIOFILESOURCEMMAP_H
+
+#include <Arduino.h>
+
+#ifndef ARDUINO
+
+#include "AudioFileSource.h"
+
+class AudioFileSourceMMAP : public AudioFileSource {
+public:
+    AudioFileSourceMMAP();
+    AudioFileSourceMMAP(const char *filename);
+    virtual ~AudioFileSourceMMAP() override;
+
+    virtual bool open(const char *filename) override;
+    virtual uint32_t read(void *data, uint32_t len) override;
+    virtual bool seek(int32_t pos, int dir) override;
+    virtual bool close() override;
+    virtual bool isOpen() override;
+    virtual uint32_t getSize() override {
+        return size;
+    };
+    virtual uint32_t getPos() override {
+        return pos;
+    };
+    virtual const uint8_t *peek(uint32_t *avail) override;
+    virtual bool consume(uint32_t len) override;
+
+private:
+    void readAhead();
+
+    bool opened;
+    const uint8_t *map;
+    uint32_t size;
+    uint32_t pos;
+    uint32_t advised; // End of the range already handed to madvise(MADV_WILLNEED)
+};
+
+#endif // !ARDUINO
+
+#endif
@@ -102,3 +102,26 @@ uint32_t AudioFileSourcePROGMEM::read(void *data, uint32_t len) {
 }
 
 
+
+const uint8_t *AudioFileSourcePROGMEM::peek(uint32_t *avail) {
+    *avail = 0;
+    if (!opened) {
+        return NULL;
+    }
+#ifdef ESP8266
+    // Flash there only allows aligned 32-bit loads, so only RAM data can be used in place
+    if ((uintptr_t)progmemData >= 0x40000000) {
+        return NULL;
+    }
+#endif
+    *avail = progmemLen - filePointer;
+    return reinterpret_cast<const uint8_t*>(progmemData) + filePointer;
+}
+
+bool AudioFileSourcePROGMEM::consume(uint32_t len) {
+    if (!opened || (len > progmemLen - filePointer)) {
+        return false;
+    }
+    filePointer += len;
+    return true;
+}
@@ -33,6 +33,8 @@ public:
     virtual bool close() override;
     virtual bool isOpen() override;
     virtual uint32_t getSize() override;
+    virtual const uint8_t *peek(uint32_t *avail) override;
+    virtual bool consume(uint32_t len) override;
     virtual uint32_t getPos() override {
         if (!opened) {
             return 0;
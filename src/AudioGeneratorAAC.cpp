@@ -138,6 +138,30 @@ bool AudioGeneratorAAC::FillBufferWithValidFrame() {
     return true;
 }
 
+// Memory-backed sources are decoded where they are instead of being copied into buff.  This
+// needs any buffered data to be used up and a maximum sized frame to be available, otherwise
+// (e.g. for the last frame of the file) the copying path takes over.
+bool AudioGeneratorAAC::FindFrameInPlace(const uint8_t **frame, int *len) {
+    uint32_t avail;
+    if (buffValid > lastFrameEnd) {
+        return false;
+    }
+    const uint8_t *mem = file->peek(&avail);
+    if (!mem || (avail < (uint32_t)buffLen)) {
+        return false;
+    }
+    int nextSync = AACFindSyncWord(const_cast<unsigned char *>(mem), avail);
+    if (nextSync < 0) {
+        return false;
+    }
+    file->consume(nextSync);
+    buffValid = 0;
+    lastFrameEnd = 0;
+    *frame = mem + nextSync;
+    *len = avail - nextSync;
+    return true;
+}
+
 bool AudioGeneratorAAC::loop() {
     if (!running) {
         goto done;    // Nothing to do here!
@@ -160,18 +184,26 @@ bool AudioGeneratorAAC::loop() {
     }
 
     // No samples available, need to decode a new frame
-    if (FillBufferWithValidFrame()) {
-        // buff[0] start of frame, decode it...
-        unsigned char *inBuff = reinterpret_cast<unsigned char *>(buff);
-        int bytesLeft = buffValid;
+    const uint8_t *frame;
+    int frameLen;
+    bool inPlace;
+    inPlace = FindFrameInPlace(&frame, &frameLen);
+    if (inPlace || FillBufferWithValidFrame()) {
+        // buff[0] or frame[0] start of frame, decode it...
+        unsigned char *inBuff = inPlace ? const_cast<unsigned char *>(frame) : reinterpret_cast<unsigned char *>(buff);
+        int bytesLeft = inPlace ? frameLen : buffValid;
         int ret = AACDecode(hAACDecoder, &inBuff, &bytesLeft, outSample);
+        if (inPlace) {
+            // Step over the frame, or just its sync word if it was bad
+            file->consume(ret ? 1 : frameLen - bytesLeft);
+        }
         if (ret) {
             // Error, skip the frame...
             char buff[48];
             sprintf_P(buff, PSTR("AAC decode error %d"), ret);
             cb.st(ret, buff);
         } else {
-            lastFrameEnd = buffValid - bytesLeft;
+            lastFrameEnd = inPlace ? 0 : buffValid - bytesLeft;
             AACFrameInfo fi;
             AACGetLastFrameInfo(hAACDecoder, &fi);
             if ((int)fi.sampRateOut != (int)lastRate) {
@@ -47,6 +47,7 @@ protected:
     int16_t buffValid;
     int16_t lastFrameEnd;
     bool FillBufferWithValidFrame(); // Read until we get a valid syncword and min(feof, 2048) butes in the buffer
+    bool FindFrameInPlace(const uint8_t **frame, int *len); // Same, but pointing into a memory-backed source
 
     // Output buffering
 #ifdef ESP8266
@@ -19,16 +19,109 @@
 */
 
 #include <AudioGeneratorFLAC.h>
+#ifndef ARDUINO
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+extern "C" {
+#include "libflac/private/crc.h"
+}
+#endif
+
+// Multichannel to stereo downmix gains in Q14, indexed by [channels - 3][left/right][source channel].
+// FLAC channel order is fixed by the spec.  The gains for each output sum to at most 1.0 so it can't
+// clip, and the LFE channel is left out of every layout that has one, as in the ITU downmix.
+static const int16_t flacDownmixQ14[6][2][8] PROGMEM = {
+    { { 9598,    0, 6786,    0,    0,    0,    0,    0 }, {    0, 9598, 6786,    0,    0,    0,    0,    0 } }, // L R C
+    { { 9598,    0, 6786,    0,    0,    0,    0,    0 }, {    0, 9598,    0, 6786,    0,    0,    0,    0 } }, // FL FR BL BR
+    { { 6786,    0, 4799, 4799,    0,    0,    0,    0 }, {    0, 6786, 4799,    0, 4799,    0,    0,    0 } }, // FL FR FC BL BR
+    { { 6786,    0, 4799,    0, 4799,    0,    0,    0 }, {    0, 6786, 4799,    0,    0, 4799,    0,    0 } }, // FL FR FC LFE BL BR
+    { { 5622,    0, 3975,    0, 2811, 3975,    0,    0 }, {    0, 5622, 3975,    0, 2811,    0, 3975,    0 } }, // FL FR FC LFE BC SL SR
+    { { 5248,    0, 3712,    0, 3712,    0, 3712,    0 }, {    0, 5248, 3712,    0,    0, 3712,    0, 3712 } }  // FL FR FC LFE BL BR SL SR
+};
+
+// Scale a FLAC sample of any bit depth to signed 16 bits
+static inline int32_t flacTo16(FLAC__int32 s, int shift) {
+    return (shift >= 0) ? (s >> shift) : (s * (1 << -shift));
+}
+
+static inline int16_t flacClip16(int32_t s) {
+    if (s > 32767) {
+        return 32767;
+    } else if (s < -32768) {
+        return -32768;
+    }
+    return (int16_t)s;
+}
+
+// Mono or stereo planar FLAC block to interleaved stereo int16
+static void flacInterleave(int16_t *dest, const FLAC__int32 *l, const FLAC__int32 *r, uint32_t count, int shift) {
+    for (uint32_t i = 0; i < count; i++) {
+        dest[i * 2 + AudioOutput::LEFTCHANNEL] = flacClip16(flacTo16(l[i], shift));
+        dest[i * 2 + AudioOutput::RIGHTCHANNEL] = flacClip16(flacTo16(r[i], shift));
+    }
+}
+
+// 3 to 8 channel planar FLAC block to a stereo int16 downmix
+static void flacDownmix(int16_t *dest, const FLAC__int32 *const buffer[], int channels, uint32_t count, int shift) {
+    int32_t gain[2][8];
+    for (int o = 0; o < 2; o++) {
+        for (int c = 0; c < 8; c++) {
+            gain[o][c] = (int16_t)pgm_read_word(&flacDownmixQ14[channels - 3][o][c]);
+        }
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        int32_t acc[2] = { 0, 0 };
+        for (int c = 0; c < channels; c++) {
+            int32_t s = flacClip16(flacTo16(buffer[c][i], shift));
+            acc[0] += s * gain[0][c];
+            acc[1] += s * gain[1][c];
+        }
+        dest[i * 2 + AudioOutput::LEFTCHANNEL] = flacClip16(acc[0] >> 14);
+        dest[i * 2 + AudioOutput::RIGHTCHANNEL] = flacClip16(acc[1] >> 14);
+    }
+}
+
+// Frames [from, from + count) of a planar FLAC block to interleaved stereo int16
+static void flacToStereo(int16_t *dest, const FLAC__int32 *const buffer[], int channels, uint32_t from, uint32_t count, int shift) {
+    if (channels == 1) {
+        flacInterleave(dest, buffer[0] + from, buffer[0] + from, count, shift);
+    } else if (channels == 2) {
+        flacInterleave(dest, buffer[0] + from, buffer[1] + from, count, shift);
+    } else {
+        const FLAC__int32 *at[8];
+        for (int c = 0; c < channels; c++) {
+            at[c] = buffer[c] + from;
+        }
+        flacDownmix(dest, at, channels, count, shift);
+    }
+}
 
 AudioGeneratorFLAC::AudioGeneratorFLAC() {
     flac = NULL;
     channels = 0;
     sampleRate = 0;
     bitsPerSample = 0;
-    buff[0] = NULL;
-    buff[1] = NULL;
+    streamRate = 0;
     buffPtr = 0;
     buffLen = 0;
+    blockChannels = 0;
+    blockShift = 0;
+    blockPtr = 0;
+    blockLen = 0;
+    peekPos = 0;
+    peekLen = 0;
+    ogg = false;
+    oggSerialValid = false;
+    oggSerial = 0;
+    oggPkt = NULL;
+    oggRemain = 0;
+    md5Check = false;
+    md5 = NULL;
+    md5Len = 0;
+    md5Pos = 0;
     running = false;
 }
 
@@ -37,6 +130,7 @@ AudioGeneratorFLAC::~AudioGeneratorFLAC() {
         FLAC__stream_decoder_delete(flac);
     }
     flac = NULL;
+    md5Finish(false);
 }
 
 bool AudioGeneratorFLAC::begin(AudioFileSource *source, AudioOutput *output) {
@@ -57,20 +151,51 @@ bool AudioGeneratorFLAC::begin(AudioFileSource *source, AudioOutput *output) {
         return false;
     }
 
+    // Ogg-FLAC can't be seeked by byte offset, so libflac gets no seek/tell/length for it
+    peekPos = 0;
+    peekLen = file->read(peek, sizeof(peek));
+    ogg = (peekLen == sizeof(peek)) && !memcmp(peek, "OggS", 4);
+    oggSerialValid = false;
+    oggRemain = 0;
+    if (ogg) {
+        oggDemux.begin(file, peek, peekLen);
+        peekPos = peekLen;
+    }
+
+    md5Finish(false);
+    if (md5Check) {
+        md5 = (FLAC__MD5Context *)malloc(sizeof(FLAC__MD5Context));
+        if (md5) {
+            FLAC__MD5Init(md5);
+        }
+    }
+
     (void)FLAC__stream_decoder_set_md5_checking(flac, false);
+    // Only parse the blocks we use, everything else (PICTURE, PADDING, ...) is skipped over with a seek
+    (void)FLAC__stream_decoder_set_metadata_respond(flac, FLAC__METADATA_TYPE_SEEKTABLE);
+    (void)FLAC__stream_decoder_set_metadata_respond(flac, FLAC__METADATA_TYPE_VORBIS_COMMENT);
 
-    FLAC__StreamDecoderInitStatus ret = FLAC__stream_decoder_init_stream(flac, _read_cb, _seek_cb, _tell_cb, _length_cb, _eof_cb, _write_cb, _metadata_cb, _error_cb, reinterpret_cast<void*>(this));
+    FLAC__StreamDecoderInitStatus ret;
+    if (ogg) {
+        ret = FLAC__stream_decoder_init_stream(flac, _read_cb, NULL, NULL, NULL, _eof_cb, _write_cb, _metadata_cb, _error_cb, reinterpret_cast<void*>(this));
+    } else {
+        ret = FLAC__stream_decoder_init_stream(flac, _read_cb, _seek_cb, _tell_cb, _length_cb, _eof_cb, _write_cb, _metadata_cb, _error_cb, reinterpret_cast<void*>(this));
+    }
     if (ret != FLAC__STREAM_DECODER_INIT_STATUS_OK) {
         FLAC__stream_decoder_delete(flac);
         flac = NULL;
+        md5Finish(false);
         return false;
     }
 
     output->begin();
     running = true;
-    lastSample[0] = 0;
-    lastSample[1] = 0;
+    buffPtr = 0;
+    buffLen = 0;
+    blockPtr = 0;
+    blockLen = 0;
     channels = 0;
+    streamRate = 0;
     return true;
 }
 
@@ -81,12 +206,8 @@ bool AudioGeneratorFLAC::loop() {
         goto done;
     }
 
-    if (channels && !output->ConsumeSample(lastSample)) {
-        goto done;    // Try and send last buffered sample
-    }
-
     do {
-        if (buffPtr == buffLen) {
+        if ((buffPtr == buffLen) && (blockPtr == blockLen)) {
             ret = FLAC__stream_decoder_process_single(flac);
             if (!ret) {
                 running = false;
@@ -94,12 +215,16 @@ bool AudioGeneratorFLAC::loop() {
             } else {
                 // We might be done...
                 if (FLAC__stream_decoder_get_state(flac) == FLAC__STREAM_DECODER_END_OF_STREAM) {
+                    md5Finish(true);
                     running = false;
                     goto done;
                 }
                 unsigned newsr = FLAC__stream_decoder_get_sample_rate(flac);
                 unsigned newch = FLAC__stream_decoder_get_channels(flac);
                 unsigned newbps = FLAC__stream_decoder_get_bits_per_sample(flac);
+                if (newch > 2) {
+                    newch = 2; // Downmixed in write_cb
+                }
                 if (newsr != sampleRate) {
                     output->SetRate(sampleRate = newsr);
                 }
@@ -112,44 +237,22 @@ bool AudioGeneratorFLAC::loop() {
             }
         }
 
-        // Check for some weird case where above didn't give any data
         if (buffPtr == buffLen) {
-            goto done; // At some point the flac better error and we'll return
-        }
-        if (bitsPerSample <= 8) {
-            lastSample[AudioOutput::LEFTCHANNEL] = buff[0][buffPtr] & 0xffff;
-            if (channels == 2) {
-                lastSample[AudioOutput::RIGHTCHANNEL] = buff[1][buffPtr] & 0xffff;
-            } else {
-                lastSample[AudioOutput::RIGHTCHANNEL] = lastSample[AudioOutput::LEFTCHANNEL];
-            }
-            // Upsample from unsigned 8 bits to signed 16 bits
-            lastSample[AudioOutput::LEFTCHANNEL] = (((int16_t)(lastSample[AudioOutput::LEFTCHANNEL] & 0xff)) - 128) << 8;
-            lastSample[AudioOutput::RIGHTCHANNEL] = (((int16_t)(lastSample[AudioOutput::RIGHTCHANNEL] & 0xff)) - 128) << 8;
-        } else if (bitsPerSample <= 16) {
-            lastSample[AudioOutput::LEFTCHANNEL] = buff[0][buffPtr] & 0xffff;
-            if (channels == 2) {
-                lastSample[AudioOutput::RIGHTCHANNEL] = buff[1][buffPtr] & 0xffff;
-            } else {
-                lastSample[AudioOutput::RIGHTCHANNEL] = lastSample[AudioOutput::LEFTCHANNEL];
-            }
-        } else if (bitsPerSample <= 24) {
-            lastSample[AudioOutput::LEFTCHANNEL] = (buff[0][buffPtr] >> 8) & 0xffff;
-            if (channels == 2) {
-                lastSample[AudioOutput::RIGHTCHANNEL] = (buff[1][buffPtr] >> 8) & 0xffff;
-            } else {
-                lastSample[AudioOutput::RIGHTCHANNEL] = lastSample[AudioOutput::LEFTCHANNEL];
-            }
-        } else {
-            lastSample[AudioOutput::LEFTCHANNEL] = (buff[0][buffPtr] >> 16) & 0xffff;
-            if (channels == 2) {
-                lastSample[AudioOutput::RIGHTCHANNEL] = (buff[1][buffPtr] >> 16) & 0xffff;
-            } else {
-                lastSample[AudioOutput::RIGHTCHANNEL] = lastSample[AudioOutput::LEFTCHANNEL];
+            // Check for some weird case where above didn't give any data
+            if (blockPtr == blockLen) {
+                goto done; // At some point the flac better error and we'll return
             }
+            // Convert the next slice of the block, so RAM use doesn't grow with the blocksize
+            buffLen = (blockLen - blockPtr < BUFF_FRAMES) ? blockLen - blockPtr : BUFF_FRAMES;
+            flacToStereo(buff, block, blockChannels, blockPtr, buffLen, blockShift);
+            blockPtr += buffLen;
+            buffPtr = 0;
         }
-        buffPtr++;
-    } while (running && output->ConsumeSample(lastSample));
+        buffPtr += output->ConsumeSamples(buff + buffPtr * 2, buffLen - buffPtr);
+    } while (running && (buffPtr == buffLen));
+
+    // The output is full, so spend the wait on the deferred MD5
+    md5Hash(512);
 
 done:
     file->loop();
@@ -163,6 +266,12 @@ bool AudioGeneratorFLAC::stop() {
         FLAC__stream_decoder_delete(flac);
     }
     flac = NULL;
+    buffPtr = 0;
+    buffLen = 0;
+    blockPtr = 0;
+    blockLen = 0;
+    md5Finish(false);
+    oggDemux.end();
     running = false;
     output->stop();
     return true;
@@ -172,6 +281,31 @@ bool AudioGeneratorFLAC::isRunning() {
     return running;
 }
 
+bool AudioGeneratorFLAC::seek(uint32_t ms) {
+    if (!running || ogg) {
+        return false;
+    }
+    if (!streamRate && !FLAC__stream_decoder_process_until_end_of_metadata(flac)) {
+        return false;
+    }
+    if (!streamRate) {
+        return false;
+    }
+    // Whatever is left of the current block is stale, and the hash can't cover a stream with a gap
+    buffPtr = 0;
+    buffLen = 0;
+    blockPtr = 0;
+    blockLen = 0;
+    md5Finish(false);
+    // The target frame comes back through write_cb already trimmed to start at the sample
+    if (!FLAC__stream_decoder_seek_absolute(flac, (FLAC__uint64)ms * streamRate / 1000)) {
+        // Past the end or a bad stream, libflac needs a flush before it will decode again
+        FLAC__stream_decoder_flush(flac);
+        return false;
+    }
+    return true;
+}
+
 
 
 FLAC__StreamDecoderReadStatus AudioGeneratorFLAC::read_cb(const FLAC__StreamDecoder *decoder, FLAC__byte buffer[], size_t *bytes) {
@@ -179,7 +313,22 @@ FLAC__StreamDecoderReadStatus AudioGeneratorFLAC::read_cb(const FLAC__StreamDeco
     if (*bytes == 0) {
         return FLAC__STREAM_DECODER_READ_STATUS_ABORT;
     }
-    *bytes = file->read(buffer, sizeof(FLAC__byte) * (*bytes));
+    if (!ogg) {
+        *bytes = readRaw(buffer, sizeof(FLAC__byte) * (*bytes));
+    } else {
+        size_t n = 0;
+        while (n < *bytes) {
+            if (!oggRemain && !oggNextPacket()) {
+                break;
+            }
+            uint32_t cnt = (oggRemain < *bytes - n) ? oggRemain : (uint32_t)(*bytes - n);
+            memcpy(buffer + n, oggPkt, cnt);
+            oggPkt += cnt;
+            n += cnt;
+            oggRemain -= cnt;
+        }
+        *bytes = n;
+    }
     if (*bytes == 0) {
         return FLAC__STREAM_DECODER_READ_STATUS_END_OF_STREAM;
     }
@@ -194,7 +343,7 @@ FLAC__StreamDecoderSeekStatus AudioGeneratorFLAC::seek_cb(const FLAC__StreamDeco
 }
 FLAC__StreamDecoderTellStatus AudioGeneratorFLAC::tell_cb(const FLAC__StreamDecoder *decoder, FLAC__uint64 *absolute_byte_offset) {
     (void) decoder;
-    *absolute_byte_offset = file->getPos();
+    *absolute_byte_offset = file->getPos() - (peekLen - peekPos);
     return FLAC__STREAM_DECODER_TELL_STATUS_OK;
 }
 
@@ -205,34 +354,483 @@ FLAC__StreamDecoderLengthStatus AudioGeneratorFLAC::length_cb(const FLAC__Stream
 }
 FLAC__bool AudioGeneratorFLAC::eof_cb(const FLAC__StreamDecoder *decoder) {
     (void) decoder;
-    if (file->getPos() >= file->getSize()) {
+    if ((peekPos == peekLen) && (file->getPos() >= file->getSize())) {
         return true;
     }
     return false;
 }
 FLAC__StreamDecoderWriteStatus AudioGeneratorFLAC::write_cb(const FLAC__StreamDecoder *decoder, const FLAC__Frame *frame, const FLAC__int32 *const buffer[]) {
     (void) decoder;
+    uint32_t blocksize = frame->header.blocksize;
+    unsigned ch = frame->header.channels;
+
     // Hackish warning here.  FLAC sends the buffer but doesn't free it until the next call to decode_frame, so we stash
-    // the pointers here and use it in our loop() instead of memcpy()'ing into yet another buffer.
-    buffLen = frame->header.blocksize;
-    buff[0] = (const int *)buffer[0];
-    if (frame->header.channels > 1) {
-        buff[1] = (const int *)buffer[1];
-    } else {
-        buff[1] = (const int *)buffer[0];
+    // the pointers here and convert from them in our loop() instead of copying the whole block into yet another buffer.
+    for (unsigned c = 0; c < ch; c++) {
+        block[c] = buffer[c];
+    }
+    blockChannels = ch;
+    // Positive is a right shift down to 16 bits, negative a left shift up to it
+    blockShift = (int)frame->header.bits_per_sample - 16;
+    blockLen = blocksize;
+    blockPtr = 0;
+
+    if (md5) {
+        // Anything the idle time didn't get to has to be hashed before the buffer is reused
+        md5Hash(md5Len - md5Pos);
+        md5Len = FLAC__MD5Format(md5, buffer, ch, blocksize, (frame->header.bits_per_sample + 7) / 8);
+        md5Pos = 0;
     }
-    buffPtr = 0;
     return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
 }
 void AudioGeneratorFLAC::metadata_cb(const FLAC__StreamDecoder *decoder, const FLAC__StreamMetadata *metadata) {
     (void) decoder;
-    (void) metadata;
-    audioLogger->printf_P(PSTR("Metadata\n"));
+    if (metadata->type == FLAC__METADATA_TYPE_STREAMINFO) {
+        streamRate = metadata->data.stream_info.sample_rate;
+        memcpy(md5Sig, metadata->data.stream_info.md5sum, sizeof(md5Sig));
+        static const uint8_t none[16] = { 0 };
+        if (!memcmp(md5Sig, none, sizeof(md5Sig))) {
+            md5Finish(false); // Encoder didn't store one, nothing to check against
+        }
+    } else if (metadata->type == FLAC__METADATA_TYPE_VORBIS_COMMENT) {
+        // Each comment is "NAME=value" in UTF-8, e.g. ARTIST, TITLE or REPLAYGAIN_TRACK_GAIN
+        const FLAC__StreamMetadata_VorbisComment *vc = &metadata->data.vorbis_comment;
+        for (FLAC__uint32 i = 0; i < vc->num_comments; i++) {
+            const char *entry = (const char *)vc->comments[i].entry;
+            const char *eq = entry ? strchr(entry, '=') : NULL;
+            if (!eq) {
+                continue;
+            }
+            char name[32];
+            size_t len = eq - entry;
+            if (len > sizeof(name) - 1) {
+                len = sizeof(name) - 1;
+            }
+            memcpy(name, entry, len);
+            name[len] = 0;
+            cb.md(name, false, eq + 1);
+        }
+    }
+    // The SEEKTABLE is kept by libflac itself, without placeholders
 }
-char AudioGeneratorFLAC::error_cb_str[64];
+uint32_t AudioGeneratorFLAC::readRaw(void *data, uint32_t len) {
+    uint8_t *p = (uint8_t *)data;
+    uint32_t n = 0;
+    while ((peekPos < peekLen) && (n < len)) {
+        p[n++] = peek[peekPos++];
+    }
+    if (n < len) {
+        n += file->read(p + n, len - n);
+    }
+    return n;
+}
+
+// Gets the next packet of the FLAC logical stream.  The first packet's "\x7fFLAC" mapping header
+// is dropped so libflac sees "fLaC" and STREAMINFO next, the rest go through untouched.
+bool AudioGeneratorFLAC::oggNextPacket() {
+    while (oggDemux.nextPacket(&oggPkt, &oggRemain)) {
+        if (!oggSerialValid && oggDemux.bos() && (oggRemain >= 9) && (oggPkt[0] == 0x7f) && !memcmp(oggPkt + 1, "FLAC", 4)) {
+            oggSerial = oggDemux.serial();
+            oggSerialValid = true;
+            oggPkt += 9;
+            oggRemain -= 9;
+        } else if (!oggSerialValid || (oggDemux.serial() != oggSerial)) {
+            continue; // Some other multiplexed stream
+        }
+        if (oggRemain) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void AudioGeneratorFLAC::md5Hash(uint32_t bytes) {
+    if (!md5 || (md5Pos >= md5Len)) {
+        return;
+    }
+    if (bytes > md5Len - md5Pos) {
+        bytes = md5Len - md5Pos;
+    }
+    FLAC__MD5Update(md5, md5->internal_buf.p8 + md5Pos, bytes);
+    md5Pos += bytes;
+}
+
+void AudioGeneratorFLAC::md5Finish(bool report) {
+    if (!md5) {
+        return;
+    }
+    uint8_t digest[16];
+    md5Hash(md5Len - md5Pos);
+    FLAC__MD5Final(digest, md5); // Also frees the format buffer
+    free(md5);
+    md5 = NULL;
+    md5Len = 0;
+    md5Pos = 0;
+    if (report) {
+        if (memcmp(digest, md5Sig, sizeof(digest))) {
+            cb.st(STATUS_MD5_MISMATCH, PSTR("MD5 mismatch"));
+        } else {
+            cb.st(STATUS_MD5_OK, PSTR("MD5 verified"));
+        }
+    }
+}
+
 void AudioGeneratorFLAC::error_cb(const FLAC__StreamDecoder *decoder, FLAC__StreamDecoderErrorStatus status) {
     (void) decoder;
-    strncpy_P(error_cb_str, FLAC__StreamDecoderErrorStatusString[status], sizeof(AudioGeneratorFLAC::error_cb_str) - 1);
+    strncpy_P(error_cb_str, FLAC__StreamDecoderErrorStatusString[status], sizeof(error_cb_str) - 1);
+    error_cb_str[sizeof(error_cb_str) - 1] = 0;
     cb.st((int)status, error_cb_str);
 }
 
+
+#ifndef ARDUINO
+
+// One contiguous run of frames, decoded by its own FLAC__StreamDecoder on a worker thread.
+// A copy of the STREAMINFO block is put in front of the frames so libflac sees a complete stream.
+struct FLACParallelChunk {
+    const uint8_t *hdr;
+    size_t hdrLen;
+    std::vector<uint8_t> data;
+    size_t pos; // Over hdr + data
+    std::vector<int16_t> pcm; // Interleaved stereo, same as write_cb
+    int error; // First FLAC__StreamDecoderErrorStatus seen, or -1
+    bool ok;
+    bool done;
+};
+
+static FLAC__StreamDecoderReadStatus flacChunkRead(const FLAC__StreamDecoder *decoder, FLAC__byte buffer[], size_t *bytes, void *client_data) {
+    (void) decoder;
+    FLACParallelChunk *c = static_cast<FLACParallelChunk*>(client_data);
+    size_t n = 0;
+    while ((n < *bytes) && (c->pos < c->hdrLen + c->data.size())) {
+        const uint8_t *src = (c->pos < c->hdrLen) ? c->hdr + c->pos : c->data.data() + c->pos - c->hdrLen;
+        size_t avail = (c->pos < c->hdrLen) ? c->hdrLen - c->pos : c->hdrLen + c->data.size() - c->pos;
+        size_t cnt = std::min(avail, *bytes - n);
+        memcpy(buffer + n, src, cnt);
+        n += cnt;
+        c->pos += cnt;
+    }
+    *bytes = n;
+    return n ? FLAC__STREAM_DECODER_READ_STATUS_CONTINUE : FLAC__STREAM_DECODER_READ_STATUS_END_OF_STREAM;
+}
+
+static FLAC__StreamDecoderWriteStatus flacChunkWrite(const FLAC__StreamDecoder *decoder, const FLAC__Frame *frame, const FLAC__int32 *const buffer[], void *client_data) {
+    (void) decoder;
+    FLACParallelChunk *c = static_cast<FLACParallelChunk*>(client_data);
+    uint32_t blocksize = frame->header.blocksize;
+    size_t at = c->pcm.size();
+    c->pcm.resize(at + blocksize * 2);
+    int shift = (int)frame->header.bits_per_sample - 16;
+    flacToStereo(&c->pcm[at], buffer, frame->header.channels, 0, blocksize, shift);
+    return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
+}
+
+static void flacChunkError(const FLAC__StreamDecoder *decoder, FLAC__StreamDecoderErrorStatus status, void *client_data) {
+    (void) decoder;
+    FLACParallelChunk *c = static_cast<FLACParallelChunk*>(client_data);
+    if (c->error < 0) {
+        c->error = (int)status;
+    }
+}
+
+static void flacChunkDecode(FLACParallelChunk *c) {
+    FLAC__StreamDecoder *dec = FLAC__stream_decoder_new();
+    c->ok = false;
+    if (dec) {
+        if (FLAC__stream_decoder_init_stream(dec, flacChunkRead, NULL, NULL, NULL, NULL, flacChunkWrite, NULL, flacChunkError, c) == FLAC__STREAM_DECODER_INIT_STATUS_OK) {
+            c->ok = FLAC__stream_decoder_process_until_end_of_stream(dec);
+        }
+        FLAC__stream_decoder_delete(dec);
+    }
+}
+
+// Worker threads decoding chunks in the order they're pushed, which are handed back in that order
+class FLACParallelPool {
+public:
+    FLACParallelPool(int threads) : quit(false) {
+        for (int t = 0; t < threads; t++) {
+            pool.emplace_back(&FLACParallelPool::run, this);
+        }
+    }
+    ~FLACParallelPool() {
+        {
+            std::lock_guard<std::mutex> l(lock);
+            quit = true;
+            jobs.clear();
+        }
+        work.notify_all();
+        for (auto &t : pool) {
+            t.join();
+        }
+        for (auto c : order) {
+            delete c;
+        }
+    }
+    // The pool owns c until next() returns it
+    void push(FLACParallelChunk *c) {
+        std::lock_guard<std::mutex> l(lock);
+        jobs.push_back(c);
+        order.push_back(c);
+        work.notify_one();
+    }
+    size_t held() {
+        std::lock_guard<std::mutex> l(lock);
+        return order.size();
+    }
+    // Waits for the oldest chunk to be decoded
+    FLACParallelChunk *next() {
+        std::unique_lock<std::mutex> l(lock);
+        FLACParallelChunk *c = order.front();
+        finished.wait(l, [c]() {
+            return c->done;
+        });
+        order.pop_front();
+        return c;
+    }
+
+private:
+    void run() {
+        for (;;) {
+            FLACParallelChunk *c;
+            {
+                std::unique_lock<std::mutex> l(lock);
+                work.wait(l, [this]() {
+                    return quit || !jobs.empty();
+                });
+                if (quit) {
+                    return;
+                }
+                c = jobs.front();
+                jobs.pop_front();
+            }
+            flacChunkDecode(c);
+            std::lock_guard<std::mutex> l(lock);
+            c->done = true;
+            finished.notify_all();
+        }
+    }
+    std::mutex lock;
+    std::condition_variable work;
+    std::condition_variable finished;
+    std::deque<FLACParallelChunk *> jobs;
+    std::deque<FLACParallelChunk *> order;
+    std::vector<std::thread> pool;
+    bool quit;
+};
+
+// Length of the frame header at p if it has a sync code, no reserved values, and a good CRC-8, else 0
+static size_t flacFrameHeaderLen(const uint8_t *p, size_t avail) {
+    if ((avail < 6) || (p[0] != 0xff) || ((p[1] & 0xfe) != 0xf8)) {
+        return 0;
+    }
+    uint8_t bs = p[2] >> 4;
+    uint8_t sr = p[2] & 0x0f;
+    uint8_t ch = p[3] >> 4;
+    uint8_t bps = (p[3] >> 1) & 7;
+    if (!bs || (sr == 15) || (ch > 10) || (bps == 3) || (bps == 7) || (p[3] & 1)) {
+        return 0;
+    }
+    // UTF-8 style coded frame or sample number
+    size_t extra;
+    if (!(p[4] & 0x80)) {
+        extra = 0;
+    } else if ((p[4] & 0xe0) == 0xc0) {
+        extra = 1;
+    } else if ((p[4] & 0xf0) == 0xe0) {
+        extra = 2;
+    } else if ((p[4] & 0xf8) == 0xf0) {
+        extra = 3;
+    } else if ((p[4] & 0xfc) == 0xf8) {
+        extra = 4;
+    } else if ((p[4] & 0xfe) == 0xfc) {
+        extra = 5;
+    } else if (p[4] == 0xfe) {
+        extra = 6;
+    } else {
+        return 0;
+    }
+    size_t n = 5 + extra;
+    n += (bs == 6) ? 1 : (bs == 7) ? 2 : 0;
+    n += (sr == 12) ? 1 : ((sr == 13) || (sr == 14)) ? 2 : 0;
+    if (n + 1 > avail) {
+        return 0;
+    }
+    for (size_t i = 5; i < 5 + extra; i++) {
+        if ((p[i] & 0xc0) != 0x80) {
+            return 0;
+        }
+    }
+    return (FLAC__crc8(p, n) == p[n]) ? n + 1 : 0;
+}
+
+// Offset of the first frame at or after pos whose CRC-16 matches up to the next frame header
+// (or the end of the stream), so a sync pattern inside compressed audio is never split on
+static size_t flacFindFrame(const uint8_t *data, size_t pos, size_t len, size_t maxFrame, bool eof) {
+    for (; pos + 6 <= len; pos++) {
+        size_t h = flacFrameHeaderLen(data + pos, len - pos);
+        if (!h) {
+            continue;
+        }
+        size_t limit = std::min(len, pos + maxFrame);
+        for (size_t end = pos + h + 2; end <= limit; end++) {
+            if (((end == len) && eof) || flacFrameHeaderLen(data + end, len - end)) {
+                unsigned crc = ((unsigned)data[end - 2] << 8) | data[end - 1];
+                if (FLAC__crc16(data + pos, end - pos - 2) == crc) {
+                    return pos;
+                }
+            }
+        }
+    }
+    return len;
+}
+
+// Reads from file until in holds want bytes, false if the file ends first
+static bool flacFill(AudioFileSource *file, std::vector<uint8_t> &in, size_t want) {
+    while (in.size() < want) {
+        size_t have = in.size();
+        in.resize(want);
+        uint32_t r = file->read(in.data() + have, want - have);
+        in.resize(have + r);
+        if (!r) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Drops n bytes from the front of the input, reading through anything not yet in it
+static bool flacDrop(AudioFileSource *file, std::vector<uint8_t> &in, size_t n) {
+    while (n > in.size()) {
+        n -= in.size();
+        in.clear();
+        if (!flacFill(file, in, std::min(n, (size_t)65536)) && (in.size() < n)) {
+            return false;
+        }
+    }
+    in.erase(in.begin(), in.begin() + n);
+    return true;
+}
+
+// Moves the next run of whole frames from the input into c, false once the file is used up
+static bool flacNextChunk(AudioFileSource *file, std::vector<uint8_t> &in, const uint8_t *hdr, size_t maxFrame, FLACParallelChunk *c) {
+    // A frame must start within maxFrame of the cut, and be followed by the next header
+    const size_t target = AudioGeneratorFLAC::PARALLEL_CHUNK;
+    bool eof = !flacFill(file, in, target + 2 * maxFrame + 16);
+    size_t cut = in.size();
+    if (in.size() > target) {
+        cut = flacFindFrame(in.data(), target, in.size(), maxFrame, eof);
+    }
+    // Without a frame in reach the data is damaged, so hand it all to the decoder to report
+    c->hdr = hdr;
+    c->hdrLen = 4 + 4 + 34;
+    c->pos = 0;
+    c->error = -1;
+    c->ok = false;
+    c->done = false;
+    c->data.assign(in.begin(), in.begin() + cut);
+    in.erase(in.begin(), in.begin() + cut);
+    return !eof || !in.empty();
+}
+
+// Skips any ID3v2 tag the same way libflac does, copies "fLaC" and STREAMINFO into hdr marked as the
+// last metadata block, and reads past the other blocks so in starts at the first frame
+static bool flacReadHeader(AudioFileSource *file, std::vector<uint8_t> &in, uint8_t hdr[4 + 4 + 34]) {
+    if (flacFill(file, in, 10) && !memcmp(in.data(), "ID3", 3)) {
+        size_t tag = 10 + (((size_t)(in[6] & 0x7f) << 21) | ((in[7] & 0x7f) << 14) | ((in[8] & 0x7f) << 7) | (in[9] & 0x7f));
+        if (!flacDrop(file, in, tag)) {
+            return false;
+        }
+    }
+    if (!flacFill(file, in, 4 + 4 + 34) || memcmp(in.data(), "fLaC", 4) || ((in[4] & 0x7f) != FLAC__METADATA_TYPE_STREAMINFO)) {
+        return false;
+    }
+    memcpy(hdr, in.data(), 4 + 4 + 34);
+    hdr[4] |= 0x80;
+    bool last = false;
+    in.erase(in.begin(), in.begin() + 4);
+    while (!last) {
+        if (!flacFill(file, in, 4)) {
+            return false;
+        }
+        last = in[0] & 0x80;
+        if (!flacDrop(file, in, 4 + (((size_t)in[1] << 16) | (in[2] << 8) | in[3]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool AudioGeneratorFLAC::decodeParallel(AudioFileSource *source, AudioOutput *output, int threads) {
+    if (!source || !output || !source->isOpen()) {
+        return false;
+    }
+    file = source;
+    this->output = output;
+
+    std::vector<uint8_t> in;
+    if (!flacReadHeader(file, in, parallelHdr)) {
+        return false;
+    }
+    const uint8_t *si = parallelHdr + 8;
+    size_t maxFrame = ((size_t)si[7] << 16) | (si[8] << 8) | si[9];
+    if (!maxFrame) {
+        maxFrame = 65536 * 8 * 4 + 64; // Largest legal blocksize, channels and sample size
+    }
+    sampleRate = ((uint32_t)si[10] << 12) | (si[11] << 4) | (si[12] >> 4);
+    unsigned ch = ((si[12] >> 1) & 7) + 1;
+
+    // Two chunks a thread in flight, so the window of file and PCM held stays bounded
+    if (threads <= 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    FLACParallelPool *pool = new FLACParallelPool(threads);
+    bool more = true;
+
+    output->begin();
+    output->SetRate(sampleRate);
+    output->SetChannels(channels = (ch > 2) ? 2 : ch);
+    running = true;
+    while (running && (more || pool->held())) {
+        while (more && (pool->held() < (size_t)threads * 2)) {
+            FLACParallelChunk *c = new FLACParallelChunk();
+            more = flacNextChunk(file, in, parallelHdr, maxFrame, c);
+            if (c->data.empty()) {
+                delete c;
+                break;
+            }
+            pool->push(c);
+        }
+        if (!pool->held()) {
+            break;
+        }
+        // Play back in order while later chunks are still decoding
+        FLACParallelChunk *c = pool->next();
+        running = playChunk(c);
+        delete c;
+    }
+    delete pool; // Drops what's queued and waits for the rest
+    output->stop();
+    bool ret = running;
+    running = false;
+    return ret;
+}
+
+bool AudioGeneratorFLAC::playChunk(FLACParallelChunk *c) {
+    if (c->error >= 0) {
+        strncpy_P(error_cb_str, FLAC__StreamDecoderErrorStatusString[c->error], sizeof(error_cb_str) - 1);
+        error_cb_str[sizeof(error_cb_str) - 1] = 0;
+        cb.st(c->error, error_cb_str);
+    }
+    if (!c->ok) {
+        return false;
+    }
+    size_t frames = c->pcm.size() / 2;
+    size_t done = 0;
+    while (done < frames) {
+        done += output->ConsumeSamples(&c->pcm[done * 2], (uint16_t)std::min(frames - done, (size_t)32768));
+        output->loop();
+    }
+    return true;
+}
+
+#endif
@@ -22,8 +22,10 @@
 #define _AUDIOGENERATORFLAC_H
 
 #include <AudioGenerator.h>
+#include "AudioOggDemux.h"
 extern "C" {
 #include "libflac/FLAC/stream_decoder.h"
+#include "libflac/private/md5.h"
 };
 
 class AudioGeneratorFLAC : public AudioGenerator {
@@ -34,19 +36,67 @@ public:
     virtual bool loop() override;
     virtual bool stop() override;
     virtual bool isRunning() override;
+    // Check the decoded audio against the STREAMINFO MD5.  Hashing is done in the time spent
+    // waiting on a full output, and the result is sent to the status callback at end of stream.
+    void SetMD5Check(bool check) {
+        md5Check = check;
+    }
+    enum { STATUS_MD5_OK = 16, STATUS_MD5_MISMATCH };
+    // Jump to a time in a native FLAC stream, to the exact sample.  libflac narrows the search with
+    // the file's SEEKTABLE points when it has them.  Ogg-FLAC can't seek, and a seek ends the MD5 check.
+    bool seek(uint32_t ms);
+#ifndef ARDUINO
+    // Host only batch mode: read the source a window at a time, split it at verified frame
+    // boundaries, decode the pieces on a pool of threads, and send the PCM to output in order.
+    // Blocks until done.  Output is identical to begin()/loop().  threads == 0 uses one per core.
+    bool decodeParallel(AudioFileSource *source, AudioOutput *output, int threads = 0);
+    enum { PARALLEL_CHUNK = 128 * 1024 }; // Bytes of FLAC in each piece, two pieces a thread are held
+#endif
 
 protected:
     // FLAC info
     uint16_t channels;
     uint32_t sampleRate;
     uint16_t bitsPerSample;
+    uint32_t streamRate; // From STREAMINFO, so seek() works before the first frame is decoded
 
-    // We need to buffer some data in-RAM to avoid doing 1000s of small reads
-    const int *buff[2];
+    // write_cb keeps libflac's channel pointers for the decoded block, and loop() converts it a
+    // slice at a time into buff as interleaved stereo int16 for ConsumeSamples
+    enum { BUFF_FRAMES = 64 };
+    int16_t buff[BUFF_FRAMES * 2];
     uint16_t buffPtr;
     uint16_t buffLen;
+    const FLAC__int32 *block[8]; // FLAC has at most 8 channels
+    uint16_t blockChannels;
+    int8_t blockShift;
+    uint32_t blockPtr;
+    uint32_t blockLen;
     FLAC__StreamDecoder *flac;
 
+    // First bytes of the file, read to tell native FLAC from Ogg-FLAC and then handed to libflac
+    uint8_t peek[4];
+    uint8_t peekPos;
+    uint8_t peekLen;
+    uint32_t readRaw(void *data, uint32_t len);
+
+    // Ogg-FLAC is unwrapped here into a native FLAC stream for libflac
+    bool ogg;
+    AudioOggDemux oggDemux;
+    bool oggSerialValid;
+    uint32_t oggSerial;
+    const uint8_t *oggPkt;
+    uint32_t oggRemain; // Bytes left in the current packet
+    bool oggNextPacket();
+
+    // Deferred MD5, one frame's worth of bytes is formatted in write_cb and hashed a slice at a time
+    bool md5Check;
+    FLAC__MD5Context *md5;
+    uint8_t md5Sig[16];
+    uint32_t md5Len;
+    uint32_t md5Pos;
+    void md5Hash(uint32_t bytes);
+    void md5Finish(bool report);
+
     // FLAC callbacks, need static functions to bounce into c++ from c
     static FLAC__StreamDecoderReadStatus _read_cb(const FLAC__StreamDecoder *decoder, FLAC__byte buffer[], size_t *bytes, void *client_data) {
         return static_cast<AudioGeneratorFLAC*>(client_data)->read_cb(decoder, buffer, bytes);
@@ -80,8 +130,13 @@ protected:
     FLAC__bool eof_cb(const FLAC__StreamDecoder *decoder);
     FLAC__StreamDecoderWriteStatus write_cb(const FLAC__StreamDecoder *decoder, const FLAC__Frame *frame, const FLAC__int32 *const buffer[]);
     void metadata_cb(const FLAC__StreamDecoder *decoder, const FLAC__StreamMetadata *metadata);
-    static char error_cb_str[64];
+    char error_cb_str[64]; // Per instance so separate files can be decoded on separate threads
     void error_cb(const FLAC__StreamDecoder *decoder, FLAC__StreamDecoderErrorStatus status);
+
+#ifndef ARDUINO
+    uint8_t parallelHdr[4 + 4 + 34]; // "fLaC" and STREAMINFO, given to every decodeParallel worker
+    bool playChunk(struct FLACParallelChunk *c);
+#endif
 };
 
 #endif
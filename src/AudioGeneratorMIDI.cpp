@@ -139,36 +139,28 @@ void AudioGeneratorMIDI::start_track(int tracknum) {
     track[tracknum].trkend = hdrptr;     /* the point past the end of the track */
 }
 
-unsigned char AudioGeneratorMIDI::buffer_byte(int offset) {
-    unsigned char c;
-    file->seek(offset, SEEK_SET);
-    //buffer.seek(buffer.data, offset);
-    file->read(&c, 1);
-    //buffer.read(buffer.data, &c, 1);
-    return c;
-}
-
-unsigned short AudioGeneratorMIDI::buffer_short(int offset) {
-    unsigned short s;
-    file->seek(offset, SEEK_SET);
-    //buffer.seek(buffer.data, offset);
-    file->read(&s, sizeof(short));
-    //    buffer.read(buffer.data, &s, sizeof(short));
-    return s;
-}
+/*  Fetch a byte of track data.  Each track reads ahead through its own small window, so
+    walking the tracks in time order doesn't cost a file seek per byte. */
 
-unsigned int AudioGeneratorMIDI::buffer_int32(int offset) {
-    uint32_t i;
-    file->seek(offset, SEEK_SET);
-    //buffer.seek(buffer.data, offset);
-    file->read(&i, sizeof(i));
-    //buffer.read(buffer.data, &i, sizeof(i));
-    return i;
+unsigned char AudioGeneratorMIDI::track_byte(struct track_status *t, int offset) {
+    if (mem) {
+        return ((unsigned)offset < buflen) ? mem[offset] : 0;
+    }
+    if (offset < t->winptr || offset >= t->winptr + t->winlen) {
+        file->seek(offset, SEEK_SET);
+        t->winptr = offset;
+        t->winlen = file->read(t->window, sizeof(t->window));
+        if (t->winlen <= 0) {
+            t->winlen = 0;
+            return 0;
+        }
+    }
+    return t->window[offset - t->winptr];
 }
 
 /* Get a MIDI-style variable-length integer */
 
-unsigned long AudioGeneratorMIDI::get_varlen(int *ptr) {
+unsigned long AudioGeneratorMIDI::get_varlen(struct track_status *t) {
     /*  Get a 1-4 byte variable-length value and adjust the pointer past it.
         These are a succession of 7-bit values with an MSB bit of zero marking the end */
 
@@ -177,7 +169,7 @@ unsigned long AudioGeneratorMIDI::get_varlen(int *ptr) {
 
     val = 0;
     for (i = 0; i < 4; ++i) {
-        byte = buffer_byte((*ptr)++);
+        byte = track_byte(t, t->trkptr++);
         val = (val << 7) | (byte & 0x7f);
         if (!(byte & 0x80)) {
             return val;
@@ -204,18 +196,18 @@ void AudioGeneratorMIDI::find_note(int tracknum) {
     /* process events */
 
     t = &track[tracknum];        /* our track status structure */
-    while (t->trkptr < t->trkend) {
+    while (running && t->trkptr < t->trkend) {
 
-        delta_time = get_varlen(&t->trkptr);
+        delta_time = get_varlen(t);
         t->time += delta_time;
-        if (buffer_byte(t->trkptr) < 0x80) {
+        if (track_byte(t, t->trkptr) < 0x80) {
             event = t->last_event;    /* using "running status": same event as before */
         } else {                  /* otherwise get new "status" (event type) */
-            event = buffer_byte(t->trkptr++);
+            event = track_byte(t, t->trkptr++);
         }
         if (event == 0xff) {      /* meta-event */
-            meta_cmd = buffer_byte(t->trkptr++);
-            meta_length = get_varlen(&t->trkptr);
+            meta_cmd = track_byte(t, t->trkptr++);
+            meta_length = get_varlen(t);
             switch (meta_cmd) {
             case 0x00:
                 break;
@@ -247,7 +239,7 @@ show_text:
                 break;
             case 0x51:            /* tempo: 3 byte big-endian integer! */
                 t->cmd = CMD_TEMPO;
-                t->tempo = rev_long(buffer_int32(t->trkptr - 1)) & 0xffffffL;
+                t->tempo = ((unsigned long)track_byte(t, t->trkptr) << 16) | (track_byte(t, t->trkptr + 1) << 8) | track_byte(t, t->trkptr + 2);
                 t->trkptr += meta_length;
                 return;
             case 0x54:
@@ -279,14 +271,14 @@ show_hex:
             t->chan = chan;
             switch (event >> 4) {
             case 0x8:
-                t->note = buffer_byte(t->trkptr++);
-                velocity = buffer_byte(t->trkptr++);
+                t->note = track_byte(t, t->trkptr++);
+                velocity = track_byte(t, t->trkptr++);
 note_off:
                 t->cmd = CMD_STOPNOTE;
                 return;             /* stop processing and return */
             case 0x9:
-                t->note = buffer_byte(t->trkptr++);
-                velocity = buffer_byte(t->trkptr++);
+                t->note = track_byte(t, t->trkptr++);
+                velocity = track_byte(t, t->trkptr++);
                 if (velocity == 0) { /* some scores use note-on with zero velocity for off! */
                     goto note_off;
                 }
@@ -294,26 +286,26 @@ note_off:
                 t->cmd = CMD_PLAYNOTE;
                 return;             /* stop processing and return */
             case 0xa:
-                note = buffer_byte(t->trkptr++);
-                velocity = buffer_byte(t->trkptr++);
+                note = track_byte(t, t->trkptr++);
+                velocity = track_byte(t, t->trkptr++);
                 break;
             case 0xb:
-                controller = buffer_byte(t->trkptr++);
-                velocity = buffer_byte(t->trkptr++);
+                controller = track_byte(t, t->trkptr++);
+                velocity = track_byte(t, t->trkptr++);
                 break;
             case 0xc:
-                instrument = buffer_byte(t->trkptr++);
+                instrument = track_byte(t, t->trkptr++);
                 midi_chan_instrument[chan] = instrument;    // record new instrument for this channel
                 break;
             case 0xd:
-                pressure = buffer_byte(t->trkptr++);
+                pressure = track_byte(t, t->trkptr++);
                 break;
             case 0xe:
-                pitchbend = buffer_byte(t->trkptr) | (buffer_byte(t->trkptr + 1) << 7);
+                pitchbend = track_byte(t, t->trkptr) | (track_byte(t, t->trkptr + 1) << 7);
                 t->trkptr += 2;
                 break;
             case 0xf:
-                sysex_length = get_varlen(&t->trkptr);
+                sysex_length = get_varlen(t);
                 t->trkptr += sysex_length;
                 break;
             default:
@@ -333,163 +325,470 @@ note_off:
 }
 
 
-// Open file, parse headers, get ready to process MIDI
-void AudioGeneratorMIDI::PrepareMIDI() { //AudioFileSource *src) {
-    buflen = file->getSize(); //buffer.size(buffer.data);
+// Reset every track to its first event and the score to time 0
+void AudioGeneratorMIDI::RewindMIDI() {
+    memset(track, 0, sizeof(track));
+    memset(midi_chan_instrument, 0, sizeof(midi_chan_instrument));
+    tracks_done = 0;
+    timenow = 0;
+    samplenow = 0;
+    tempo = 500000;              /* 120 beats/minute until the score says otherwise */
+    stopping = false;
 
     /* process the MIDI file header */
 
-    hdrptr = file->getPos(); // buffer.tell(buffer.data);   /* pointer to file and track headers */
+    hdrptr = firsthdr;
     process_header();
+    if (!running) {
+        return;
+    }
     if (num_tracks > MAX_TRACKS) {
-        midi_error("Too many tracks", file->getPos()); //buffer.tell(buffer.data));
+        midi_error("Too many tracks", hdrptr);
+        return;
     }
 
     /* initialize processing of all the tracks */
 
-    for (tracknum = 0; tracknum < num_tracks; ++tracknum) {
+    for (tracknum = 0; tracknum < num_tracks && running; ++tracknum) {
         start_track(tracknum);    /* process the track header */
         find_note(tracknum);      /* position to the first note on/off */
     }
 
-    notes_skipped = 0;
     tracknum = 0;
     earliest_tracknum = 0;
     earliest_time = 0;
 }
 
-// Parses the note on/offs until we are ready to render some more samples.  Then return the
-// total number of samples to render before we need to be called again
-int AudioGeneratorMIDI::PlayMIDI() {
+/*  Merge the tracks to get the next note on or off of the whole score, stamped with the
+    sample it starts at.  Tempo changes are folded into those sample times.
+    Returns false at the end of the score. */
+
+bool AudioGeneratorMIDI::NextEvent(struct midi_event *ev) {
     /*  Continue processing all tracks, in an order based on the simulated time.
         This is not unlike multiway merging used for tape sorting algorithms in the 50's! */
 
-    do {                         /* while there are still track notes to process */
-        static struct track_status *trk;
-        static struct tonegen_status *tg;
-        static int tgnum;
-        static int count_tracks;
-        static unsigned long delta_time, delta_msec;
-
-        /*  Find the track with the earliest event time,
-            and output a delay command if time has advanced.
-
-            A potential improvement: If there are multiple tracks with the same time,
-            first do the ones with STOPNOTE as the next command, if any.  That would
-            help avoid running out of tone generators.  In practice, though, most MIDI
-            files do all the STOPNOTEs first anyway, so it won't have much effect.
-        */
-
-        earliest_time = 0x7fffffff;
-
-        /*  Usually we start with the track after the one we did last time (tracknum),
-            so that if we run out of tone generators, we have been fair to all the tracks.
-            The alternate "strategy1" says we always start with track 0, which means
-            that we favor early tracks over later ones when there aren't enough tone generators.
-        */
-
-        count_tracks = num_tracks;
-        do {
-            if (++tracknum >= num_tracks) {
-                tracknum = 0;
-            }
-            trk = &track[tracknum];
-            if (trk->cmd != CMD_TRACKDONE && trk->time < earliest_time) {
-                earliest_time = trk->time;
-                earliest_tracknum = tracknum;
-            }
-        } while (--count_tracks);
+    while (running && tracks_done < num_tracks) {
+        struct track_status *trk = &track[tracknum];
+        unsigned long delta_time, delta_msec;
 
-        tracknum = earliest_tracknum;     /* the track we picked */
-        trk = &track[tracknum];
-        if (earliest_time < timenow) {
-            midi_error("INTERNAL: time went backwards", trk->trkptr);
-        }
+        /*  A "stop note" is followed by all subsequent "stop notes" for this track that are
+            happening at the same time.  Doing so frees up as many tone generators as possible.  */
+
+        if (!stopping || trk->cmd != CMD_STOPNOTE || trk->time != timenow) {
+            int count_tracks;
+
+            /*  Find the track with the earliest event time.
 
-        /* If time has advanced, output a "delay" command */
+                A potential improvement: If there are multiple tracks with the same time,
+                first do the ones with STOPNOTE as the next command, if any.  That would
+                help avoid running out of tone generators.  In practice, though, most MIDI
+                files do all the STOPNOTEs first anyway, so it won't have much effect.
+            */
 
-        delta_time = earliest_time - timenow;
-        if (delta_time) {
-            /* Convert ticks to milliseconds based on the current tempo */
-            unsigned long long temp;
-            temp = ((unsigned long long) delta_time * tempo) / ticks_per_beat;
-            delta_msec = temp / 1000;      // get around LCC compiler bug
-            if (delta_msec > 0x7fff) {
-                midi_error("INTERNAL: time delta too big", trk->trkptr);
+            earliest_time = 0x7fffffff;
+
+            /*  Usually we start with the track after the one we did last time (tracknum),
+                so that if we run out of tone generators, we have been fair to all the tracks.
+                The alternate "strategy1" says we always start with track 0, which means
+                that we favor early tracks over later ones when there aren't enough tone generators.
+            */
+
+            count_tracks = num_tracks;
+            do {
+                if (++tracknum >= num_tracks) {
+                    tracknum = 0;
+                }
+                trk = &track[tracknum];
+                if (trk->cmd != CMD_TRACKDONE && trk->time < earliest_time) {
+                    earliest_time = trk->time;
+                    earliest_tracknum = tracknum;
+                }
+            } while (--count_tracks);
+
+            tracknum = earliest_tracknum;     /* the track we picked */
+            trk = &track[tracknum];
+            if (earliest_time < timenow) {
+                midi_error("INTERNAL: time went backwards", trk->trkptr);
+                return false;
+            }
+
+            /* If time has advanced, move the sample clock and look again */
+
+            delta_time = earliest_time - timenow;
+            if (delta_time) {
+                /* Convert ticks to milliseconds based on the current tempo */
+                unsigned long long temp;
+                temp = ((unsigned long long) delta_time * tempo) / ticks_per_beat;
+                delta_msec = temp / 1000;      // get around LCC compiler bug
+                if (delta_msec > 0x7fff) {
+                    midi_error("INTERNAL: time delta too big", trk->trkptr);
+                    return false;
+                }
+                samplenow += (((int) delta_msec) * freq) / 1000;
+                timenow = earliest_time;
+                stopping = false;
+                continue;
             }
-            int samples = (((int) delta_msec) * freq) / 1000;
-            timenow = earliest_time;
-            return samples;
         }
-        timenow = earliest_time;
+        stopping = false;
 
         /*  If this track event is "set tempo", just change the global tempo.
-            That affects how we generate "delay" commands. */
+            That affects how we advance the sample clock. */
 
         if (trk->cmd == CMD_TEMPO) {
             tempo = trk->tempo;
             find_note(tracknum);
         }
 
-        /*  If this track event is "stop note", process it and all subsequent "stop notes" for this track
-            that are happening at the same time. Doing so frees up as many tone generators as possible.  */
-
-        else if (trk->cmd == CMD_STOPNOTE)
-            do {
-                // stop a note
-                for (tgnum = 0; tgnum < num_tonegens; ++tgnum) {    /* find which generator is playing it */
-                    tg = &tonegen[tgnum];
-                    if (tg->playing && tg->track == tracknum && tg->note == trk->note) {
-                        tsf_note_off/*_fast*/(g_tsf, tg->instrument, tg->note);//, tg->playIndex);
-                        tg->playing = false;
-                        tg->playIndex = -1;
-                        trk->tonegens[tgnum] = false;
-                    }
-                }
-                find_note(tracknum);        // use up the note
-            } while (trk->cmd == CMD_STOPNOTE && trk->time == timenow);
+        else if (trk->cmd == CMD_STOPNOTE) {
+            ev->sample = samplenow;
+            ev->track = tracknum;
+            ev->note = trk->note;
+            stopping = true;
+            find_note(tracknum);        // use up the note
+            return true;
+        }
 
-        /*  If this track event is "start note", process only it.
+        /*  If this track event is "start note", return only it.
             Don't do more than one, so we allow other tracks their chance at grabbing tone generators. */
 
         else if (trk->cmd == CMD_PLAYNOTE) {
+            ev->sample = samplenow;
+            ev->track = tracknum | EVENT_NOTEON;
+            ev->note = trk->note;
+            ev->velocity = trk->velocity;
+            ev->instrument = midi_chan_instrument[trk->chan];
+            find_note(tracknum);      // use up the note
+            return true;
+        }
+    }
+    return false;
+}
+
+// The next event to play, from the pre-parsed list or merged straight from the file
+struct AudioGeneratorMIDI::midi_event *AudioGeneratorMIDI::PeekEvent() {
+    if (events) {
+        return (nextEvent < numEvents) ? &events[nextEvent] : nullptr;
+    }
+    if (!havePending) {
+        havePending = NextEvent(&pending);
+    }
+    return havePending ? &pending : nullptr;
+}
+
+// Open file, parse headers, get ready to process MIDI
+void AudioGeneratorMIDI::PrepareMIDI() { //AudioFileSource *src) {
+    struct midi_event ev;
+    uint32_t avail;
+    int count = 0;
+
+    buflen = file->getSize(); //buffer.size(buffer.data);
+    firsthdr = file->getPos();   /* pointer to file and track headers */
+
+    // If the whole file is already in memory, just parse it where it sits
+    mem = file->peek(&avail);
+    if (mem && (avail >= buflen - firsthdr)) {
+        mem -= firsthdr;
+    } else {
+        mem = nullptr;
+    }
+
+    /*  Merge all the tracks once up front.  If the result fits, playback just walks
+        the list.  Otherwise the tracks get merged again as the score plays. */
+
+    free(events);
+    events = nullptr;
+    numEvents = 0;
+    nextEvent = 0;
+    havePending = false;
+    playnow = 0;
+
+    RewindMIDI();
+    while (maxEventBytes && NextEvent(&ev)) {
+        if (++count > (int)(maxEventBytes / sizeof(ev))) {
+            count = 0;
+            break;
+        }
+    }
+    if (running && count) {
+        events = (struct midi_event *)malloc(count * sizeof(ev));
+    }
+    RewindMIDI();
+    if (events) {
+        while (numEvents < count && NextEvent(&events[numEvents])) {
+            numEvents++;
+        }
+    }
+
+    notes_skipped = 0;
+    voices_stolen = 0;
+}
+
+// Plays the note on/offs until we are ready to render some more samples.  Then return the
+// total number of samples to render before we need to be called again
+int AudioGeneratorMIDI::PlayMIDI() {
+    struct midi_event *ev;
+
+    while ((ev = PeekEvent()) != nullptr) {
+        struct tonegen_status *tg;
+        int tgnum;
+        int tracknum = ev->track & ~EVENT_NOTEON;
+
+        if (ev->sample > playnow) {
+            int samples = ev->sample - playnow;
+            playnow = ev->sample;
+            return samples;
+        }
+
+        if (!(ev->track & EVENT_NOTEON)) {
+            // stop a note
+            for (tgnum = 0; tgnum < num_tonegens; ++tgnum) {    /* find which generator is playing it */
+                tg = &tonegen[tgnum];
+                if (tg->playing && tg->track == tracknum && tg->note == ev->note) {
+                    tsf_note_off/*_fast*/(g_tsf, tg->instrument, tg->note);//, tg->playIndex);
+                    tg->playing = false;
+                    tg->playIndex = -1;
+                }
+            }
+        } else {
             bool foundgen = false;
-            /* if not, then try for any free tone generator */
-            if (!foundgen)
-                for (tgnum = 0; tgnum < num_tonegens; ++tgnum) {
-                    tg = &tonegen[tgnum];
-                    if (!tg->playing) {
-                        foundgen = true;
-                        break;
-                    }
+            /* try for any free tone generator */
+            for (tgnum = 0; tgnum < num_tonegens; ++tgnum) {
+                tg = &tonegen[tgnum];
+                if (!tg->playing) {
+                    foundgen = true;
+                    break;
                 }
+            }
             if (foundgen) {
                 if (tgnum + 1 > num_tonegens_used) {
                     num_tonegens_used = tgnum + 1;
                 }
-                tg->playing = true;
-                tg->track = tracknum;
-                tg->note = trk->note;
-                trk->tonegens[tgnum] = true;
-                trk->preferred_tonegen = tgnum;
-                if (tg->instrument != midi_chan_instrument[trk->chan]) {    /* new instrument for this generator */
-                    tg->instrument = midi_chan_instrument[trk->chan];
-                }
-                tg->playIndex = tsf_note_on/*_fast*/(g_tsf, tg->instrument, tg->note, trk->velocity / 127.0f);  // velocity = 0...127
             } else {
+                /* all busy, so fade out the quietest held note rather than drop this one */
+                int instrument = -1;
+                int note = tsf_note_steal(g_tsf, &instrument);
+                tg = nullptr;
+                for (tgnum = 0; tgnum < num_tonegens; ++tgnum) {
+                    if (tonegen[tgnum].instrument == instrument && tonegen[tgnum].note == note) {
+                        tg = &tonegen[tgnum];
+                        break;
+                    }
+                }
+                if (!tg) {
+                    /* none of the held notes is still sounding, so release the longest held */
+                    tg = &tonegen[0];
+                    for (tgnum = 1; tgnum < num_tonegens; ++tgnum) {
+                        if (tonegen[tgnum].started < tg->started) {
+                            tg = &tonegen[tgnum];
+                        }
+                    }
+                    tsf_note_off(g_tsf, tg->instrument, tg->note);
+                }
+                ++voices_stolen;
+            }
+            tg->playing = true;
+            tg->track = tracknum;
+            tg->note = ev->note;
+            tg->instrument = ev->instrument;
+            tg->started = playnow;
+            tg->playIndex = tsf_note_on/*_fast*/(g_tsf, tg->instrument, tg->note, ev->velocity / 127.0f);  // velocity = 0...127
+            if (!tg->playIndex) {
+                tg->playing = false;
                 ++notes_skipped;
             }
-            find_note(tracknum);      // use up the note
         }
-    } while (tracks_done < num_tracks);
+
+        if (events) {
+            nextEvent++;
+        } else {
+            havePending = false;
+        }
+    }
     return -1; // EOF
 }
 
 
+// Called by the sender.  Only it moves the head, and only loop() the tail, so neither needs a lock
+bool AudioGeneratorMIDI::QueueEvent(uint8_t status, uint8_t data1, uint8_t data2, uint32_t when) {
+    uint32_t head = liveHead.load(std::memory_order_relaxed);
+    if (head - liveTail.load(std::memory_order_acquire) >= LIVE_EVENTS) {
+        return false;   /* full, loop() isn't keeping up */
+    }
+    struct live_event *ev = &liveQueue[head & (LIVE_EVENTS - 1)];
+    ev->sample = when;
+    ev->status = status;
+    ev->data1 = data1;
+    ev->data2 = data2;
+    liveHead.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+// Applies the live events that are due, then returns how many samples to render before the next one
+int AudioGeneratorMIDI::PlayLive() {
+    uint32_t tail = liveTail.load(std::memory_order_relaxed);
+    int samples = blockSize;
+
+    // Sort what's been sent in with what's waiting, so an event timed later can't hold up one sent after it
+    while ((numLivePending < LIVE_EVENTS) && (tail != liveHead.load(std::memory_order_acquire))) {
+        struct live_event ev = liveQueue[tail & (LIVE_EVENTS - 1)];
+        liveTail.store(++tail, std::memory_order_release);
+        if (!ev.sample || ((int32_t)(ev.sample - (uint32_t)playnow) < 0)) {
+            ev.sample = (uint32_t)playnow;  /* right away */
+        }
+        int i = numLivePending++;
+        while (i && ((int32_t)(livePending[i - 1].sample - ev.sample) > 0)) {
+            livePending[i] = livePending[i - 1];
+            i--;
+        }
+        livePending[i] = ev;
+    }
+
+    int due = 0;
+    while (due < numLivePending) {
+        struct live_event *ev = &livePending[due];
+        int32_t until = (int32_t)(ev->sample - (uint32_t)playnow);
+        if (until > 0) {
+            if (until < samples) {
+                samples = until;    /* stop the block right where it starts */
+            }
+            break;
+        }
+
+        int chan = ev->status & 0x0f;
+        switch (ev->status >> 4) {
+        case 0x8:
+            tsf_channel_note_off(g_tsf, chan, ev->data1);
+            break;
+        case 0x9:
+            if (!tsf_channel_note_on(g_tsf, chan, ev->data1, ev->data2 / 127.0f)) {
+                ++notes_skipped;
+            }
+            break;
+        case 0xb:
+            tsf_channel_midi_control(g_tsf, chan, ev->data1, ev->data2);
+            break;
+        case 0xc:
+            tsf_channel_set_presetnumber(g_tsf, chan, ev->data1, chan == 9);
+            break;
+        case 0xe:
+            tsf_channel_set_pitchwheel(g_tsf, chan, ev->data1 | (ev->data2 << 7));
+            break;
+        }
+        due++;
+    }
+    if (due) {
+        numLivePending -= due;
+        memmove(livePending, livePending + due, numLivePending * sizeof(livePending[0]));
+    }
+    playnow += samples;
+    return samples;
+}
+
+
 void AudioGeneratorMIDI::StopMIDI() {
 
-    file->close();
+    free(events);
+    events = nullptr;
+    if (live) {
+        tsf_reset(g_tsf);       /* drop the channels, so they don't color a file played next */
+        live = false;
+    } else {
+        file->close();
+    }
+#ifdef TSF_STREAMED
+    if (sf2 && g_tsf) {
+        tsf_sample_cache_stats(g_tsf, &cacheHits, &cacheMisses);
+    }
+#endif
     tsf_close(g_tsf);
+    g_tsf = nullptr;            /* a streamed SoundFont is gone now, so don't close it twice */
+}
+
+
+// Moves the synth's voice cap to keep rendering inside the CPU budget, and reports any notes lost
+void AudioGeneratorMIDI::UpdateVoiceCap(uint32_t us, int samples) {
+    int stolen = tsf_stolen_voice_count(g_tsf);
+    voices_stolen += stolen - tsfStolen;
+    tsfStolen = stolen;
+
+    // Single blocks can be a handful of samples, too short to time, so judge the load every 50ms or so
+    renderUs += us;
+    renderSamples += samples;
+    if (renderSamples < freq / 20) {
+        return;
+    }
+    if (cpuBudget) {
+        int load = (int)((uint64_t)renderUs * freq / 10000 / renderSamples);   /* percent of real time */
+        int sounding = tsf_active_voice_count(g_tsf);
+        if (load > cpuBudget && sounding > MIN_VOICES) {
+            // Cut straight to the number of voices the budget would have covered
+            voiceCap = sounding * cpuBudget / load;
+            if (voiceCap < MIN_VOICES) {
+                voiceCap = MIN_VOICES;
+            }
+        } else if (voiceCap && (load < cpuBudget * 3 / 4) && (!maxVoices || voiceCap < maxVoices)) {
+            // Comfortably under, so let voices back in slowly
+            voiceCap++;
+        }
+        tsf_set_voice_cap(g_tsf, voiceCap);
+    }
+    renderUs = 0;
+    renderSamples = 0;
+
+    if ((notes_skipped != reportedSkipped) || (voices_stolen != reportedStolen) || (voiceCap != reportedCap)) {
+        char buff[64];
+        sprintf_P(buff, PSTR("Voice cap %d, %d notes skipped, %d voices stolen"), voiceCap, notes_skipped, voices_stolen);
+        cb.st(STATUS_VOICES, buff);
+        reportedSkipped = notes_skipped;
+        reportedStolen = voices_stolen;
+        reportedCap = voiceCap;
+    }
+}
+
+
+#ifdef TSF_STREAMED
+// tsf_stream callbacks for a SoundFont read from an AudioFileSource
+static int afs_read(void *data, void *ptr, unsigned int size) {
+    AudioFileSource *src = (AudioFileSource *)data;
+    unsigned int got = 0;
+    while (got < size) {
+        uint32_t r = src->read((uint8_t *)ptr + got, size - got);
+        if (!r) {
+            break;
+        }
+        got += r;
+    }
+    return got;
+}
+
+static int afs_skip(void *data, unsigned int count) {
+    return ((AudioFileSource *)data)->seek(count, SEEK_CUR) ? 1 : 0;
+}
+
+static int afs_seek(void *data, unsigned int pos) {
+    return ((AudioFileSource *)data)->seek(pos, SEEK_SET) ? 1 : 0;
+}
+#endif
+
+
+bool AudioGeneratorMIDI::OpenSoundFont() {
+#ifdef TSF_STREAMED
+    if (sf2) {
+        struct tsf_stream stream = { sf2, afs_read, afs_skip, afs_seek };
+        sf2->seek(0, SEEK_SET);
+        g_tsf = tsf_load_streamed(&stream, sf2CacheBytes);
+        if (!g_tsf) {
+            cb.st(STATUS_SOUNDFONT, PSTR("Unable to load SoundFont"));
+            return false;
+        }
+    } else
+#endif
+    {
+        g_tsf = _tsf;
+    }
+    tsf_set_output(g_tsf, TSF_STEREO_INTERLEAVED, freq, -10 /* dB gain -10 */);
+    return true;
 }
 
 
@@ -498,13 +797,10 @@ bool AudioGeneratorMIDI::begin(AudioFileSource *src, AudioOutput *out) {
     for (int i = 0; i < MAX_TONEGENS; i++) {
         memset(&tonegen[i], 0, sizeof(struct tonegen_status));
     }
-    for (int i = 0; i < MAX_TRACKS; i++) {
-        memset(&track[i], 0, sizeof(struct track_status));
-    }
-    memset(midi_chan_instrument, 0, sizeof(midi_chan_instrument));
 
-    g_tsf = _tsf;
-    tsf_set_output(g_tsf, TSF_STEREO_INTERLEAVED, freq, -10 /* dB gain -10 */);
+    if (!OpenSoundFont()) {
+        return false;
+    }
 
     if (!out->SetRate(freq)) {
         return false;
@@ -520,11 +816,21 @@ bool AudioGeneratorMIDI::begin(AudioFileSource *src, AudioOutput *out) {
 
     output = out;
     file = src;
+    live = false;
 
     running = true;
 
     PrepareMIDI();//src);
 
+    voiceCap = maxVoices;
+    tsf_set_voice_cap(g_tsf, voiceCap);
+    tsfStolen = tsf_stolen_voice_count(g_tsf);
+    renderUs = 0;
+    renderSamples = 0;
+    reportedSkipped = 0;
+    reportedStolen = 0;
+    reportedCap = voiceCap;
+
     samplesToPlay = 0;
     numSamplesRendered = 0;
     sentSamplesRendered = 0;
@@ -534,13 +840,61 @@ bool AudioGeneratorMIDI::begin(AudioFileSource *src, AudioOutput *out) {
 }
 
 
+bool AudioGeneratorMIDI::beginLive(AudioOutput *out) {
+    if (!out->SetRate(freq) || !out->SetChannels(2) || !out->begin()) {
+        return false;
+    }
+
+    if (!OpenSoundFont()) {
+        return false;
+    }
+
+    // General MIDI: every channel starts on the first program, and channel 10 plays drums
+    for (int chan = 15; chan >= 0; chan--) {
+        tsf_channel_set_presetnumber(g_tsf, chan, 0, chan == 9);
+    }
+
+    output = out;
+    file = nullptr;
+    live = true;
+    running = true;
+
+    free(events);
+    events = nullptr;
+    playnow = 0;
+    notes_skipped = 0;
+    voices_stolen = 0;
+    liveTail.store(liveHead.load(std::memory_order_acquire), std::memory_order_release);   /* anything sent while stopped is stale */
+    numLivePending = 0;
+
+    voiceCap = maxVoices;
+    tsf_set_voice_cap(g_tsf, voiceCap);
+    tsfStolen = tsf_stolen_voice_count(g_tsf);
+    renderUs = 0;
+    renderSamples = 0;
+    reportedSkipped = 0;
+    reportedStolen = 0;
+    reportedCap = voiceCap;
+
+    samplesToPlay = 0;
+    numSamplesRendered = 0;
+    sentSamplesRendered = 0;
+
+    sawEOF = false;
+    return true;
+}
+
+
 bool AudioGeneratorMIDI::loop() {
     if (!running) {
-        file->loop();
+        if (file) {
+            file->loop();
+        }
         output->loop();
         return running;
     }
 
+    bool rendered = false;
     do {
 #ifdef ESP8266
         static int c = 0;
@@ -559,17 +913,25 @@ bool AudioGeneratorMIDI::loop() {
                 break;
             }
         } else if (samplesToPlay) {
-            numSamplesRendered = (sizeof(samplesRendered) / sizeof(samplesRendered[0])) / 4;
-            if ((int)samplesToPlay < (int)(sizeof(samplesRendered) / sizeof(samplesRendered[0])) / 4) {
+            numSamplesRendered = blockSize;
+            if (samplesToPlay < blockSize) {
                 numSamplesRendered = samplesToPlay;
             }
+            uint32_t start = micros();
             tsf_render_short_2x(g_tsf, samplesRendered, numSamplesRendered, 0);
+            UpdateVoiceCap(micros() - start, numSamplesRendered);
             samplesToPlay -= numSamplesRendered;
             sentSamplesRendered = 0;
         } else {
             numSamplesRendered = 0;
             sentSamplesRendered = 0;
-            if (sawEOF) {
+            if (live) {
+                if (rendered) {
+                    break;          /* back to the caller between blocks, to send more events */
+                }
+                samplesToPlay = PlayLive();
+                rendered = true;
+            } else if (sawEOF) {
                 running = false;
             } else {
                 samplesToPlay = PlayMIDI();
@@ -581,7 +943,9 @@ bool AudioGeneratorMIDI::loop() {
         }
     } while (running);
 
-    file->loop();
+    if (file) {
+        file->loop();
+    }
     output->loop();
 
     return running;
@@ -25,11 +25,17 @@
 // Do not build, Espressif's GCC8+ has a compiler bug
 #else // __GNUC__ == 8
 
+#include <atomic>
 #include "AudioGenerator.h"
 
 #define TSF_NO_STDIO
 #define TSF_CONST_FILE
 #define TSF_SAMPLES_SHORT
+// Playing a SF2 file from an AudioFileSource needs the SF2 parser and RAM for its presets, more than an
+// ESP8266 can spare, so it's only built there when TSF_STREAMED is given in the build flags
+#if !defined(ESP8266) && !defined(TSF_STREAMED)
+#define TSF_STREAMED
+#endif
 #include "libtinysoundfont/tsf.h"
 
 class AudioGeneratorMIDI : public AudioGenerator {
@@ -37,15 +43,38 @@ public:
     AudioGeneratorMIDI() {
         freq = 22050;
         running = false;
+        events = nullptr;
+#ifdef ESP8266
+        maxEventBytes = 16 * 1024;
+#else
+        maxEventBytes = 256 * 1024;
+#endif
+        cpuBudget = 80;
+        maxVoices = 64;
+#ifdef TSF_STREAMED
+        sf2 = nullptr;
+        sf2CacheBytes = 0;
+        cacheHits = 0;
+        cacheMisses = 0;
+#endif
+        blockSize = MAX_BLOCK;
+        live = false;
+        liveHead = 0;
+        liveTail = 0;
+        numLivePending = 0;
     };
-    virtual ~AudioGeneratorMIDI() override {};
-#if 0
-    bool SetSoundfont(AudioFileSource *newsf2) {
+    virtual ~AudioGeneratorMIDI() override {
+        free(events);
+    };
+#ifdef TSF_STREAMED
+    // Plays from a SF2 file (e.g. on an SD card), reading its presets when playback begins and its samples
+    // as they're needed.  Up to cacheBytes of samples are kept in RAM, the rest is read back as needed.
+    bool SetSoundFont(AudioFileSource *newsf2, uint32_t cacheBytes = 32 * 1024) {
         if (isRunning()) {
             return false;
         }
         sf2 = newsf2;
-        MakeStreamFromAFS(sf2, &afsSF2);
+        sf2CacheBytes = cacheBytes;
         return true;
     }
 #endif
@@ -54,6 +83,9 @@ public:
             return false;
         }
         _tsf = t;
+#ifdef TSF_STREAMED
+        sf2 = nullptr;
+#endif
         return true;
     }
     bool SetSampleRate(int newfreq) {
@@ -63,7 +95,91 @@ public:
         freq = newfreq;
         return true;
     }
+    // RAM the pre-parsed event list may use.  Larger scores (or 0) are merged from the file as they play
+    bool SetEventMemory(uint32_t bytes) {
+        if (isRunning()) {
+            return false;
+        }
+        maxEventBytes = bytes;
+        return true;
+    }
+    // Percent of real time rendering may take before the quietest voices are faded out to make room (0 to never)
+    bool SetCPUBudget(int percent) {
+        if (isRunning()) {
+            return false;
+        }
+        cpuBudget = percent;
+        return true;
+    }
+    // Most voices that may sound at once, however much CPU is left over (0 for no limit)
+    bool SetMaxVoices(int voices) {
+        if (isRunning()) {
+            return false;
+        }
+        maxVoices = voices;
+        return true;
+    }
+    // Most samples rendered at once, and so the longest a live event can wait.  Smaller blocks cut latency
+    // but cost more overhead per sample
+    bool SetBlockSize(int samples) {
+        if (isRunning() || (samples < 1) || (samples > MAX_BLOCK)) {
+            return false;
+        }
+        blockSize = samples;
+        return true;
+    }
+    // Playback statistics, also sent to the status callback as STATUS_VOICES when they change
+    int NotesSkipped() {
+        return notes_skipped;
+    }
+    int VoicesStolen() {
+        return voices_stolen;
+    }
+    int VoiceCap() {
+        return voiceCap;
+    }
+#ifdef TSF_STREAMED
+    // Sample cache statistics for a SF2 played from a file (the last playback's, once stopped)
+    bool SoundFontCacheStats(uint32_t *hits, uint32_t *misses) {
+        if (!sf2) {
+            return false;
+        }
+        if (running) {
+            tsf_sample_cache_stats(g_tsf, &cacheHits, &cacheMisses);
+        }
+        *hits = cacheHits;
+        *misses = cacheMisses;
+        return true;
+    }
+#endif
+    enum { STATUS_VOICES = 2, STATUS_SOUNDFONT };
+
     virtual bool begin(AudioFileSource *mid, AudioOutput *output) override;
+    // Plays events sent by NoteOn() and friends instead of a file, until stopped.  They are queued without
+    // locks, so may come from another task or core than loop(), but only from one at a time.  "when" is the
+    // sample to apply them at, counted as SampleTime(); 0, or a time already rendered, means right away.
+    // They're applied in time order, not the order sent, with ties in the order sent.
+    bool beginLive(AudioOutput *output);
+    bool NoteOn(uint8_t channel, uint8_t note, uint8_t velocity, uint32_t when = 0) {
+        return QueueEvent(0x90 | (channel & 0x0f), note & 0x7f, velocity & 0x7f, when);
+    }
+    bool NoteOff(uint8_t channel, uint8_t note, uint32_t when = 0) {
+        return QueueEvent(0x80 | (channel & 0x0f), note & 0x7f, 0, when);
+    }
+    bool ProgramChange(uint8_t channel, uint8_t program, uint32_t when = 0) {
+        return QueueEvent(0xc0 | (channel & 0x0f), program & 0x7f, 0, when);
+    }
+    bool ControlChange(uint8_t channel, uint8_t controller, uint8_t value, uint32_t when = 0) {
+        return QueueEvent(0xb0 | (channel & 0x0f), controller & 0x7f, value & 0x7f, when);
+    }
+    // 0...16383, 8192 is centered
+    bool PitchBend(uint8_t channel, uint16_t value, uint32_t when = 0) {
+        return QueueEvent(0xe0 | (channel & 0x0f), value & 0x7f, (value >> 7) & 0x7f, when);
+    }
+    // Samples rendered so far, the clock live events are timed by
+    uint32_t SampleTime() {
+        return playnow;
+    }
     virtual bool loop() override;
     virtual bool stop() override;
     virtual bool isRunning() override {
@@ -90,29 +206,37 @@ protected:
     };
 
     enum { MAX_TONEGENS = 32,         /* max tone generators: tones we can play simultaneously */
-           MAX_TRACKS = 24
-         };         /* max number of MIDI tracks we will process */
+           MAX_TRACKS = 24,           /* max number of MIDI tracks we will process */
+           MIN_VOICES = 4,            /* the CPU budget never caps voices below this */
+           MAX_BLOCK = 256,           /* most samples rendered at once, as fits in samplesRendered */
+           LIVE_EVENTS = 64           /* live event queue depth, a power of two */
+         };
 
     int hdrptr;
     unsigned long buflen;
     int num_tracks;
+    int firsthdr;
     int tracks_done = 0;
     int num_tonegens = MAX_TONEGENS;
     int num_tonegens_used = 0;
     unsigned int ticks_per_beat = 240;
     unsigned long timenow = 0;
     unsigned long tempo;            /* current tempo in usec/qnote */
+    unsigned long samplenow;        /* timenow in output samples */
     // State needed for PlayMID()
     int notes_skipped = 0;
+    int voices_stolen = 0;          /* voices faded or notes released early to play new notes */
     int tracknum = 0;
     int earliest_tracknum = 0;
     unsigned long earliest_time = 0;
+    bool stopping;                  /* merging a run of STOPNOTEs from one track */
 
     struct tonegen_status {         /* current status of a tone generator */
         bool playing;                 /* is it playing? */
         char track;                   /* if so, which track is the note from? */
         char note;                    /* what note is playing? */
         char instrument;              /* what instrument? */
+        unsigned long started;        /* when it started, in samples */
         int playIndex;                /* is index provided?
                                        Unique identifier generated when note starts playing.
                                        This help us to turn the note off faster */
@@ -123,15 +247,25 @@ protected:
         int trkend;                  /* ptr past the end of the track */
         unsigned long time;          /* what time we're at in the score */
         unsigned long tempo;         /* the tempo last set, in usec per qnote */
-        unsigned int preferred_tonegen;      /* for strategy2, try to use this generator */
         unsigned char cmd;           /* CMD_xxxx next to do */
         unsigned char note;          /* for which note */
         unsigned char chan;          /* from which channel it was */
         unsigned char velocity;      /* the current volume */
         unsigned char last_event;    /* the last event, for MIDI's "running status" */
-        bool tonegens[MAX_TONEGENS]; /* which tone generators our notes are playing on */
+        int winptr;                  /* file offset of window[0] */
+        int winlen;                  /* valid bytes in window, 0 if empty */
+        unsigned char window[32];    /* read-ahead of the track data */
     } track[MAX_TRACKS];
 
+    struct midi_event {             /* one merged note change, in playback order */
+        uint32_t sample;              /* when to play it, in samples from the start */
+        uint8_t track;                /* which track, plus EVENT_NOTEON for a note on */
+        uint8_t note;                 /* which note */
+        uint8_t velocity;             /* note on volume */
+        uint8_t instrument;           /* note on instrument */
+    };
+    enum { EVENT_NOTEON = 0x80 };
+
     int midi_chan_instrument[16];   /* which instrument is currently being played on each channel */
 
     /* output bytestream commands, which are also stored in track_status.cmd */
@@ -165,9 +299,7 @@ protected:
         return 1;
     }
 
-    unsigned char buffer_byte(int offset);
-    unsigned short buffer_short(int offset);
-    unsigned int buffer_int32(int offset);
+    unsigned char track_byte(struct track_status *t, int offset);
 
     void midi_error(const char *msg, int curpos);
     void chk_bufdata(int ptr, unsigned long int len);
@@ -176,19 +308,64 @@ protected:
     void process_header(void);
     void start_track(int tracknum);
 
-    unsigned long get_varlen(int *ptr);
+    unsigned long get_varlen(struct track_status *t);
     void find_note(int tracknum);
+    void RewindMIDI();
+    bool NextEvent(struct midi_event *ev);
+    struct midi_event *PeekEvent();
     void PrepareMIDI();//AudioFileSource *src);
     int PlayMIDI();
+    bool OpenSoundFont();
     void StopMIDI();
+    void UpdateVoiceCap(uint32_t us, int samples);
+    bool QueueEvent(uint8_t status, uint8_t data1, uint8_t data2, uint32_t when);
+    int PlayLive();
 
     int samplesToPlay;
     bool sawEOF;
     int numSamplesRendered;
     int sentSamplesRendered ;
-    short samplesRendered[256 * 2 * 2];
+    short samplesRendered[MAX_BLOCK * 2 * 2];
+    int blockSize;
+
+    const uint8_t *mem;             /* whole file, when the source can be read in place */
+    struct midi_event *events;      /* pre-parsed score, or NULL to merge tracks while playing */
+    uint32_t maxEventBytes;
+    int numEvents;
+    int nextEvent;
+    struct midi_event pending;      /* next event when merging while playing */
+    bool havePending;
+    unsigned long playnow;          /* samples handed to the renderer so far */
+
+    struct live_event {             /* one queued live MIDI message */
+        uint32_t sample;              /* when to apply it, or 0 for right away */
+        uint8_t status;               /* MIDI command and channel */
+        uint8_t data1;
+        uint8_t data2;
+    } liveQueue[LIVE_EVENTS];
+    std::atomic<uint32_t> liveHead; /* events queued, only written by the sender */
+    std::atomic<uint32_t> liveTail; /* events taken off the queue, only written by loop() */
+    struct live_event livePending[LIVE_EVENTS];   /* taken off the queue but not yet due, in time order */
+    int numLivePending;
+    bool live;                      /* playing the queue instead of a file */
+
+    int cpuBudget;                  /* percent of real time allowed for rendering, 0 to not limit */
+    int maxVoices;                  /* upper limit for voiceCap, 0 for none */
+    int voiceCap;                   /* voices currently allowed by the CPU budget, 0 for no cap */
+    uint32_t renderUs;              /* time spent rendering since the last voice cap update */
+    int renderSamples;              /* ...and the samples that produced */
+    int tsfStolen;                  /* voices the synth has already faded for us, of voices_stolen */
+    int reportedSkipped;            /* last counts given to the status callback */
+    int reportedStolen;
+    int reportedCap;
 
     tsf *_tsf = nullptr;
+#ifdef TSF_STREAMED
+    AudioFileSource *sf2;           /* streamed SoundFont, used instead of _tsf when set */
+    uint32_t sf2CacheBytes;
+    unsigned int cacheHits;
+    unsigned int cacheMisses;
+#endif
 };
 
 #endif //__GNUC__ == 8
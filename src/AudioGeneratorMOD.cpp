@@ -1,6 +1,6 @@
 /*
     AudioGeneratorMOD
-    Audio output generator that plays Amiga MOD tracker files
+    Audio output generator that plays Amiga MOD, FastTracker 2 XM and Scream Tracker 3 S3M tracker files
 
     Copyright (C) 2017  Earle F. Philhower, III
 
@@ -35,7 +35,7 @@
 
 #pragma GCC optimize ("O3")
 
-#define NOTE(r, c) (Player.currentPattern.note8[r][c]==NONOTE8?NONOTE:8*Player.currentPattern.note8[r][c])
+#define NOTE(c) (Player.currentRow[c].note==NONOTE8?NONOTE:8*Player.currentRow[c].note)
 
 #ifndef min
 #define min(X,Y) ((X) < (Y) ? (X) : (Y))
@@ -51,21 +51,51 @@ AudioGeneratorMOD::AudioGeneratorMOD() {
     running = false;
     file = NULL;
     output = NULL;
+    FatBuffer.memory = NULL;
+    FatBuffer.count = 0;
+    FatBuffer.hits = 0;
+    FatBuffer.misses = 0;
+    Mod.samples = NULL;
+    Mod.instruments = NULL;
+    Mod.checkpoints = NULL;
+    Mod.patternOffset = NULL;
+    Mod.patternSize = NULL;
+    Mod.patternRows = NULL;
+    mem = NULL;
+    preloaded = NULL;
+    memSize = 0;
+    preload = false;
 }
 
 AudioGeneratorMOD::~AudioGeneratorMOD() {
-    // Free any remaining buffers
-    for (int i = 0; i < CHANNELS; i++) {
-        FatBuffer.channels[i] = NULL;
-    }
+    // The file and output may already be gone, so only free what's ours
+    FreeBuffers();
+}
+
+void AudioGeneratorMOD::FreeBuffers() {
+    free(FatBuffer.memory);
+    FatBuffer.memory = NULL;
+    FatBuffer.count = 0;
+    free(Mod.samples);
+    Mod.samples = NULL;
+    free(Mod.instruments);
+    Mod.instruments = NULL;
+    free(Mod.checkpoints);
+    Mod.checkpoints = NULL;
+    free(Mod.patternOffset);
+    Mod.patternOffset = NULL;
+    free(Mod.patternSize);
+    Mod.patternSize = NULL;
+    free(Mod.patternRows);
+    Mod.patternRows = NULL;
+    free(preloaded);
+    preloaded = NULL;
+    mem = NULL;
 }
 
 bool AudioGeneratorMOD::stop() {
     // We may be stopping because of allocation failures, so always deallocate
-    for (int i = 0; i < CHANNELS; i++) {
-        free(FatBuffer.channels[i]);
-        FatBuffer.channels[i] = NULL;
-    }
+    FreeBuffers();
 
     if (running || ((file != NULL) && (file->isOpen() == true))) {
         output->flush();  //flush I2S output buffer, if the player was actually running before.
@@ -84,30 +114,40 @@ bool AudioGeneratorMOD::loop() {
         goto done;    // Easy-peasy
     }
 
-    // First, try and push in the stored sample.  If we can't, then punt and try later
-    if (!output->ConsumeSample(lastSample)) {
-        goto done;    // FIFO full, wait...
-    }
-
-    // Now advance enough times to fill the i2s buffer
     do {
-        if (mixerTick == 0) {
-            running = RunPlayer();
-            if (!running) {
-                stop();
+        if (blockSent < blockFrames) {
+            // Push what's left of the last block.  If it doesn't all fit, then punt and try later
+            uint16_t toSend = blockFrames - blockSent;
+            uint16_t sent = output->ConsumeSamples(block + blockSent * 2, toSend);
+            blockSent += sent;
+            if (sent != toSend) {
+                break;    // FIFO full, wait...
+            }
+        } else {
+            if (mixerTick == 0) {
+                running = RunPlayer();
+                if (!running) {
+                    stop();
+                    goto done;
+                }
+                mixerTick = Player.samplesPerTick;
+            }
+            // Blocks never span a tick, so the player can't change anything partway through one
+            uint16_t frames = min(mixerTick, (int)BLOCK);
+            if (!RenderBlock(frames)) {
                 goto done;
             }
-            mixerTick = Player.samplesPerTick;
+            mixerTick -= frames;
+            blockFrames = frames;
+            blockSent = 0;
         }
-        GetSample(lastSample);
-        mixerTick--;
-    } while (output->ConsumeSample(lastSample));
+    } while (running);
 
 done:
     file->loop();
     output->loop();
 
-    // We'll be left with one sample still in our buffer because it couldn't fit in the FIFO
+    // We may be left with part of a block still to send because it couldn't fit in the FIFO
     return running;
 }
 
@@ -141,15 +181,15 @@ bool AudioGeneratorMOD::begin(AudioFileSource *source, AudioOutput *out) {
     }
 
     UpdateAmiga();
+    mixerTick = 0;
+    blockFrames = 0;
+    blockSent = 0;
 
-    for (int i = 0; i < CHANNELS; i++) {
-        FatBuffer.channels[i] = reinterpret_cast<uint8_t*>(calloc(fatBufferSize, 1));
-        if (!FatBuffer.channels[i]) {
-            stop();
-            return false;
-        }
+    if (!LoadModule()) {
+        stop();
+        return false;
     }
-    if (!LoadMOD()) {
+    if (!LoadMOD() || !AllocateSlots() || !BuildCheckpoints()) {
         stop();
         return false;
     }
@@ -212,11 +252,47 @@ static inline uint16_t MakeWord(uint8_t h, uint8_t l) {
     return h << 8 | l;
 }
 
+// Plays straight from memory when the source already holds the whole module, or when asked to preload it and
+// there's room.  Otherwise patterns and samples are read from the file as they're needed.
+bool AudioGeneratorMOD::LoadModule() {
+    uint32_t avail;
+    const uint8_t *p = file->peek(&avail);
+
+    mem = NULL;
+    preloaded = NULL;
+    memSize = 0;
+    if (p && (file->getPos() == 0) && (avail == file->getSize())) {
+        mem = p;
+        memSize = avail;
+    } else if (preload && file->getSize()) {
+        uint32_t size = file->getSize();
+        preloaded = reinterpret_cast<uint8_t*>(malloc(size));
+        if (preloaded) {
+            if (!file->seek(0, SEEK_SET) || (size != file->read(preloaded, size)) || !file->seek(0, SEEK_SET)) {
+                free(preloaded);
+                preloaded = NULL;
+                return file->seek(0, SEEK_SET);
+            }
+            mem = preloaded;
+            memSize = size;
+        } else {
+            audioLogger->printf_P(PSTR("AudioGeneratorMOD: unable to preload %u bytes, streaming instead\n"), size);
+        }
+    }
+    return true;
+}
+
 bool AudioGeneratorMOD::LoadHeader() {
     uint8_t i;
     uint8_t temp[4];
     uint8_t junk[22];
 
+    Mod.numberOfSamples = SAMPLES;
+    Mod.samples = reinterpret_cast<Sample*>(calloc(SAMPLES, sizeof(Sample)));
+    if (!Mod.samples) {
+        return false;
+    }
+
     if (20 != file->read(/*Mod.name*/junk, 20)) {
         return false;    // Skip MOD name
     }
@@ -250,9 +326,10 @@ bool AudioGeneratorMOD::LoadHeader() {
         }
     }
 
-    if (1 != file->read(&Mod.songLength, 1)) {
+    if (1 != file->read(temp, 1)) {
         return false;
     }
+    Mod.songLength = temp[0];
     if (1 != file->read(temp, 1)) {
         return false;    // Discard this byte
     }
@@ -295,16 +372,10 @@ void AudioGeneratorMOD::LoadSamples() {
     for (i = 0; i < SAMPLES; i++) {
 
         if (Mod.samples[i].length) {
-            Mixer.sampleBegin[i] = fileOffset;
-            Mixer.sampleEnd[i] = fileOffset + Mod.samples[i].length;
-            if (Mod.samples[i].loopLength > 2) {
-                Mixer.sampleloopBegin[i] = fileOffset + Mod.samples[i].loopBegin;
-                Mixer.sampleLoopLength[i] = Mod.samples[i].loopLength;
-                Mixer.sampleLoopEnd[i] = Mixer.sampleloopBegin[i] + Mixer.sampleLoopLength[i];
-            } else {
-                Mixer.sampleloopBegin[i] = 0;
-                Mixer.sampleLoopLength[i] = 0;
-                Mixer.sampleLoopEnd[i] = 0;
+            Mod.samples[i].offset = fileOffset;
+            if (Mod.samples[i].loopLength <= 2) {
+                Mod.samples[i].loopBegin = 0;
+                Mod.samples[i].loopLength = 0;
             }
             fileOffset += Mod.samples[i].length;
         }
@@ -313,38 +384,64 @@ void AudioGeneratorMOD::LoadSamples() {
 
 }
 
-bool AudioGeneratorMOD::LoadPattern(uint8_t pattern) {
-    uint8_t row;
+// Returns len bytes of pattern data starting at the file offset given, straight from memory or read through
+// patternBuffer, which then holds the rows which follow too.  Bytes past the end of the file read as 0.
+const uint8_t *AudioGeneratorMOD::PatternData(uint32_t offset, uint32_t len) {
+    if (mem && (offset + len <= memSize)) {
+        return mem + offset;
+    }
+    if (offset < patternBufferStart || offset + len > patternBufferStart + patternBufferLength) {
+        uint32_t got = 0;
+        if (mem) {
+            if (offset < memSize) {
+                got = min(memSize - offset, (uint32_t)sizeof(patternBuffer));
+                memcpy(patternBuffer, mem + offset, got);
+            }
+        } else if (file->seek(offset, SEEK_SET)) {
+            got = file->read(patternBuffer, sizeof(patternBuffer));
+        }
+        if (!got) {
+            return NULL;
+        }
+        memset(patternBuffer + got, 0, sizeof(patternBuffer) - got);
+        patternBufferStart = offset;
+        patternBufferLength = sizeof(patternBuffer);
+    }
+    return patternBuffer + offset - patternBufferStart;
+}
+
+// Decodes the row about to play into Player.currentRow, so a whole pattern never needs to be held
+bool AudioGeneratorMOD::LoadRow() {
     uint8_t channel;
     uint8_t i;
-    uint8_t temp[4];
     uint16_t amigaPeriod;
+    uint8_t pattern = Mod.order[Player.orderIndex];
 
-    if (!file->seek(1084 + pattern * ROWS * Mod.numberOfChannels * 4, SEEK_SET)) {
-        return false;
+    if (Mod.format != FORMAT_MOD) {
+        return DecodeTrackerRow(pattern, Player.row);
     }
 
-    for (row = 0; row < ROWS; row++) {
-        for (channel = 0; channel < Mod.numberOfChannels; channel++) {
+    const uint8_t *cell = PatternData(1084 + (pattern * ROWS + Player.row) * Mod.numberOfChannels * 4, Mod.numberOfChannels * 4);
+    if (!cell) {
+        return false;
+    }
 
-            if (4 != file->read(temp, 4)) {
-                return false;
-            }
+    for (channel = 0; channel < Mod.numberOfChannels; channel++, cell += 4) {
 
-            Player.currentPattern.sampleNumber[row][channel] = (temp[0] & 0xF0) + (temp[2] >> 4);
+        Player.currentRow[channel].sampleNumber = (cell[0] & 0xF0) + (cell[2] >> 4);
 
-            amigaPeriod = ((temp[0] & 0xF) << 8) + temp[1];
-            //   Player.currentPattern.note[row][channel] = NONOTE;
-            Player.currentPattern.note8[row][channel] = NONOTE8;
-            for (i = 1; i < 37; i++)
-                if (amigaPeriod > ReadAmigaPeriods(i * 8) - 3 &&
-                        amigaPeriod < ReadAmigaPeriods(i * 8) + 3) {
-                    Player.currentPattern.note8[row][channel] = i;
-                }
+        amigaPeriod = ((cell[0] & 0xF) << 8) + cell[1];
+        //   Player.currentRow[channel].note = NONOTE;
+        Player.currentRow[channel].note = NONOTE8;
+        for (i = 1; i < 37; i++)
+            if (amigaPeriod > ReadAmigaPeriods(i * 8) - 3 &&
+                    amigaPeriod < ReadAmigaPeriods(i * 8) + 3) {
+                Player.currentRow[channel].note = i;
+            }
 
-            Player.currentPattern.effectNumber[row][channel] = temp[2] & 0xF;
-            Player.currentPattern.effectParameter[row][channel] = temp[3];
-        }
+        Player.currentRow[channel].volume = 0;
+        Player.currentRow[channel].effectNumber = cell[2] & 0xF;
+        Player.currentRow[channel].effectParameter = cell[3];
     }
 
     return true;
@@ -473,10 +570,10 @@ bool AudioGeneratorMOD::ProcessRow() {
     breakFlag = false;
     for (channel = 0; channel < Mod.numberOfChannels; channel++) {
 
-        sampleNumber = Player.currentPattern.sampleNumber[Player.lastRow][channel];
-        note = NOTE(Player.lastRow, channel);
-        effectNumber = Player.currentPattern.effectNumber[Player.lastRow][channel];
-        effectParameter = Player.currentPattern.effectParameter[Player.lastRow][channel];
+        sampleNumber = Player.currentRow[channel].sampleNumber;
+        note = NOTE(channel);
+        effectNumber = Player.currentRow[channel].effectNumber;
+        effectParameter = Player.currentRow[channel].effectParameter;
         effectParameterX = effectParameter >> 4;
         effectParameterY = effectParameter & 0xF;
         sampleOffset = 0;
@@ -697,11 +794,10 @@ bool AudioGeneratorMOD::ProcessTick() {
 
         if (Player.lastAmigaPeriod[channel]) {
 
-            sampleNumber = Player.currentPattern.sampleNumber[Player.lastRow][channel];
-            //   note = Player.currentPattern.note[Player.lastRow][channel];
-            note = NOTE(Player.lastRow, channel);
-            effectNumber = Player.currentPattern.effectNumber[Player.lastRow][channel];
-            effectParameter = Player.currentPattern.effectParameter[Player.lastRow][channel];
+            sampleNumber = Player.currentRow[channel].sampleNumber;
+            note = NOTE(channel);
+            effectNumber = Player.currentRow[channel].effectNumber;
+            effectParameter = Player.currentRow[channel].effectParameter;
             effectParameterX = effectParameter >> 4;
             effectParameterY = effectParameter & 0xF;
 
@@ -827,6 +923,8 @@ bool AudioGeneratorMOD::ProcessTick() {
 }
 
 bool AudioGeneratorMOD::RunPlayer() {
+    uint8_t channel;
+
     if (!running) {
         return false;
     }
@@ -834,7 +932,9 @@ bool AudioGeneratorMOD::RunPlayer() {
     if (Player.tick == Player.speed) {
         Player.tick = 0;
 
-        if (Player.row == ROWS) {
+        uint8_t pattern = Mod.order[Player.orderIndex];
+        uint16_t rows = (Mod.patternRows && pattern < Mod.numberOfPatterns) ? Mod.patternRows[pattern] : ROWS;
+        if (Player.row >= rows) {
             Player.orderIndex++;
             if (Player.orderIndex == Mod.songLength) {
                 //Player.orderIndex = 0;
@@ -847,171 +947,453 @@ bool AudioGeneratorMOD::RunPlayer() {
         if (Player.patternDelay) {
             Player.patternDelay--;
         } else {
-            if (Player.orderIndex != Player.oldOrderIndex)
-                if (!LoadPattern(Mod.order[Player.orderIndex])) {
-                    return false;
-                }
-            Player.oldOrderIndex = Player.orderIndex;
-            if (!ProcessRow()) {
+            if (!LoadRow()) {
+                return false;
+            }
+            if (!(Mod.format == FORMAT_MOD ? ProcessRow() : ProcessTrackerRow())) {
                 return false;
             }
         }
 
     } else {
-        if (!ProcessTick()) {
+        if (!(Mod.format == FORMAT_MOD ? ProcessTick() : ProcessTrackerTick())) {
             return false;
         }
     }
     Player.tick++;
-    return true;
-}
-
-void AudioGeneratorMOD::GetSample(int16_t sample[2]) {
-    int32_t sumL;
-    int32_t sumR;
-    uint8_t channel;
-    uint32_t samplePointer;
-    int8_t current;
-    int8_t next;
-    int16_t out;
-    int32_t out32;
 
-    if (!running) {
-        return;
+    if (Mod.format == FORMAT_MOD) {
+        // Volume and panning only change here, so the mixer gets them as one gain per side
+        for (channel = 0; channel < Mod.numberOfChannels; channel++) {
+            Mixer.channelGainLeft[channel] = Mixer.channelVolume[channel] * min(128 - Mixer.channelPanning[channel], 64);
+            Mixer.channelGainRight[channel] = Mixer.channelVolume[channel] * min(Mixer.channelPanning[channel], 64);
+        }
+    } else {
+        UpdateVoices();
     }
 
-    sumL = 0;
-    sumR = 0;
+    // Only the channels playing something are mixed, so a 32 channel module costs what its busy channels do
+    Mixer.activeCount = 0;
     for (channel = 0; channel < Mod.numberOfChannels; channel++) {
-
-        if (!Mixer.channelFrequency[channel] ||
-                !Mod.samples[Mixer.channelSampleNumber[channel]].length) {
-            continue;
+        if (Mixer.channelFrequency[channel] && Mixer.channelSampleNumber[channel] < Mod.numberOfSamples &&
+                Mod.samples[Mixer.channelSampleNumber[channel]].length) {
+            Mixer.active[Mixer.activeCount++] = channel;
         }
+    }
+    return true;
+}
 
-        Mixer.channelSampleOffset[channel] += Mixer.channelFrequency[channel];
+// Gives each channel of the module a cache slot, unless every sample can be played from memory as it is.  Slots
+// come from one allocation, so they can go in PSRAM, and shrink to fit if fatBufferSize each won't.
+bool AudioGeneratorMOD::AllocateSlots() {
+    uint16_t i;
+    uint32_t size = fatBufferSize;
+
+    for (i = 0; i < CHANNELS; i++) {
+        FatBuffer.first[i] = 0;
+        FatBuffer.frames[i] = 0;
+        FatBuffer.sampleNumber[i] = NOSAMPLE;
+        FatBuffer.lastUsed[i] = 0;
+        FatBuffer.channelSlot[i] = i;
+    }
+    FatBuffer.useCount = 0;
+    FatBuffer.hits = 0;
+    FatBuffer.misses = 0;
+    FatBuffer.count = 0;
+
+    for (i = 0; mem && (i < Mod.numberOfSamples); i++) {
+        const Sample &s = Mod.samples[i];
+        if ((s.flags & (SAMPLE_DELTA | SAMPLE_UNSIGNED)) || ((s.flags & SAMPLE_16BIT) && ((uintptr_t)(mem + s.offset) & 1))) {
+            break;
+        }
+    }
+    if (mem && (i == Mod.numberOfSamples)) {
+        return true;
+    }
 
-        if (!Mixer.channelVolume[channel]) {
-            continue;
+    size = (size < 64) ? 64 : (size + 3) & ~3;
+    while (!(FatBuffer.memory = reinterpret_cast<uint8_t*>(malloc(size * Mod.numberOfChannels)))) {
+        if (size <= 1024) {
+            return false;
         }
+        size /= 2;
+    }
+    if (size != (uint32_t)fatBufferSize) {
+        audioLogger->printf_P(PSTR("AudioGeneratorMOD: using %u byte sample cache slots\n"), size);
+    }
+    FatBuffer.count = Mod.numberOfChannels;
+    FatBuffer.size = size;
+    for (i = 0; i < FatBuffer.count; i++) {
+        FatBuffer.slots[i] = FatBuffer.memory + i * size;
+    }
 
-        samplePointer = Mixer.sampleBegin[Mixer.channelSampleNumber[channel]] +
-                        (Mixer.channelSampleOffset[channel] >> FIXED_DIVIDER);
+    // XM delta decoding restarts at checkpoints, which have to be close enough for a window from one to reach past
+    // any frame it's read for (and not so close they take much memory)
+    FatBuffer.stride = 1024;
+    while (FatBuffer.stride > size / 4) {
+        FatBuffer.stride /= 2;
+    }
+    return true;
+}
 
-        if (Mixer.sampleLoopLength[Mixer.channelSampleNumber[channel]]) {
+// Finds the window of sample data holding frame and the one after it, for interpolation, and returns the data for
+// frames *first to *end - 1.  Plain samples in memory are played in place, while streamed ones, XM's delta coded
+// ones and S3M's unsigned ones go through the cache slots.  Frames past the end of the file read as 0, as do those
+// past the end of an XM sample.  Playing backwards, through a ping-pong loop, reads the window before frame.
+const uint8_t *AudioGeneratorMOD::FetchSample(uint8_t channel, uint16_t sampleNumber, uint32_t frame, bool backward, uint32_t *first, uint32_t *end) {
+    static int16_t edge[2];
+    const Sample &s = Mod.samples[sampleNumber];
+    uint32_t bytes = (s.flags & SAMPLE_16BIT) ? 2 : 1;
+    uint8_t slot = FatBuffer.channelSlot[channel];
+
+    if (!FatBuffer.count) {
+        uint32_t inMemory = (s.offset < memSize) ? (memSize - s.offset) / bytes : 0;
+        if (frame + 1 < inMemory) {
+            *first = 0;
+            *end = inMemory;
+            return mem + s.offset;
+        }
+        edge[0] = 0;
+        edge[1] = 0;
+        if (frame < inMemory) {
+            memcpy(edge, mem + s.offset + frame * bytes, bytes);
+        }
+        *first = frame;
+        *end = frame + 2;
+        return reinterpret_cast<const uint8_t*>(edge);
+    }
 
-            if (samplePointer >= Mixer.sampleLoopEnd[Mixer.channelSampleNumber[channel]]) {
-                Mixer.channelSampleOffset[channel] -= Mixer.sampleLoopLength[Mixer.channelSampleNumber[channel]] << FIXED_DIVIDER;
-                samplePointer -= Mixer.sampleLoopLength[Mixer.channelSampleNumber[channel]];
+    FatBuffer.useCount++;
+    if (FatBuffer.sampleNumber[slot] != sampleNumber || frame < FatBuffer.first[slot] ||
+            frame + 1 >= FatBuffer.first[slot] + FatBuffer.frames[slot]) {
+        // Maybe another channel has already read it, else replace the least recently used slot
+        uint8_t lru = 0;
+        for (slot = 0; slot < FatBuffer.count; slot++) {
+            if (FatBuffer.sampleNumber[slot] == sampleNumber && frame >= FatBuffer.first[slot] &&
+                    frame + 1 < FatBuffer.first[slot] + FatBuffer.frames[slot]) {
+                break;
+            }
+            if (FatBuffer.lastUsed[slot] < FatBuffer.lastUsed[lru]) {
+                lru = slot;
+            }
+        }
+        if (slot == FatBuffer.count) {
+            // Samples which fit are read whole, so they never need reading again however they're played.  Raw
+            // samples are read on past their end, like the file is, so memory and the cache agree.
+            uint32_t capacity = FatBuffer.size / bytes;
+            uint32_t extent = s.length + 2;
+            uint32_t start = 0;
+            if (extent > capacity) {
+                start = frame;
+                if (backward) {
+                    start = (frame + 2 > capacity) ? frame + 2 - capacity : 0;
+                    if ((s.flags & SAMPLE_DELTA) && (start + FatBuffer.stride - 1 <= frame)) {
+                        start += FatBuffer.stride - 1;
+                    }
+                }
+                if (s.flags & SAMPLE_DELTA) {
+                    start -= start % FatBuffer.stride;    // Decoding can only start at a checkpoint
+                }
+            }
+            uint32_t count = min(extent - start, capacity);
+            uint32_t toRead = count;
+            if (s.flags & SAMPLE_DELTA) {
+                toRead = (start < s.length) ? min(s.length - start, count) : 0;
             }
 
-        } else {
-
-            if (samplePointer >= Mixer.sampleEnd[Mixer.channelSampleNumber[channel]]) {
-                Mixer.channelFrequency[channel] = 0;
-                samplePointer = Mixer.sampleEnd[Mixer.channelSampleNumber[channel]];
+            slot = lru;
+            FatBuffer.misses++;
+            uint8_t *data = FatBuffer.slots[slot];
+            uint32_t got = 0;
+            uint32_t from = s.offset + start * bytes;
+            if (mem) {
+                if (from < memSize) {
+                    got = min(memSize - from, toRead * bytes);
+                    memcpy(data, mem + from, got);
+                }
+            } else if (toRead) {
+                if (!file->seek(from, SEEK_SET)) {
+                    return NULL;
+                }
+                got = file->read(data, toRead * bytes);
+                if (!got) {
+                    return NULL;
+                }
+            }
+            memset(data + got, 0, count * bytes - got);
+
+            if (s.flags & SAMPLE_DELTA) {
+                int16_t value = Mod.checkpoints[s.checkpoint + start / FatBuffer.stride];
+                if (bytes == 2) {
+                    int16_t *data16 = reinterpret_cast<int16_t*>(data);
+                    for (uint32_t i = 0; i < toRead; i++) {
+                        value += data16[i];
+                        data16[i] = value;
+                    }
+                } else {
+                    int8_t *data8 = reinterpret_cast<int8_t*>(data);
+                    int8_t value8 = value;
+                    for (uint32_t i = 0; i < toRead; i++) {
+                        value8 += data8[i];
+                        data8[i] = value8;
+                    }
+                }
+            } else if (s.flags & SAMPLE_UNSIGNED) {
+                if (bytes == 2) {
+                    uint16_t *data16 = reinterpret_cast<uint16_t*>(data);
+                    for (uint32_t i = 0; i < got / 2; i++) {
+                        data16[i] ^= 0x8000;
+                    }
+                } else {
+                    for (uint32_t i = 0; i < got; i++) {
+                        data[i] ^= 0x80;
+                    }
+                }
             }
 
+            FatBuffer.first[slot] = start;
+            FatBuffer.frames[slot] = count;
+            FatBuffer.sampleNumber[slot] = sampleNumber;
+        } else {
+            FatBuffer.hits++;
         }
+        FatBuffer.channelSlot[channel] = slot;
+    } else {
+        FatBuffer.hits++;
+    }
+    FatBuffer.lastUsed[slot] = FatBuffer.useCount;
+    *first = FatBuffer.first[slot];
+    *end = FatBuffer.first[slot] + FatBuffer.frames[slot];
+    return FatBuffer.slots[slot];
+}
 
-        if (samplePointer < FatBuffer.samplePointer[channel] ||
-                samplePointer >= FatBuffer.samplePointer[channel] + fatBufferSize - 1 ||
-                Mixer.channelSampleNumber[channel] != FatBuffer.channelSampleNumber[channel]) {
+static inline int16_t Clip16(int32_t sum) {
+    // clip samples to 16bit (with saturation in case of overflow)
+    if (sum <= INT16_MIN) {
+        return INT16_MIN;
+    } else if (sum >= INT16_MAX) {
+        return INT16_MAX;
+    }
+    return sum;
+}
 
-            uint32_t toRead = Mixer.sampleEnd[Mixer.channelSampleNumber[channel]] - samplePointer + 1;
-            if (toRead > (uint32_t)fatBufferSize) {
-                toRead  = fatBufferSize;
-            }
+// One frame of 8-bit sample data, interpolated and scaled to BITDEPTH
+inline int32_t AudioGeneratorMOD::Interpolate(const int8_t *data, uint32_t fraction) {
+    // preserve a few more bits from sample interpolation, by upscaling input values.
+    // This does (slightly) reduce quantization noise in higher frequencies, typically above 8kHz.
+    int16_t current16 = (int16_t) data[0] << 2;
+    int16_t next16    = (int16_t) data[1] << 2;
 
-            if (!file->seek(samplePointer, SEEK_SET)) {
-                stop();
-                return;
-            }
-            if (toRead != file->read(FatBuffer.channels[channel], toRead)) {
-                stop();
-                return;
-            }
+    // Integer linear interpolation - only works correctly in 16bit
+    int16_t sample = current16 + ((next16 - current16) * (int32_t)fraction >> FIXED_DIVIDER);
+
+    // Upscale to BITDEPTH, considering the we already gained two bits in the previous step
+    return (int32_t)sample << (BITDEPTH - 10);
+}
+
+// ...and of 16-bit data, which is already there
+inline int32_t AudioGeneratorMOD::Interpolate(const int16_t *data, uint32_t fraction) {
+    return data[0] + ((data[1] - data[0]) * (int32_t)fraction >> FIXED_DIVIDER);
+}
+
+// Mixes count + 1 frames from data, which holds frames first onwards.  Backwards, the frame played is mirror - offset.
+template <typename T, bool BACKWARD>
+inline int32_t *AudioGeneratorMOD::MixStretch(int32_t *out, const T *data, uint32_t first, uint32_t &offset, uint32_t frequency,
+        uint32_t mirror, uint32_t count, int32_t gainLeft, int32_t gainRight) {
+    while (true) {
+        uint32_t at = BACKWARD ? mirror - offset : offset;
+        int32_t sample32 = Interpolate(data + (at >> FIXED_DIVIDER) - first, at & ((1 << FIXED_DIVIDER) - 1));
 
-            FatBuffer.samplePointer[channel] = samplePointer;
-            FatBuffer.channelSampleNumber[channel] = Mixer.channelSampleNumber[channel];
+        // Channel volume and panning together
+        out[0] += sample32 * gainLeft >> 12;
+        out[1] += sample32 * gainRight >> 12;
+        out += 2;
+
+        if (!count--) {
+            break;
         }
+        offset += frequency;
+    }
+    return out;
+}
 
-        current = FatBuffer.channels[channel][(samplePointer - FatBuffer.samplePointer[channel]) /*& (FATBUFFERSIZE - 1)*/];
-        next = FatBuffer.channels[channel][(samplePointer + 1 - FatBuffer.samplePointer[channel]) /*& (FATBUFFERSIZE - 1)*/];
+// Mixes the next frames into block[].  Each channel runs over the whole block on its own, in stretches which
+// stay inside both the sample data fetched and the sample's loop or end, so those are only checked between them.
+bool AudioGeneratorMOD::RenderBlock(uint16_t frames) {
+    uint8_t active;
+
+    memset(mix, 0, frames * 2 * sizeof(mix[0]));
+    for (active = 0; active < Mixer.activeCount; active++) {
+        uint8_t channel = Mixer.active[active];
+        uint16_t sampleNumber = Mixer.channelSampleNumber[channel];
+        const Sample &s = Mod.samples[sampleNumber];
+        uint32_t frequency = Mixer.channelFrequency[channel];
+        uint32_t offset = Mixer.channelSampleOffset[channel];
+        int32_t gainLeft = Mixer.channelGainLeft[channel];
+        int32_t gainRight = Mixer.channelGainRight[channel];
+
+        if (!frequency) {
+            continue;    // Ran off the end in an earlier block of this tick
+        }
+        if (!gainLeft && !gainRight) {
+            // Silent channels only move along, without looping
+            Mixer.channelSampleOffset[channel] = offset + frequency * frames;
+            continue;
+        }
 
-        // preserve a few more bits from sample interpolation, by upscaling input values.
-        // This does (slightly) reduce quantization noise in higher frequencies, typically above 8kHz.
-        // Actually we could could even gain more bits, I was just not sure if more bits would cause overflows in other conputations.
-        int16_t current16 = (int16_t) current << 2;
-        int16_t next16    = (int16_t) next << 2;
+        // Ping-pong loops turn around at their last frame, so going there and back is a loop of 2 * (length - 1)
+        uint32_t loopLength = s.loopLength;
+        uint32_t limit = loopLength ? s.loopBegin + loopLength : s.length;
+        bool pingPong = (s.flags & SAMPLE_PINGPONG) && (loopLength > 1);
+        uint32_t turn = limit - 1;
+        uint32_t back = pingPong ? 2 * (loopLength - 1) : loopLength;
+        uint32_t wrap = pingPong ? s.loopBegin + back : limit;
+        int32_t *out = mix;
+        uint32_t left = frames;
+
+        while (left) {
+            // The first frame of a stretch takes care of the loop or end of the sample, and finds its data
+            offset += frequency;
+            uint32_t position = offset >> FIXED_DIVIDER;
+            if (position >= wrap) {
+                if (loopLength) {
+                    while (position >= wrap) {
+                        offset -= back << FIXED_DIVIDER;
+                        position -= back;
+                    }
+                } else {
+                    // Hold the last position, keeping the fraction for the interpolation
+                    frequency = 0;
+                    position = limit;
+                    offset = (limit << FIXED_DIVIDER) | (offset & ((1 << FIXED_DIVIDER) - 1));
+                }
+            }
+            bool backward = pingPong && (position >= turn);
+            uint32_t mirror = (2 * turn) << FIXED_DIVIDER;
+            uint32_t frame = backward ? (mirror - offset) >> FIXED_DIVIDER : position;
 
-        out = current16;
+            uint32_t first, end;
+            const uint8_t *data = FetchSample(channel, sampleNumber, frame, backward, &first, &end);
+            if (!data) {
+                stop();
+                return false;
+            }
 
-        // Integer linear interpolation - only works correctly in 16bit
-        out += (next16 - current16) * (Mixer.channelSampleOffset[channel] & ((1 << FIXED_DIVIDER) - 1)) >> FIXED_DIVIDER;
+            // The rest follow on while they're inside the data and before the limit, or the turn
+            uint32_t bound;
+            if (backward) {
+                bound = min(((2 * turn - first) << FIXED_DIVIDER) + 1, wrap << FIXED_DIVIDER);
+            } else {
+                bound = min(end - 1, pingPong ? turn : limit) << FIXED_DIVIDER;
+            }
+            uint32_t more = 0;
+            if (frequency && (bound > offset)) {
+                more = (bound - offset - 1) / frequency;
+            }
+            if (more > left - 1) {
+                more = left - 1;
+            }
+            left -= more + 1;
 
-        // Upscale to BITDEPTH, considering the we already gained two bits in the previous step
-        out32 = (int32_t)out << (BITDEPTH - 10);
+            if (s.flags & SAMPLE_16BIT) {
+                const int16_t *data16 = reinterpret_cast<const int16_t*>(data);
+                if (backward) {
+                    out = MixStretch<int16_t, true>(out, data16, first, offset, frequency, mirror, more, gainLeft, gainRight);
+                } else {
+                    out = MixStretch<int16_t, false>(out, data16, first, offset, frequency, mirror, more, gainLeft, gainRight);
+                }
+            } else {
+                const int8_t *data8 = reinterpret_cast<const int8_t*>(data);
+                if (backward) {
+                    out = MixStretch<int8_t, true>(out, data8, first, offset, frequency, mirror, more, gainLeft, gainRight);
+                } else {
+                    out = MixStretch<int8_t, false>(out, data8, first, offset, frequency, mirror, more, gainLeft, gainRight);
+                }
+            }
 
-        // Channel volume
-        out32 = out32 * Mixer.channelVolume[channel] >> 6;
+            if (!frequency) {
+                break;    // Played to the end, so the channel stops here
+            }
+        }
 
-        // Channel panning
-        sumL += out32 * min(128 - Mixer.channelPanning[channel], 64) >> 6;
-        sumR += out32 * min(Mixer.channelPanning[channel], 64) >> 6;
+        Mixer.channelSampleOffset[channel] = offset;
+        Mixer.channelFrequency[channel] = frequency;
     }
 
-    // Downscale to BITDEPTH - a bit faster because the compiler can replaced division by constants with proper "right shift" + correct handling of sign bit
+    // Downscale to BITDEPTH and clip, in one pass.  Dividing by constants lets the compiler use shifts, with the
+    // proper handling of the sign bit
+    int32_t *sum = mix;
+    int16_t *out = block;
+    uint32_t count = frames * 2;
     if (Mod.numberOfChannels <= 4) {
         // up to 4 channels
-        sumL /= 4;
-        sumR /= 4;
+        while (count--) {
+            *out++ = Clip16(*sum++ / 4);
+        }
+    } else if (Mod.numberOfChannels <= 6) {
+        // 5 or 6 channels - pre-multiply be 1.5, then divide by 8 -> same as division by 6
+        while (count--) {
+            *out++ = Clip16((*sum + (*sum / 2)) / 8);
+            sum++;
+        }
+    } else if (Mod.numberOfChannels <= 8 || Mod.format == FORMAT_MOD) {
+        // 7,8, or more channels
+        while (count--) {
+            *out++ = Clip16(*sum++ / 8);
+        }
     } else {
-        if (Mod.numberOfChannels <= 6) {
-            // 5 or 6 channels - pre-multiply be 1.5, then divide by 8 -> same as division by 6
-            sumL = (sumL + (sumL / 2)) / 8;
-            sumR = (sumR + (sumR / 2)) / 8;
-        } else {
-            // 7,8, or more channels
-            sumL /= 8;
-            sumR /= 8;
+        // More than 8 in an XM or S3M, which seldom all play at once
+        while (count--) {
+            *out++ = Clip16(*sum++ / 16);
         }
     }
-
-    // clip samples to 16bit (with saturation in case of overflow)
-    if (sumL <= INT16_MIN) {
-        sumL = INT16_MIN;
-    } else if (sumL >= INT16_MAX) {
-        sumL = INT16_MAX;
-    }
-    if (sumR <= INT16_MIN) {
-        sumR = INT16_MIN;
-    } else if (sumR >= INT16_MAX) {
-        sumR = INT16_MAX;
-    }
-
-    // Fill the sound buffer with signed values
-    sample[AudioOutput::LEFTCHANNEL] = sumL;
-    sample[AudioOutput::RIGHTCHANNEL] = sumR;
+    return true;
 }
 
 bool AudioGeneratorMOD::LoadMOD() {
     uint8_t channel;
+    uint8_t id[48];
 
-    if (!LoadHeader()) {
+    Mod.numberOfSamples = 0;
+    Mod.numberOfInstruments = 0;
+    Mod.numberOfPatterns = 0;
+    patternBufferStart = 0;
+    patternBufferLength = 0;
+
+    // XM and S3M both have their own signature, else it's a MOD
+    if (sizeof(id) != file->read(id, sizeof(id)) || !file->seek(0, SEEK_SET)) {
         return false;
     }
-    LoadSamples();
+    if (!memcmp(id, "Extended Module: ", 17)) {
+        Mod.format = FORMAT_XM;
+        if (!LoadXM()) {
+            return false;
+        }
+    } else if (!memcmp(id + 44, "SCRM", 4)) {
+        Mod.format = FORMAT_S3M;
+        if (!LoadS3M()) {
+            return false;
+        }
+    } else {
+        Mod.format = FORMAT_MOD;
+        Mod.linear = false;
+        if (!LoadHeader()) {
+            return false;
+        }
+        LoadSamples();
+    }
 
     Player.amiga = AMIGA;
     Player.samplesPerTick = sampleRate / (2 * 125 / 5); // Hz = 2 * BPM / 5
     Player.speed = 6;
     Player.tick = Player.speed;
     Player.row = 0;
+    Player.globalVolume = 64;
 
     Player.orderIndex = 0;
-    Player.oldOrderIndex = 0xFF;
     Player.patternDelay = 0;
+    Player.rowPattern = NOPATTERN;
+    Mixer.activeCount = 0;
 
     for (channel = 0; channel < Mod.numberOfChannels; channel++) {
         Player.patternLoopCount[channel] = 0;
@@ -1029,9 +1411,7 @@ bool AudioGeneratorMOD::LoadMOD() {
         Player.tremoloDepth[channel] = 0;
         Player.tremoloPos[channel] = 0;
 
-        FatBuffer.samplePointer[channel] = 0;
-        FatBuffer.channelSampleNumber[channel] = 0xFF;
-
+        Mixer.channelSampleNumber[channel] = 0;
         Mixer.channelSampleOffset[channel] = 0;
         Mixer.channelFrequency[channel] = 0;
         Mixer.channelVolume[channel] = 0;
@@ -1043,7 +1423,20 @@ bool AudioGeneratorMOD::LoadMOD() {
         default:
             Mixer.channelPanning[channel] = 128 - stereoSeparation;
         }
+        Mixer.channelGainLeft[channel] = 0;
+        Mixer.channelGainRight[channel] = 0;
+
+        memset(&Voices[channel], 0, sizeof(Voices[channel]));
+        Voices[channel].panning = (Mod.format == FORMAT_MOD) ? 128 : Mod.initialPanning[channel];
+    }
+
+    if (Mod.format != FORMAT_MOD) {
+        Player.speed = Mod.initialSpeed ? Mod.initialSpeed : 6;
+        Player.tick = Player.speed;
+        if (Mod.initialTempo >= 32) {
+            Player.samplesPerTick = sampleRate * 5 / (2 * Mod.initialTempo);
+        }
+        Player.globalVolume = Mod.initialGlobalVolume;
     }
     return true;
 }
-
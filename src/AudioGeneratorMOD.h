@@ -1,6 +1,6 @@
 /*
     AudioGeneratorMOD
-    Audio output generator that plays Amiga MOD tracker files
+    Audio output generator that plays Amiga MOD, FastTracker 2 XM and Scream Tracker 3 S3M tracker files
 
     Copyright (C) 2017  Earle F. Philhower, III
 
@@ -57,27 +57,74 @@ public:
         } usePAL = use;
         return true;
     }
+    // Reads the whole module into RAM (PSRAM where malloc() uses it) at begin(), when it fits, instead of
+    // streaming patterns and samples from the file.  Sources already in memory are always played in place.
+    bool SetPreload(bool use) {
+        if (running) {
+            return false;
+        } preload = use;
+        return true;
+    }
+    bool Preloaded() {
+        return mem != NULL;
+    }
+    // Sample cache lookups that found the data already read, and those that went to the file
+    void SampleCacheStats(uint32_t *hits, uint32_t *misses) {
+        *hits = FatBuffer.hits;
+        *misses = FatBuffer.misses;
+    }
 
 protected:
     bool LoadMOD();
     bool LoadHeader();
-    void GetSample(int16_t sample[2]);
+    bool RenderBlock(uint16_t frames);
     bool RunPlayer();
     void LoadSamples();
-    bool LoadPattern(uint8_t pattern);
+    bool LoadRow();
+    bool LoadModule();
+    bool AllocateSlots();
+    void FreeBuffers();
+    const uint8_t *FetchSample(uint8_t channel, uint16_t sampleNumber, uint32_t frame, bool backward, uint32_t *first, uint32_t *end);
+    const uint8_t *PatternData(uint32_t offset, uint32_t len);
     bool ProcessTick();
     bool ProcessRow();
     void Tremolo(uint8_t channel);
     void Portamento(uint8_t channel);
     void Vibrato(uint8_t channel);
 
+    // FastTracker 2 (.XM) and Scream Tracker 3 (.S3M) modules, in AudioGeneratorMODTracker.cpp
+    bool LoadXM();
+    bool LoadS3M();
+    bool BuildCheckpoints();
+    bool DecodeTrackerRow(uint16_t pattern, uint16_t row);
+    bool ProcessTrackerRow();
+    bool ProcessTrackerTick();
+    void TriggerCell(uint8_t channel);
+    void KeyOff(uint8_t channel);
+    void UpdateVoices();
+    void VolumeSlide(uint8_t channel, uint8_t parameter);
+    void PeriodSlide(uint8_t channel, int32_t delta);
+    void TonePortamento(uint8_t channel);
+    void TrackerVibrato(uint8_t channel);
+    void TrackerTremolo(uint8_t channel);
+    int32_t NotePeriod(uint8_t note, uint16_t sampleNumber);
+    uint32_t PeriodStep(int32_t period, uint8_t semitones);
+
+    // The mixer's inner loop, for 8 and 16 bit samples played either way
+    static inline int32_t Interpolate(const int8_t *data, uint32_t fraction);
+    static inline int32_t Interpolate(const int16_t *data, uint32_t fraction);
+    template <typename T, bool BACKWARD>
+    static inline int32_t *MixStretch(int32_t *out, const T *data, uint32_t first, uint32_t &offset, uint32_t frequency,
+                                      uint32_t mirror, uint32_t count, int32_t gainLeft, int32_t gainRight);
 
 protected:
     int mixerTick;
     enum {BITDEPTH = 16};
     int sampleRate;
-    int fatBufferSize; //(6*1024) // File system buffers per-CHANNEL (i.e. total mem required is 4 * FATBUFFERSIZE)
+    int fatBufferSize; //(6*1024) // Sample cache slot size, one slot per channel the module uses (i.e. total mem required is 4 * FATBUFFERSIZE for a 4 channel MOD)
     enum {FIXED_DIVIDER = 10};             // Fixed-point mantissa used for integer arithmetic
+    enum {BLOCK = 128};                    // Frames mixed at a time, never crossing a tick
+    enum {PATTERNBUFFER = 256};            // Pattern bytes read from the file at a time, enough for any row
     int stereoSeparation; //STEREOSEPARATION = 32;    // 0 (max) to 64 (mono)
     bool usePAL;
 
@@ -92,46 +139,93 @@ protected:
     // support max 4 channels
     enum {ROWS = 64, SAMPLES = 31, CHANNELS = 4, NONOTE = 0xFFFF, NONOTE8 = 0xff };
 #else
-    // support max 8 channels
-    enum {ROWS = 64, SAMPLES = 31, CHANNELS = 8, NONOTE = 0xFFFF, NONOTE8 = 0xff };
+    // support max 32 channels
+    enum {ROWS = 64, SAMPLES = 31, CHANNELS = 32, NONOTE = 0xFFFF, NONOTE8 = 0xff };
 #endif
+    enum {FORMAT_MOD = 0, FORMAT_S3M, FORMAT_XM};
+    enum {NOSAMPLE = 0xFFFF, NOPATTERN = 0xFFFF};
+    enum {KEYOFF = 97, CUTNOTE = 98};      // XM/S3M notes after the 96 playable ones
+    enum {SAMPLE_16BIT = 1, SAMPLE_PINGPONG = 2, SAMPLE_DELTA = 4, SAMPLE_UNSIGNED = 8};
 
     typedef struct Sample {
-        uint16_t length;
-        int8_t fineTune;
+        uint32_t length;      // Frames
+        int8_t fineTune;      // MOD -8..7, XM -128..127
         uint8_t volume;
-        uint16_t loopBegin;
-        uint16_t loopLength;
+        uint32_t loopBegin;   // Frames
+        uint32_t loopLength;  // Frames, 0 for no loop
+        uint32_t offset;      // File offset of frame 0 (for MOD, one byte before the sample)
+        uint32_t c2spd;       // Hz played at C-4 (XM's relative note and finetune are applied to 8363)
+        int8_t relativeNote;
+        uint8_t panning;      // XM
+        uint8_t flags;        // SAMPLE_*
+        uint32_t checkpoint;  // First of this sample's delta checkpoints, for XM
     } Sample;
 
+    // XM envelopes, with tick positions and 0..64 values
+    typedef struct Envelope {
+        uint16_t x[12];
+        uint8_t y[12];
+        uint8_t points;
+        uint8_t sustain;
+        uint8_t loopBegin;
+        uint8_t loopEnd;
+        uint8_t flags;        // 1 on, 2 sustain, 4 loop
+    } Envelope;
+
+    typedef struct Instrument {
+        uint8_t sampleMap[96];  // Note to sample, counting from firstSample, or 0xFF for none
+        uint16_t firstSample;
+        Envelope volumeEnvelope;
+        Envelope panningEnvelope;
+        uint8_t vibratoType;
+        uint8_t vibratoSweep;
+        uint8_t vibratoDepth;
+        uint8_t vibratoRate;
+        uint16_t fadeout;
+    } Instrument;
+
     typedef struct mod {
-        Sample samples[SAMPLES];
-        uint8_t songLength;
-        uint8_t numberOfPatterns;
-        uint8_t order[128];
+        Sample *samples;
+        uint16_t numberOfSamples;
+        Instrument *instruments;  // XM only
+        uint8_t numberOfInstruments;
+        int16_t *checkpoints;     // XM sample values every FatBuffer.stride frames, as they're delta coded
+        uint32_t *patternOffset;  // XM/S3M packed pattern data...
+        uint16_t *patternSize;
+        uint16_t *patternRows;
+        uint16_t songLength;
+        uint16_t numberOfPatterns;
+        uint8_t order[256];
         uint8_t numberOfChannels;
+        uint8_t format;
+        bool linear;              // XM linear frequency table, else Amiga periods
+        uint8_t initialSpeed;
+        uint8_t initialTempo;
+        uint8_t initialGlobalVolume;
+        uint8_t initialPanning[CHANNELS];
     } mod;
 
-    // Save 256 bytes by storing raw note values, unpack with macro NOTE
-    typedef struct Pattern {
-        uint8_t sampleNumber[ROWS][CHANNELS];
-        uint8_t note8[ROWS][CHANNELS];
-        uint8_t effectNumber[ROWS][CHANNELS];
-        uint8_t effectParameter[ROWS][CHANNELS];
-    } Pattern;
+    // One row of the pattern playing, decoded from any of the formats
+    typedef struct cell {
+        uint8_t note;            // MOD: period index or NONOTE8.  XM/S3M: 1-96, KEYOFF, CUTNOTE or 0 for none
+        uint8_t sampleNumber;    // MOD sample or XM/S3M instrument, counting from 1, or 0 for none
+        uint8_t volume;          // XM volume column (S3M volumes are converted to it), or 0 for none
+        uint8_t effectNumber;    // MOD/XM effect (S3M effects are converted to these)
+        uint8_t effectParameter;
+    } cell;
 
     typedef struct player {
-        Pattern currentPattern;
+        cell currentRow[CHANNELS];
 
         uint32_t amiga;
         uint16_t samplesPerTick;
         uint8_t speed;
         uint8_t tick;
-        uint8_t row;
-        uint8_t lastRow;
+        uint16_t row;
+        uint16_t lastRow;
+        uint8_t globalVolume;
 
-        uint8_t orderIndex;
-        uint8_t oldOrderIndex;
+        uint16_t orderIndex;
         uint8_t patternDelay;
         uint8_t patternLoopCount[CHANNELS];
         uint8_t patternLoopRow[CHANNELS];
@@ -154,26 +248,87 @@ protected:
         uint8_t tremoloSpeed[CHANNELS];
         uint8_t tremoloDepth[CHANNELS];
         int8_t tremoloPos[CHANNELS];
+
+        // Where the next XM/S3M row starts, so playing on doesn't rescan the pattern
+        uint16_t rowPattern;
+        uint16_t rowNumber;
+        uint32_t rowOffset;
     } player;
 
-    typedef struct mixer {
-        uint32_t sampleBegin[SAMPLES];
-        uint32_t sampleEnd[SAMPLES];
-        uint32_t sampleloopBegin[SAMPLES];
-        uint16_t sampleLoopLength[SAMPLES];
-        uint32_t sampleLoopEnd[SAMPLES];
+    // XM/S3M channel state beyond what a MOD needs
+    typedef struct voice {
+        uint8_t instrument;       // Counting from 1, or 0 for none
+        uint8_t note;             // Last note played, counting from 0 (C-0)
+        int8_t volume;            // 0..64
+        uint8_t panning;          // 0..255
+        int32_t period;           // Linear (XM) or 4x Amiga units
+        int32_t targetPeriod;     // Tone portamento
+        int16_t periodDelta;      // Vibrato, this tick
+        int8_t volumeDelta;       // Tremolo, this tick
+        uint8_t semitones;        // Arpeggio, this tick
+        bool keyOn;
+        bool tremorOff;
+        uint16_t fadeout;         // 32768 down to 0 after a key off
+        uint16_t volumeEnvelopeTick;
+        uint16_t panningEnvelopeTick;
+        uint8_t autoVibratoPos;
+        uint16_t autoVibratoSweep;
+        uint32_t startOffset;     // 9xx offset, in frames
+        // Effect memories
+        uint8_t portamentoUp;
+        uint8_t portamentoDown;
+        uint8_t portamentoSpeed;
+        uint8_t finePortamentoUp;
+        uint8_t finePortamentoDown;
+        uint8_t extraFinePortamentoUp;
+        uint8_t extraFinePortamentoDown;
+        uint8_t vibratoSpeed;
+        uint8_t vibratoDepth;
+        uint8_t vibratoPos;
+        uint8_t tremoloSpeed;
+        uint8_t tremoloDepth;
+        uint8_t tremoloPos;
+        uint8_t waveControl;
+        uint8_t volumeSlide;
+        uint8_t fineVolumeSlideUp;
+        uint8_t fineVolumeSlideDown;
+        uint8_t globalVolumeSlide;
+        uint8_t panningSlide;
+        uint8_t sampleOffset;
+        uint8_t retrigger;
+        uint8_t retriggerCount;
+        uint8_t tremor;
+        uint8_t tremorCount;
+    } voice;
 
-        uint8_t channelSampleNumber[CHANNELS];
+    typedef struct mixer {
+        uint16_t channelSampleNumber[CHANNELS];
         uint32_t channelSampleOffset[CHANNELS];
         uint16_t channelFrequency[CHANNELS];
         uint8_t channelVolume[CHANNELS];
         uint8_t channelPanning[CHANNELS];
+        uint16_t channelGainLeft[CHANNELS];  // Volume times panning, set once per tick
+        uint16_t channelGainRight[CHANNELS];
+        uint8_t active[CHANNELS];            // The channels with anything to mix this tick
+        uint8_t activeCount;
     } mixer;
 
+    // Windows of sample data shared by all channels, so a sample two channels play is only read once and
+    // one that fits a slot stays whole.  A miss reloads the slot used longest ago.
     typedef struct fatBuffer {
-        uint8_t *channels[CHANNELS]; // Make dynamically allocated [FATBUFFERSIZE];
-        uint32_t samplePointer[CHANNELS];
-        uint8_t channelSampleNumber[CHANNELS];
+        uint8_t *memory;                  // All the slots, in one allocation
+        uint8_t *slots[CHANNELS];
+        uint32_t first[CHANNELS];         // Frame at the start of each slot
+        uint32_t frames[CHANNELS];        // Frames read into each slot
+        uint16_t sampleNumber[CHANNELS];  // Sample each slot holds, or NOSAMPLE for none
+        uint32_t lastUsed[CHANNELS];
+        uint8_t channelSlot[CHANNELS];    // Slot each channel read last, checked first
+        uint8_t count;
+        uint32_t size;                    // Bytes in each slot
+        uint32_t stride;                  // Frames between XM delta checkpoints
+        uint32_t useCount;
+        uint32_t hits;
+        uint32_t misses;
     } fatBuffer;
 
     // Effects
@@ -182,6 +337,11 @@ protected:
                    SETVOLUME, BREAKPATTERNTOROW, ESUBSET, SETSPEED
                  } EffectsValues;
 
+    // XM effects past the MOD ones, G=16 onwards
+    typedef enum { SETGLOBALVOLUME = 16, GLOBALVOLUMESLIDE, KEYOFFEFFECT = 20, SETENVELOPEPOSITION,
+                   PANNINGSLIDE = 25, MULTIRETRIGGER = 27, TREMOR = 29, EXTRAFINEPORTAMENTO = 33
+                 } TrackerEffectsValues;
+
     // 0xE subset
     typedef enum { SETFILTER = 0, FINEPORTAMENTOUP, FINEPORTAMENTODOWN, GLISSANDOCONTROL, SETVIBRATOWAVEFORM,
                    SETFINETUNE, PATTERNLOOP, SETTREMOLOWAVEFORM, SUBEFFECT8, RETRIGGERNOTE, FINEVOLUMESLIDEUP,
@@ -193,7 +353,21 @@ protected:
     mod Mod;
     mixer Mixer;
     fatBuffer FatBuffer;
+    voice Voices[CHANNELS];
+
+    int32_t mix[BLOCK * 2];     // Channels summed at full precision...
+    int16_t block[BLOCK * 2];   // ...then scaled and clipped for the output
+    uint16_t blockFrames;
+    uint16_t blockSent;
+
+    const uint8_t *mem;  // Whole module, when it's in memory
+    uint8_t *preloaded;  // ...our copy of it, if we made one
+    uint32_t memSize;
+    bool preload;
+
+    uint8_t patternBuffer[PATTERNBUFFER];  // Pattern data read from the file, when it isn't in memory
+    uint32_t patternBufferStart;
+    uint32_t patternBufferLength;
 };
 
 #endif
-
@@ -0,0 +1,1320 @@
+/*
+    AudioGeneratorMOD
+    FastTracker 2 (.XM) and Scream Tracker 3 (.S3M) loading and playback
+
+    Copyright (C) 2017  Earle F. Philhower, III
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#define PGM_READ_UNALIGNED 0
+
+#include "AudioGeneratorMOD.h"
+
+/*
+    Both formats are played by the same engine as MODs, a row and its ticks at a time.  Their patterns are
+    decoded a row at a time too, and S3M effects are converted to their XM equivalents as they are, so the
+    player only needs to know XM.  Samples stay in the file and are read through the mixer's sample cache.
+
+    Periods are in 1/4 Amiga units (1712 is C-4), or for XM's linear frequency table 1/64ths of a semitone
+    below 7680 (C-0).
+*/
+
+#pragma GCC optimize ("O3")
+
+#ifndef min
+#define min(X,Y) ((X) < (Y) ? (X) : (Y))
+#endif
+
+// 2^(i/12) and 2^(i/768), in 16.16
+static const uint32_t semitoneTable[12] PROGMEM = {
+    65536, 69433, 73562, 77936, 82570, 87480, 92682, 98193, 104032, 110218, 116772, 123715
+};
+static const uint32_t fineTable[64] PROGMEM = {
+    65536, 65595, 65654, 65714, 65773, 65832, 65892, 65951,
+    66011, 66071, 66130, 66190, 66250, 66309, 66369, 66429,
+    66489, 66549, 66609, 66670, 66730, 66790, 66850, 66911,
+    66971, 67032, 67092, 67153, 67213, 67274, 67335, 67395,
+    67456, 67517, 67578, 67639, 67700, 67761, 67823, 67884,
+    67945, 68007, 68068, 68129, 68191, 68252, 68314, 68376,
+    68438, 68499, 68561, 68623, 68685, 68747, 68809, 68871,
+    68933, 68996, 69058, 69120, 69183, 69245, 69308, 69370
+};
+
+static const uint8_t halfSine[32] PROGMEM = {
+    0,  24,  49,  74,  97, 120, 141, 161,
+    180, 197, 212, 224, 235, 244, 250, 253,
+    255, 253, 250, 244, 235, 224, 212, 197,
+    180, 161, 141, 120,  97,  74,  49,  24
+};
+
+// Volume changes for multi retrigger (Rxy), x = 6, 7, E and F scale instead
+static const int8_t retriggerVolume[16] PROGMEM = {
+    0, -1, -2, -4, -8, -16, 0, 0, 0, 1, 2, 4, 8, 16, 0, 0
+};
+
+static inline uint16_t Word(const uint8_t *p) {
+    return p[0] | (p[1] << 8);
+}
+
+static inline uint32_t DWord(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// 2^(x/768) in 16.16, for 1/64ths of a semitone either way
+static uint64_t Pow2(int32_t x) {
+    int32_t octave = (x >= 0) ? x / 768 : -((767 - x) / 768);
+    uint32_t rest = x - octave * 768;
+    uint64_t value = (uint64_t)pgm_read_dword(semitoneTable + rest / 64) * pgm_read_dword(fineTable + rest % 64) >> 16;
+    return (octave >= 0) ? value << octave : value >> -octave;
+}
+
+// Vibrato and tremolo, -255..255 over positions 0..63: sine, ramp down, square, random
+static int16_t Waveform(uint8_t type, uint8_t pos) {
+    pos &= 63;
+    switch (type & 3) {
+    case 0:
+        return (pos < 32) ? pgm_read_byte(halfSine + pos) : -pgm_read_byte(halfSine + pos - 32);
+    case 1:
+        return 255 - pos * 8;
+    case 2:
+        return (pos < 32) ? 255 : -255;
+    default:
+        return (rand() & 511) - 256;
+    }
+}
+
+// The next byte of a row, or 0 past the end of the pattern
+static inline uint8_t Next(const uint8_t *&p, const uint8_t *last) {
+    return (p < last) ? *p++ : 0;
+}
+
+bool AudioGeneratorMOD::LoadXM() {
+    // Nothing plays yet, so the pattern buffer holds the header and then each instrument block
+    uint8_t *header = patternBuffer;
+    uint8_t *buffer = patternBuffer;
+    const uint16_t instrumentBlock = 243;
+    uint16_t i;
+
+    if (80 != file->read(header, 80)) {
+        return false;
+    }
+    if (Word(header + 58) < 0x0104) {
+        audioLogger->printf_P(PSTR("AudioGeneratorMOD: XM version %04x isn't supported\n"), Word(header + 58));
+        return false;
+    }
+    Mod.songLength = min(Word(header + 64), 256);
+    Mod.numberOfChannels = min(Word(header + 68), 255);
+    Mod.numberOfPatterns = min(Word(header + 70), 256);
+    Mod.numberOfInstruments = min(Word(header + 72), 128);
+    Mod.linear = Word(header + 74) & 1;
+    Mod.initialSpeed = min(Word(header + 76), 31);
+    Mod.initialTempo = min(Word(header + 78), 255);
+    Mod.initialGlobalVolume = 64;
+    if (!Mod.songLength || !Mod.numberOfChannels) {
+        return false;
+    }
+    if (Mod.numberOfChannels > CHANNELS) {
+        audioLogger->printf("\nAudioGeneratorMOD::LoadXM abort - too many channels (configured: %d, needed: %d)\n", CHANNELS, Mod.numberOfChannels);
+        return false;
+    }
+    if (sizeof(Mod.order) != file->read(Mod.order, sizeof(Mod.order))) {
+        return false;
+    }
+    for (i = 0; i < CHANNELS; i++) {
+        Mod.initialPanning[i] = 128;
+    }
+
+    // Only where each pattern is gets kept, its rows are read as they play
+    Mod.patternOffset = reinterpret_cast<uint32_t*>(calloc(Mod.numberOfPatterns + 1, sizeof(uint32_t)));
+    Mod.patternSize = reinterpret_cast<uint16_t*>(calloc(Mod.numberOfPatterns + 1, sizeof(uint16_t)));
+    Mod.patternRows = reinterpret_cast<uint16_t*>(calloc(Mod.numberOfPatterns + 1, sizeof(uint16_t)));
+    if (!Mod.patternOffset || !Mod.patternSize || !Mod.patternRows) {
+        return false;
+    }
+    uint32_t pos = 60 + DWord(header + 60);
+    for (i = 0; i < Mod.numberOfPatterns; i++) {
+        if (!file->seek(pos, SEEK_SET) || (9 != file->read(buffer, 9))) {
+            return false;
+        }
+        uint16_t rows = Word(buffer + 5);
+        Mod.patternRows[i] = (rows && rows <= 256) ? rows : ROWS;
+        Mod.patternOffset[i] = pos + DWord(buffer);
+        Mod.patternSize[i] = Word(buffer + 7);
+        pos = Mod.patternOffset[i] + Mod.patternSize[i];
+    }
+
+    Mod.instruments = reinterpret_cast<Instrument*>(calloc(Mod.numberOfInstruments + 1, sizeof(Instrument)));
+    if (!Mod.instruments) {
+        return false;
+    }
+    Mod.numberOfSamples = 0;
+    for (i = 0; i < Mod.numberOfInstruments; i++) {
+        Instrument &ins = Mod.instruments[i];
+        memset(buffer, 0, instrumentBlock);
+        if (!file->seek(pos, SEEK_SET) || (file->read(buffer, instrumentBlock) < 29)) {
+            return false;
+        }
+        uint32_t size = DWord(buffer);
+        uint16_t samples = Word(buffer + 27);
+        memset(ins.sampleMap, 0xFF, sizeof(ins.sampleMap));
+        ins.firstSample = Mod.numberOfSamples;
+        pos += size;
+        if (!samples) {
+            continue;
+        }
+
+        uint32_t headerSize = DWord(buffer + 29);
+        for (uint8_t n = 0; n < 96; n++) {
+            if (buffer[33 + n] < samples) {
+                ins.sampleMap[n] = buffer[33 + n];
+            }
+        }
+        for (uint8_t e = 0; e < 2; e++) {
+            Envelope &env = e ? ins.panningEnvelope : ins.volumeEnvelope;
+            for (uint8_t n = 0; n < 12; n++) {
+                env.x[n] = Word(buffer + 129 + e * 48 + n * 4);
+                env.y[n] = min(Word(buffer + 131 + e * 48 + n * 4), 64);
+            }
+            env.points = min(buffer[225 + e], 12);
+            env.sustain = buffer[227 + e * 3];
+            env.loopBegin = buffer[228 + e * 3];
+            env.loopEnd = buffer[229 + e * 3];
+            env.flags = env.points ? (buffer[233 + e] & 7) : 0;
+            if (env.sustain >= env.points) {
+                env.flags &= ~2;
+            }
+            if (env.loopBegin >= env.points || env.loopEnd >= env.points || env.loopBegin > env.loopEnd) {
+                env.flags &= ~4;
+            }
+        }
+        ins.vibratoType = buffer[235];
+        ins.vibratoSweep = buffer[236];
+        ins.vibratoDepth = buffer[237];
+        ins.vibratoRate = buffer[238];
+        ins.fadeout = Word(buffer + 239);
+
+        Sample *grown = reinterpret_cast<Sample*>(realloc(Mod.samples, (Mod.numberOfSamples + samples) * sizeof(Sample)));
+        if (!grown) {
+            return false;
+        }
+        Mod.samples = grown;
+
+        // The sample headers come first, then all their data
+        uint32_t data = pos + samples * headerSize;
+        for (uint16_t n = 0; n < samples; n++) {
+            Sample &s = Mod.samples[Mod.numberOfSamples++];
+            memset(&s, 0, sizeof(s));
+            memset(buffer, 0, 40);
+            if (!file->seek(pos + n * headerSize, SEEK_SET) || !file->read(buffer, min(headerSize, (uint32_t)40))) {
+                return false;
+            }
+            uint8_t type = buffer[14];
+            uint32_t bytes = (type & 0x10) ? 2 : 1;
+            s.length = DWord(buffer) / bytes;
+            s.loopBegin = DWord(buffer + 4) / bytes;
+            s.loopLength = DWord(buffer + 8) / bytes;
+            s.volume = min(buffer[12], 64);
+            s.fineTune = buffer[13];
+            s.panning = buffer[15];
+            s.relativeNote = buffer[16];
+            s.c2spd = 8363;
+            s.offset = data;
+            s.flags = SAMPLE_DELTA | ((type & 0x10) ? SAMPLE_16BIT : 0) | (((type & 3) == 2) ? SAMPLE_PINGPONG : 0);
+            if (!(type & 3) || (s.loopBegin >= s.length)) {
+                s.loopLength = 0;
+            }
+            if (s.loopBegin + s.loopLength > s.length) {
+                s.loopLength = s.length - s.loopBegin;
+            }
+            if (!s.loopLength) {
+                s.loopBegin = 0;
+            }
+            data += DWord(buffer);
+        }
+        pos = data;
+    }
+    return true;
+}
+
+bool AudioGeneratorMOD::LoadS3M() {
+    uint8_t header[0x60];
+    uint8_t buffer[0x24];
+    uint16_t i;
+
+    if (sizeof(header) != file->read(header, sizeof(header))) {
+        return false;
+    }
+    uint16_t orders = min(Word(header + 0x20), 256);
+    uint16_t instruments = Word(header + 0x22);
+    uint16_t patterns = min(Word(header + 0x24), 256);
+    bool isUnsigned = Word(header + 0x2A) == 2;
+    Mod.initialGlobalVolume = min(header[0x30], 64);
+    Mod.initialSpeed = header[0x31];
+    Mod.initialTempo = header[0x32];
+    Mod.linear = false;
+
+    // Channels 0-7 are on the left and 8-15 on the right, the rest are off
+    Mod.numberOfChannels = 0;
+    for (i = 0; i < 32; i++) {
+        uint8_t setting = header[0x40 + i];
+        if (setting < 16) {
+            Mod.numberOfChannels = i + 1;
+        }
+        if (i < CHANNELS) {
+            Mod.initialPanning[i] = !(header[0x33] & 0x80) ? 128 : (setting < 8) ? 51 : 204;
+        }
+    }
+    if (!Mod.numberOfChannels) {
+        return false;
+    }
+    if (Mod.numberOfChannels > CHANNELS) {
+        audioLogger->printf("\nAudioGeneratorMOD::LoadS3M abort - too many channels (configured: %d, needed: %d)\n", CHANNELS, Mod.numberOfChannels);
+        return false;
+    }
+
+    // Orders, skipping the "+++" markers and stopping at the end one
+    Mod.songLength = 0;
+    for (i = 0; i < orders; i++) {
+        uint8_t order;
+        if (1 != file->read(&order, 1)) {
+            return false;
+        }
+        if (order == 255) {
+            orders = i + 1;
+            break;
+        }
+        if (order != 254) {
+            Mod.order[Mod.songLength++] = order;
+        }
+    }
+    if (!Mod.songLength || !file->seek(0x60 + Word(header + 0x20), SEEK_SET)) {
+        return false;
+    }
+
+    uint16_t *pointers = reinterpret_cast<uint16_t*>(malloc((instruments + patterns + 1) * sizeof(uint16_t)));
+    if (!pointers) {
+        return false;
+    }
+    for (i = 0; i < instruments + patterns; i++) {
+        if (2 != file->read(buffer, 2)) {
+            free(pointers);
+            return false;
+        }
+        pointers[i] = Word(buffer);
+    }
+    if (header[0x35] == 0xFC) {
+        // Default panning, for the channels which have one
+        for (i = 0; i < 32; i++) {
+            if ((1 == file->read(buffer, 1)) && (buffer[0] & 0x20) && (i < CHANNELS) && (header[0x33] & 0x80)) {
+                Mod.initialPanning[i] = (buffer[0] & 15) * 17;
+            }
+        }
+    }
+
+    Mod.numberOfSamples = instruments;
+    Mod.samples = reinterpret_cast<Sample*>(calloc(instruments + 1, sizeof(Sample)));
+    Mod.numberOfPatterns = patterns;
+    Mod.patternOffset = reinterpret_cast<uint32_t*>(calloc(patterns + 1, sizeof(uint32_t)));
+    Mod.patternSize = reinterpret_cast<uint16_t*>(calloc(patterns + 1, sizeof(uint16_t)));
+    bool ok = Mod.samples && Mod.patternOffset && Mod.patternSize;
+
+    for (i = 0; ok && (i < instruments); i++) {
+        Sample &s = Mod.samples[i];
+        if (!file->seek(pointers[i] * 16, SEEK_SET) || (sizeof(buffer) != file->read(buffer, sizeof(buffer)))) {
+            ok = false;
+            break;
+        }
+        if (buffer[0] != 1) {
+            continue;    // Not a sample, so silent
+        }
+        uint32_t loopEnd = DWord(buffer + 0x18);
+        s.offset = ((buffer[0x0D] << 16) | Word(buffer + 0x0E)) * 16;
+        s.length = DWord(buffer + 0x10);
+        s.loopBegin = DWord(buffer + 0x14);
+        s.volume = min(buffer[0x1C], 64);
+        s.c2spd = DWord(buffer + 0x20) ? DWord(buffer + 0x20) : 8363;
+        s.panning = 128;
+        s.flags = ((buffer[0x1F] & 4) ? SAMPLE_16BIT : 0) | (isUnsigned ? SAMPLE_UNSIGNED : 0);
+        if (loopEnd > s.length) {
+            loopEnd = s.length;
+        }
+        if ((buffer[0x1F] & 1) && (loopEnd > s.loopBegin)) {
+            s.loopLength = loopEnd - s.loopBegin;
+        } else {
+            s.loopBegin = 0;
+        }
+    }
+
+    // Patterns are always 64 rows, after their packed length
+    for (i = 0; ok && (i < patterns); i++) {
+        uint32_t pos = pointers[instruments + i] * 16;
+        if (!pos) {
+            continue;
+        }
+        if (!file->seek(pos, SEEK_SET) || (2 != file->read(buffer, 2))) {
+            ok = false;
+            break;
+        }
+        Mod.patternOffset[i] = pos + 2;
+        Mod.patternSize[i] = Word(buffer);
+    }
+    free(pointers);
+    return ok;
+}
+
+// XM samples are delta coded, so reading one from the middle needs the value just before.  Keeping one every
+// FatBuffer.stride frames takes a single pass through the data now, instead of one each time the cache misses.
+bool AudioGeneratorMOD::BuildCheckpoints() {
+    uint32_t total = 0;
+    uint16_t i;
+
+    for (i = 0; i < Mod.numberOfSamples; i++) {
+        Sample &s = Mod.samples[i];
+        if (s.flags & SAMPLE_DELTA) {
+            s.checkpoint = total;
+            total += s.length / FatBuffer.stride + 1;
+        }
+    }
+    if (!total) {
+        return true;
+    }
+    Mod.checkpoints = reinterpret_cast<int16_t*>(malloc(total * sizeof(int16_t)));
+    if (!Mod.checkpoints || !FatBuffer.count) {
+        return false;
+    }
+
+    // Slot 0 is empty until playing starts, so it's somewhere to read into
+    uint8_t *scratch = FatBuffer.slots[0];
+    for (i = 0; i < Mod.numberOfSamples; i++) {
+        const Sample &s = Mod.samples[i];
+        if (!(s.flags & SAMPLE_DELTA)) {
+            continue;
+        }
+        int16_t *checkpoint = Mod.checkpoints + s.checkpoint;
+        uint32_t bytes = (s.flags & SAMPLE_16BIT) ? 2 : 1;
+        uint32_t from = s.offset;
+        uint32_t frame = 0;
+        uint32_t next = 0;
+        int16_t value = 0;
+        if (!mem && !file->seek(from, SEEK_SET)) {
+            return false;
+        }
+        while (frame < s.length) {
+            uint32_t want = min((s.length - frame) * bytes, FatBuffer.size);
+            uint32_t got = 0;
+            if (mem) {
+                if (from < memSize) {
+                    got = min(memSize - from, want);
+                    memcpy(scratch, mem + from, got);
+                }
+            } else {
+                got = file->read(scratch, want);
+            }
+            got /= bytes;
+            if (!got) {
+                break;    // Truncated, the rest will be silent
+            }
+            for (uint32_t n = 0; n < got; n++, frame++) {
+                if (frame == next * FatBuffer.stride) {
+                    checkpoint[next++] = value;
+                }
+                if (bytes == 2) {
+                    value += reinterpret_cast<int16_t*>(scratch)[n];
+                } else {
+                    value = (int8_t)(value + reinterpret_cast<int8_t*>(scratch)[n]);
+                }
+            }
+            from += got * bytes;
+        }
+        while (next <= s.length / FatBuffer.stride) {
+            checkpoint[next++] = value;
+        }
+    }
+    return true;
+}
+
+// Decodes a row into Player.currentRow.  Rows are packed, so finding one means reading those before it, but
+// playing on from the last row decoded carries on from where it ended.
+bool AudioGeneratorMOD::DecodeTrackerRow(uint16_t pattern, uint16_t row) {
+    uint8_t channel;
+
+    memset(Player.currentRow, 0, sizeof(Player.currentRow));
+    if (pattern >= Mod.numberOfPatterns || !Mod.patternSize[pattern]) {
+        return true;    // Missing or empty
+    }
+
+    uint32_t end = Mod.patternOffset[pattern] + Mod.patternSize[pattern];
+    uint32_t offset = Mod.patternOffset[pattern];
+    uint16_t at = 0;
+    if (Player.rowPattern == pattern && Player.rowNumber == row) {
+        offset = Player.rowOffset;
+        at = row;
+    }
+
+    for (; at <= row; at++) {
+        if (offset >= end) {
+            memset(Player.currentRow, 0, sizeof(Player.currentRow));
+            break;
+        }
+        uint32_t len = min(end - offset, (uint32_t)PATTERNBUFFER);
+        const uint8_t *p = PatternData(offset, len);
+        if (!p) {
+            return false;
+        }
+        const uint8_t *q = p;
+        const uint8_t *last = p + len;
+        memset(Player.currentRow, 0, sizeof(Player.currentRow));
+
+        if (Mod.format == FORMAT_XM) {
+            for (channel = 0; channel < Mod.numberOfChannels && q < last; channel++) {
+                cell &c = Player.currentRow[channel];
+                uint8_t what = *q++;
+                if (what & 0x80) {
+                    c.note = (what & 1) ? Next(q, last) : 0;
+                    c.sampleNumber = (what & 2) ? Next(q, last) : 0;
+                    c.volume = (what & 4) ? Next(q, last) : 0;
+                    c.effectNumber = (what & 8) ? Next(q, last) : 0;
+                    c.effectParameter = (what & 16) ? Next(q, last) : 0;
+                } else {
+                    c.note = what;
+                    c.sampleNumber = Next(q, last);
+                    c.volume = Next(q, last);
+                    c.effectNumber = Next(q, last);
+                    c.effectParameter = Next(q, last);
+                }
+                if (c.note > KEYOFF) {
+                    c.note = 0;
+                }
+            }
+        } else {
+            uint8_t what;
+            while ((what = Next(q, last))) {
+                cell c = {0, 0, 0, 0, 0};
+                if (what & 32) {
+                    uint8_t note = Next(q, last);
+                    c.sampleNumber = Next(q, last);
+                    if (note == 254) {
+                        c.note = CUTNOTE;
+                    } else if (note < 254) {
+                        c.note = min((note >> 4) * 12 + (note & 15) + 1, 96);
+                    }
+                }
+                if (what & 64) {
+                    uint8_t volume = Next(q, last);
+                    c.volume = (volume <= 64) ? 0x10 + volume : 0;
+                }
+                if (what & 128) {
+                    uint8_t command = Next(q, last);
+                    uint8_t info = Next(q, last);
+                    uint8_t x = info >> 4;
+                    uint8_t y = info & 15;
+                    c.effectParameter = info;
+                    switch (command + '@') {
+                    case 'A':
+                        c.effectNumber = info ? SETSPEED : 0;
+                        c.effectParameter = min(info, 31);
+                        break;
+                    case 'B':
+                        c.effectNumber = JUMPTOORDER;
+                        break;
+                    case 'C':
+                        c.effectNumber = BREAKPATTERNTOROW;
+                        break;
+                    case 'D':
+                    case 'K':
+                    case 'L':
+                        if ((x == 0xF) && y) {
+                            c.effectNumber = ESUBSET;
+                            c.effectParameter = (FINEVOLUMESLIDEDOWN << 4) | y;
+                        } else if ((y == 0xF) && x) {
+                            c.effectNumber = ESUBSET;
+                            c.effectParameter = (FINEVOLUMESLIDEUP << 4) | x;
+                        } else {
+                            c.effectNumber = VOLUMESLIDE;
+                        }
+                        if (command + '@' == 'K') {
+                            c.effectNumber = VIBRATOVOLUMESLIDE;
+                        } else if (command + '@' == 'L') {
+                            c.effectNumber = PORTAMENTOVOLUMESLIDE;
+                        }
+                        break;
+                    case 'E':
+                    case 'F':
+                        if (x == 0xF) {
+                            c.effectNumber = ESUBSET;
+                            c.effectParameter = ((command + '@' == 'E') ? (FINEPORTAMENTODOWN << 4) : (FINEPORTAMENTOUP << 4)) | y;
+                        } else if (x == 0xE) {
+                            c.effectNumber = EXTRAFINEPORTAMENTO;
+                            c.effectParameter = ((command + '@' == 'E') ? 0x20 : 0x10) | y;
+                        } else {
+                            c.effectNumber = (command + '@' == 'E') ? PORTAMENTODOWN : PORTAMENTOUP;
+                        }
+                        break;
+                    case 'G':
+                        c.effectNumber = TONEPORTAMENTO;
+                        break;
+                    case 'H':
+                        c.effectNumber = VIBRATO;
+                        break;
+                    case 'U':
+                        c.effectNumber = VIBRATO;
+                        c.effectParameter = (x << 4) | ((y + 3) / 4);
+                        break;
+                    case 'I':
+                        c.effectNumber = TREMOR;
+                        break;
+                    case 'J':
+                        c.effectNumber = ARPEGGIO;
+                        break;
+                    case 'O':
+                        c.effectNumber = SETSAMPLEOFFSET;
+                        break;
+                    case 'Q':
+                        c.effectNumber = MULTIRETRIGGER;
+                        break;
+                    case 'R':
+                        c.effectNumber = TREMOLO;
+                        break;
+                    case 'S':
+                        c.effectNumber = ESUBSET;
+                        switch (x) {
+                        case 0x1:
+                            c.effectParameter = (GLISSANDOCONTROL << 4) | y;
+                            break;
+                        case 0x2:
+                            c.effectParameter = (SETFINETUNE << 4) | y;
+                            break;
+                        case 0x3:
+                            c.effectParameter = (SETVIBRATOWAVEFORM << 4) | y;
+                            break;
+                        case 0x4:
+                            c.effectParameter = (SETTREMOLOWAVEFORM << 4) | y;
+                            break;
+                        case 0x8:
+                            c.effectNumber = SETCHANNELPANNING;
+                            c.effectParameter = y * 17;
+                            break;
+                        case 0xB:
+                            c.effectParameter = (PATTERNLOOP << 4) | y;
+                            break;
+                        case 0xC:
+                            c.effectParameter = (NOTECUT << 4) | y;
+                            break;
+                        case 0xD:
+                            c.effectParameter = (NOTEDELAY << 4) | y;
+                            break;
+                        case 0xE:
+                            c.effectParameter = (PATTERNDELAY << 4) | y;
+                            break;
+                        default:
+                            c.effectNumber = 0;
+                            c.effectParameter = 0;
+                        }
+                        break;
+                    case 'T':
+                        c.effectNumber = (info >= 0x20) ? SETSPEED : 0;
+                        break;
+                    case 'V':
+                        c.effectNumber = SETGLOBALVOLUME;
+                        break;
+                    case 'X':
+                        c.effectNumber = (info <= 0x80) ? SETCHANNELPANNING : 0;
+                        c.effectParameter = min(info * 2, 255);
+                        break;
+                    default:
+                        c.effectParameter = 0;
+                    }
+                }
+                if ((what & 31) < Mod.numberOfChannels) {
+                    Player.currentRow[what & 31] = c;
+                }
+            }
+        }
+        offset += q - p;
+    }
+
+    Player.rowPattern = pattern;
+    Player.rowNumber = row + 1;
+    Player.rowOffset = offset;
+    return true;
+}
+
+// Period for a note, counting from 1 (C-0), played by a sample
+int32_t AudioGeneratorMOD::NotePeriod(uint8_t note, uint16_t sampleNumber) {
+    const Sample &s = Mod.samples[sampleNumber];
+    int32_t fine = (note - 1 + s.relativeNote) * 64 + s.fineTune / 2;
+
+    if (Mod.linear) {
+        return 7680 - fine;
+    }
+    // 1712 plays c2spd at C-4
+    uint64_t hz = (uint64_t)s.c2spd * Pow2(fine - 48 * 64);
+    int32_t period = hz ? ((uint64_t)1712 * 8363 << 16) / hz : 0;
+    return period ? period : 1;
+}
+
+// Mixer step for a period, raised by some semitones for arpeggio
+uint32_t AudioGeneratorMOD::PeriodStep(int32_t period, uint8_t semitones) {
+    uint64_t hz;    // 16.16
+
+    if (Mod.linear) {
+        hz = 8363 * Pow2(4608 - period + semitones * 64);
+    } else {
+        hz = ((uint64_t)1712 * 8363 << 16) / ((period < 1) ? 1 : period);
+        if (semitones) {
+            hz = hz * Pow2(semitones * 64) >> 16;
+        }
+    }
+    uint64_t step = ((hz << FIXED_DIVIDER) / sampleRate) >> 16;
+    return (step > 0xFFFF) ? 0xFFFF : step;
+}
+
+void AudioGeneratorMOD::KeyOff(uint8_t channel) {
+    voice &v = Voices[channel];
+
+    v.keyOn = false;
+    // Without a volume envelope to fade out there's nothing to release, so the note just stops
+    if (!Mod.instruments || !v.instrument || (v.instrument > Mod.numberOfInstruments) ||
+            !(Mod.instruments[v.instrument - 1].volumeEnvelope.flags & 1)) {
+        v.volume = 0;
+    }
+}
+
+// Starts whatever the cell has for the channel: a note, an instrument, a key off, or the volume column's volume
+// or panning
+void AudioGeneratorMOD::TriggerCell(uint8_t channel) {
+    const cell &c = Player.currentRow[channel];
+    voice &v = Voices[channel];
+    uint16_t sampleNumber = Mixer.channelSampleNumber[channel];
+    bool portamento = (c.effectNumber == TONEPORTAMENTO) || (c.effectNumber == PORTAMENTOVOLUMESLIDE) || (c.volume >= 0xF0);
+
+    if (c.note == KEYOFF) {
+        KeyOff(channel);
+    } else if (c.note == CUTNOTE) {
+        v.volume = 0;
+    }
+    if (c.sampleNumber) {
+        v.instrument = c.sampleNumber;
+    }
+
+    if (c.note && (c.note <= 96)) {
+        uint16_t found = NOSAMPLE;
+        if (Mod.instruments) {
+            if (v.instrument && (v.instrument <= Mod.numberOfInstruments)) {
+                const Instrument &ins = Mod.instruments[v.instrument - 1];
+                if (ins.sampleMap[c.note - 1] != 0xFF) {
+                    found = ins.firstSample + ins.sampleMap[c.note - 1];
+                }
+            }
+        } else if (v.instrument && (v.instrument <= Mod.numberOfSamples)) {
+            found = v.instrument - 1;
+        }
+
+        if (portamento && v.period && (sampleNumber < Mod.numberOfSamples)) {
+            v.targetPeriod = NotePeriod(c.note, sampleNumber);
+        } else if (found < Mod.numberOfSamples) {
+            sampleNumber = found;
+            v.note = c.note - 1;
+            v.period = NotePeriod(c.note, sampleNumber);
+            v.targetPeriod = v.period;
+            Mixer.channelSampleNumber[channel] = sampleNumber;
+            Mixer.channelSampleOffset[channel] = min(v.startOffset, Mod.samples[sampleNumber].length) << FIXED_DIVIDER;
+            if (!(v.waveControl & 0x04)) {
+                v.vibratoPos = 0;
+            }
+            if (!(v.waveControl & 0x40)) {
+                v.tremoloPos = 0;
+            }
+            v.retriggerCount = 0;
+            v.tremorCount = 0;
+            v.keyOn = true;
+            v.fadeout = 32768;
+            v.volumeEnvelopeTick = 0;
+            v.panningEnvelopeTick = 0;
+            v.autoVibratoPos = 0;
+            v.autoVibratoSweep = 0;
+        } else {
+            v.period = 0;    // No sample for this note, so it's silent
+        }
+    }
+
+    if (c.sampleNumber && (sampleNumber < Mod.numberOfSamples)) {
+        // An instrument on its own restarts the envelopes and sets the volume back
+        v.volume = Mod.samples[sampleNumber].volume;
+        if (Mod.format == FORMAT_XM) {
+            v.panning = Mod.samples[sampleNumber].panning;
+        }
+        v.keyOn = true;
+        v.fadeout = 32768;
+        v.volumeEnvelopeTick = 0;
+        v.panningEnvelopeTick = 0;
+    }
+
+    if ((c.volume >= 0x10) && (c.volume <= 0x50)) {
+        v.volume = c.volume - 0x10;
+    } else if ((c.volume & 0xF0) == 0xC0) {
+        v.panning = (c.volume & 15) * 17;
+    }
+}
+
+void AudioGeneratorMOD::VolumeSlide(uint8_t channel, uint8_t parameter) {
+    voice &v = Voices[channel];
+    int16_t volume = v.volume + ((parameter >> 4) ? (parameter >> 4) : -(parameter & 15));
+
+    v.volume = (volume < 0) ? 0 : (volume > 64) ? 64 : volume;
+}
+
+void AudioGeneratorMOD::PeriodSlide(uint8_t channel, int32_t delta) {
+    voice &v = Voices[channel];
+
+    if (v.period) {
+        v.period += delta;
+        v.period = (v.period < 1) ? 1 : (v.period > 0xFFFF) ? 0xFFFF : v.period;
+    }
+}
+
+void AudioGeneratorMOD::TonePortamento(uint8_t channel) {
+    voice &v = Voices[channel];
+    int32_t speed = v.portamentoSpeed * 4;
+
+    if (!v.period || !v.targetPeriod) {
+        return;
+    }
+    if (v.period < v.targetPeriod) {
+        v.period = min(v.period + speed, v.targetPeriod);
+    } else if (v.period > v.targetPeriod) {
+        v.period = (v.period - speed > v.targetPeriod) ? v.period - speed : v.targetPeriod;
+    }
+}
+
+void AudioGeneratorMOD::TrackerVibrato(uint8_t channel) {
+    voice &v = Voices[channel];
+
+    v.periodDelta = Waveform(v.waveControl & 3, v.vibratoPos) * v.vibratoDepth >> 5;
+    v.vibratoPos = (v.vibratoPos + v.vibratoSpeed) & 63;
+}
+
+void AudioGeneratorMOD::TrackerTremolo(uint8_t channel) {
+    voice &v = Voices[channel];
+
+    v.volumeDelta = Waveform((v.waveControl >> 4) & 3, v.tremoloPos) * v.tremoloDepth >> 6;
+    v.tremoloPos = (v.tremoloPos + v.tremoloSpeed) & 63;
+}
+
+bool AudioGeneratorMOD::ProcessTrackerRow() {
+    uint8_t channel;
+    bool jump = false;
+    bool patternBreak = false;
+    uint16_t jumpOrder = 0;
+    uint16_t breakRow = 0;
+
+    if (!running) {
+        return false;
+    }
+
+    Player.lastRow = Player.row++;
+    for (channel = 0; channel < Mod.numberOfChannels; channel++) {
+        const cell &c = Player.currentRow[channel];
+        voice &v = Voices[channel];
+        uint8_t x = c.effectParameter >> 4;
+        uint8_t y = c.effectParameter & 15;
+
+        v.semitones = 0;
+        v.periodDelta = 0;
+        v.volumeDelta = 0;
+        if (c.effectNumber != TREMOR) {
+            v.tremorOff = false;
+        }
+
+        v.startOffset = 0;
+        if (c.effectNumber == SETSAMPLEOFFSET) {
+            if (c.effectParameter) {
+                v.sampleOffset = c.effectParameter;
+            }
+            v.startOffset = v.sampleOffset << 8;
+        }
+        if (!(c.effectNumber == ESUBSET && x == NOTEDELAY && y)) {
+            TriggerCell(channel);
+        }
+
+        switch (c.volume & 0xF0) {
+        case 0x80:
+            VolumeSlide(channel, c.volume & 15);
+            break;
+        case 0x90:
+            VolumeSlide(channel, (c.volume & 15) << 4);
+            break;
+        case 0xA0:
+            v.vibratoSpeed = c.volume & 15;
+            break;
+        case 0xB0:
+            if (c.volume & 15) {
+                v.vibratoDepth = c.volume & 15;
+            }
+            break;
+        case 0xF0:
+            if (c.volume & 15) {
+                v.portamentoSpeed = (c.volume & 15) << 4;
+            }
+            break;
+        }
+
+        switch (c.effectNumber) {
+        case PORTAMENTOUP:
+            if (c.effectParameter) {
+                v.portamentoUp = c.effectParameter;
+            }
+            break;
+
+        case PORTAMENTODOWN:
+            if (c.effectParameter) {
+                v.portamentoDown = c.effectParameter;
+            }
+            break;
+
+        case TONEPORTAMENTO:
+            if (c.effectParameter) {
+                v.portamentoSpeed = c.effectParameter;
+            }
+            break;
+
+        case VIBRATO:
+            if (x) {
+                v.vibratoSpeed = x;
+            }
+            if (y) {
+                v.vibratoDepth = y;
+            }
+            break;
+
+        case PORTAMENTOVOLUMESLIDE:
+        case VIBRATOVOLUMESLIDE:
+        case VOLUMESLIDE:
+            if (c.effectParameter) {
+                v.volumeSlide = c.effectParameter;
+            }
+            break;
+
+        case TREMOLO:
+            if (x) {
+                v.tremoloSpeed = x;
+            }
+            if (y) {
+                v.tremoloDepth = y;
+            }
+            break;
+
+        case SETCHANNELPANNING:
+            v.panning = c.effectParameter;
+            break;
+
+        case JUMPTOORDER:
+            jump = true;
+            jumpOrder = c.effectParameter;
+            break;
+
+        case SETVOLUME:
+            v.volume = min(c.effectParameter, 64);
+            break;
+
+        case BREAKPATTERNTOROW:
+            patternBreak = true;
+            breakRow = x * 10 + y;
+            break;
+
+        case ESUBSET:
+            switch (x) {
+            case FINEPORTAMENTOUP:
+                if (y) {
+                    v.finePortamentoUp = y;
+                }
+                PeriodSlide(channel, -4 * v.finePortamentoUp);
+                break;
+
+            case FINEPORTAMENTODOWN:
+                if (y) {
+                    v.finePortamentoDown = y;
+                }
+                PeriodSlide(channel, 4 * v.finePortamentoDown);
+                break;
+
+            case SETVIBRATOWAVEFORM:
+                v.waveControl = (v.waveControl & 0xF0) | y;
+                break;
+
+            case PATTERNLOOP:
+                if (y) {
+                    if (Player.patternLoopCount[channel]) {
+                        Player.patternLoopCount[channel]--;
+                    } else {
+                        Player.patternLoopCount[channel] = y;
+                    }
+                    if (Player.patternLoopCount[channel]) {
+                        Player.row = Player.patternLoopRow[channel];
+                    }
+                } else {
+                    Player.patternLoopRow[channel] = Player.lastRow;
+                }
+                break;
+
+            case SETTREMOLOWAVEFORM:
+                v.waveControl = (v.waveControl & 0x0F) | (y << 4);
+                break;
+
+            case FINEVOLUMESLIDEUP:
+                if (y) {
+                    v.fineVolumeSlideUp = y;
+                }
+                VolumeSlide(channel, v.fineVolumeSlideUp << 4);
+                break;
+
+            case FINEVOLUMESLIDEDOWN:
+                if (y) {
+                    v.fineVolumeSlideDown = y;
+                }
+                VolumeSlide(channel, v.fineVolumeSlideDown);
+                break;
+
+            case NOTECUT:
+                if (!y) {
+                    v.volume = 0;
+                }
+                break;
+
+            case PATTERNDELAY:
+                Player.patternDelay = y;
+                break;
+            }
+            break;
+
+        case SETSPEED:
+            if (c.effectParameter >= 0x20) {
+                Player.samplesPerTick = sampleRate * 5 / (2 * c.effectParameter);
+            } else if (c.effectParameter) {
+                Player.speed = c.effectParameter;
+            }
+            break;
+
+        case SETGLOBALVOLUME:
+            Player.globalVolume = min(c.effectParameter, 64);
+            break;
+
+        case GLOBALVOLUMESLIDE:
+            if (c.effectParameter) {
+                v.globalVolumeSlide = c.effectParameter;
+            }
+            break;
+
+        case KEYOFFEFFECT:
+            if (!c.effectParameter) {
+                KeyOff(channel);
+            }
+            break;
+
+        case SETENVELOPEPOSITION:
+            v.volumeEnvelopeTick = c.effectParameter;
+            v.panningEnvelopeTick = c.effectParameter;
+            break;
+
+        case PANNINGSLIDE:
+            if (c.effectParameter) {
+                v.panningSlide = c.effectParameter;
+            }
+            break;
+
+        case MULTIRETRIGGER:
+            if (c.effectParameter) {
+                v.retrigger = c.effectParameter;
+            }
+            break;
+
+        case TREMOR:
+            if (c.effectParameter) {
+                v.tremor = c.effectParameter;
+            }
+            break;
+
+        case EXTRAFINEPORTAMENTO:
+            if (x == 1) {
+                if (y) {
+                    v.extraFinePortamentoUp = y;
+                }
+                PeriodSlide(channel, -v.extraFinePortamentoUp);
+            } else if (x == 2) {
+                if (y) {
+                    v.extraFinePortamentoDown = y;
+                }
+                PeriodSlide(channel, v.extraFinePortamentoDown);
+            }
+            break;
+        }
+    }
+
+    if (jump || patternBreak) {
+        uint16_t order = jump ? jumpOrder : Player.orderIndex + 1;
+        if (order >= Mod.songLength) {
+            // Past the end, so finish after this row
+            Player.orderIndex = Mod.songLength - 1;
+            Player.row = 0xFFFF;
+        } else {
+            uint8_t pattern = Mod.order[order];
+            uint16_t rows = (Mod.patternRows && pattern < Mod.numberOfPatterns) ? Mod.patternRows[pattern] : ROWS;
+            Player.orderIndex = order;
+            Player.row = (patternBreak && breakRow < rows) ? breakRow : 0;
+        }
+    }
+    return true;
+}
+
+bool AudioGeneratorMOD::ProcessTrackerTick() {
+    uint8_t channel;
+
+    if (!running) {
+        return false;
+    }
+
+    for (channel = 0; channel < Mod.numberOfChannels; channel++) {
+        const cell &c = Player.currentRow[channel];
+        voice &v = Voices[channel];
+        uint8_t x = c.effectParameter >> 4;
+        uint8_t y = c.effectParameter & 15;
+
+        v.semitones = 0;
+
+        switch (c.volume & 0xF0) {
+        case 0x60:
+            VolumeSlide(channel, c.volume & 15);
+            break;
+        case 0x70:
+            VolumeSlide(channel, (c.volume & 15) << 4);
+            break;
+        case 0xB0:
+            TrackerVibrato(channel);
+            break;
+        case 0xD0:
+            v.panning = (v.panning > (c.volume & 15)) ? v.panning - (c.volume & 15) : 0;
+            break;
+        case 0xE0:
+            v.panning = min(v.panning + (c.volume & 15), 255);
+            break;
+        case 0xF0:
+            TonePortamento(channel);
+            break;
+        }
+
+        switch (c.effectNumber) {
+        case ARPEGGIO:
+            if (c.effectParameter) {
+                v.semitones = (Player.tick % 3 == 1) ? x : (Player.tick % 3 == 2) ? y : 0;
+            }
+            break;
+
+        case PORTAMENTOUP:
+            PeriodSlide(channel, -4 * v.portamentoUp);
+            break;
+
+        case PORTAMENTODOWN:
+            PeriodSlide(channel, 4 * v.portamentoDown);
+            break;
+
+        case TONEPORTAMENTO:
+            TonePortamento(channel);
+            break;
+
+        case VIBRATO:
+            TrackerVibrato(channel);
+            break;
+
+        case PORTAMENTOVOLUMESLIDE:
+            TonePortamento(channel);
+            VolumeSlide(channel, v.volumeSlide);
+            break;
+
+        case VIBRATOVOLUMESLIDE:
+            TrackerVibrato(channel);
+            VolumeSlide(channel, v.volumeSlide);
+            break;
+
+        case TREMOLO:
+            TrackerTremolo(channel);
+            break;
+
+        case VOLUMESLIDE:
+            VolumeSlide(channel, v.volumeSlide);
+            break;
+
+        case ESUBSET:
+            switch (x) {
+            case RETRIGGERNOTE:
+                if (y && !(Player.tick % y)) {
+                    Mixer.channelSampleOffset[channel] = 0;
+                }
+                break;
+
+            case NOTECUT:
+                if (Player.tick == y) {
+                    v.volume = 0;
+                }
+                break;
+
+            case NOTEDELAY:
+                if (Player.tick == y) {
+                    TriggerCell(channel);
+                }
+                break;
+            }
+            break;
+
+        case GLOBALVOLUMESLIDE: {
+            int16_t volume = Player.globalVolume + ((v.globalVolumeSlide >> 4) ? (v.globalVolumeSlide >> 4) : -(v.globalVolumeSlide & 15));
+            Player.globalVolume = (volume < 0) ? 0 : (volume > 64) ? 64 : volume;
+            break;
+        }
+
+        case KEYOFFEFFECT:
+            if (Player.tick == c.effectParameter) {
+                KeyOff(channel);
+            }
+            break;
+
+        case PANNINGSLIDE: {
+            int16_t panning = v.panning + ((v.panningSlide >> 4) ? (v.panningSlide >> 4) : -(v.panningSlide & 15));
+            v.panning = (panning < 0) ? 0 : (panning > 255) ? 255 : panning;
+            break;
+        }
+
+        case MULTIRETRIGGER:
+            if ((v.retrigger & 15) && (++v.retriggerCount >= (v.retrigger & 15))) {
+                int16_t volume = v.volume;
+                v.retriggerCount = 0;
+                Mixer.channelSampleOffset[channel] = 0;
+                switch (v.retrigger >> 4) {
+                case 0x6:
+                    volume = volume * 2 / 3;
+                    break;
+                case 0x7:
+                    volume /= 2;
+                    break;
+                case 0xE:
+                    volume = volume * 3 / 2;
+                    break;
+                case 0xF:
+                    volume *= 2;
+                    break;
+                default:
+                    volume += (int8_t)pgm_read_byte(retriggerVolume + (v.retrigger >> 4));
+                }
+                v.volume = (volume < 0) ? 0 : (volume > 64) ? 64 : volume;
+            }
+            break;
+
+        case TREMOR:
+            // On for x + 1 ticks, then off for y + 1
+            v.tremorOff = v.tremorCount > (v.tremor >> 4);
+            if (++v.tremorCount > (v.tremor >> 4) + (v.tremor & 15) + 1) {
+                v.tremorCount = 0;
+            }
+            break;
+        }
+    }
+    return true;
+}
+
+// Works out what each channel sounds like this tick, from its volume, envelopes, fadeout, panning and pitch
+void AudioGeneratorMOD::UpdateVoices() {
+    uint8_t channel;
+
+    for (channel = 0; channel < Mod.numberOfChannels; channel++) {
+        voice &v = Voices[channel];
+        uint16_t sampleNumber = Mixer.channelSampleNumber[channel];
+
+        if (sampleNumber >= Mod.numberOfSamples || !v.period) {
+            Mixer.channelFrequency[channel] = 0;
+            Mixer.channelGainLeft[channel] = 0;
+            Mixer.channelGainRight[channel] = 0;
+            continue;
+        }
+        const Sample &s = Mod.samples[sampleNumber];
+        const Instrument *ins = NULL;
+        if (Mod.instruments && v.instrument && (v.instrument <= Mod.numberOfInstruments)) {
+            ins = &Mod.instruments[v.instrument - 1];
+        }
+
+        // Envelopes hold at their sustain point until the key is let go, and go round their loop
+        uint8_t envelope[2] = {64, 32};
+        for (uint8_t e = 0; ins && (e < 2); e++) {
+            const Envelope &env = e ? ins->panningEnvelope : ins->volumeEnvelope;
+            uint16_t &tick = e ? v.panningEnvelopeTick : v.volumeEnvelopeTick;
+            if (!(env.flags & 1)) {
+                continue;
+            }
+            uint8_t point = 0;
+            while ((point + 1 < env.points) && (tick >= env.x[point + 1])) {
+                point++;
+            }
+            if ((point + 1 < env.points) && (env.x[point + 1] > env.x[point])) {
+                envelope[e] = env.y[point] + (env.y[point + 1] - env.y[point]) * (int32_t)(tick - env.x[point]) / (env.x[point + 1] - env.x[point]);
+            } else {
+                envelope[e] = env.y[point];
+            }
+            if (!(v.keyOn && (env.flags & 2) && (tick == env.x[env.sustain]))) {
+                if (tick < env.x[env.points - 1]) {
+                    tick++;
+                }
+                if ((env.flags & 4) && (tick >= env.x[env.loopEnd])) {
+                    tick = env.x[env.loopBegin];
+                }
+            }
+        }
+        if (ins && !v.keyOn) {
+            uint16_t fade = (ins->fadeout + 1) / 2;
+            v.fadeout = (v.fadeout > fade) ? v.fadeout - fade : 0;
+        }
+
+        int16_t volume = v.tremorOff ? 0 : v.volume + v.volumeDelta;
+        volume = (volume < 0) ? 0 : (volume > 64) ? 64 : volume;
+        uint32_t gain = ((uint32_t)volume * envelope[0] * Player.globalVolume >> 6) * v.fadeout >> 15;    // 0..4096
+
+        // The panning envelope swings as far as there is room to, then stereo separation narrows it like a MOD
+        int32_t panning = v.panning;
+        if (envelope[1] != 32) {
+            int32_t room = 128 - ((panning > 128) ? panning - 128 : 128 - panning);
+            panning += (envelope[1] - 32) * room / 32;
+            panning = (panning < 0) ? 0 : (panning > 255) ? 255 : panning;
+        }
+        int32_t pan = stereoSeparation + panning * (128 - 2 * stereoSeparation) / 255;
+        Mixer.channelGainLeft[channel] = gain * min(128 - pan, 64) >> 6;
+        Mixer.channelGainRight[channel] = gain * min(pan, 64) >> 6;
+
+        int32_t period = v.period + v.periodDelta;
+        if (ins && ins->vibratoDepth && ins->vibratoRate) {
+            // Auto-vibrato: sine, square, ramp down and ramp up
+            int32_t depth = ins->vibratoDepth;
+            if (v.autoVibratoSweep < ins->vibratoSweep) {
+                depth = depth * v.autoVibratoSweep++ / ins->vibratoSweep;
+            }
+            static const uint8_t types[4] = {0, 2, 1, 1};
+            int32_t wave = Waveform(types[ins->vibratoType & 3], v.autoVibratoPos >> 2);
+            period += ((ins->vibratoType & 3) == 3 ? -wave : wave) * depth >> 6;
+            v.autoVibratoPos += ins->vibratoRate;
+        }
+
+        // Samples which have played to the end stay stopped
+        if (!s.loopLength && ((Mixer.channelSampleOffset[channel] >> FIXED_DIVIDER) >= s.length)) {
+            Mixer.channelFrequency[channel] = 0;
+        } else {
+            Mixer.channelFrequency[channel] = PeriodStep((period < 1) ? 1 : period, v.semitones);
+        }
+    }
+}
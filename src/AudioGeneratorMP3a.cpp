@@ -70,7 +70,7 @@ bool AudioGeneratorMP3a::FillBufferWithValidFrame() {
         }
         lastFrameEnd = 0;
         if (nextSync == -1) {
-            if (buff[buffValid - 1] == 0xff) { // Could be 1st half of syncword, preserve it...
+            if (buffValid && buff[buffValid - 1] == 0xff) { // Could be 1st half of syncword, preserve it...
                 buff[0] = 0xff;
                 buffValid = file->read(buff + 1, sizeof(buff) - 1);
                 if (buffValid == 0) {
@@ -95,6 +95,30 @@ bool AudioGeneratorMP3a::FillBufferWithValidFrame() {
     return true;
 }
 
+// Memory-backed sources are decoded where they are instead of being copied into buff.  This
+// needs any buffered data to be used up and a maximum sized frame to be available, otherwise
+// (e.g. for the last frame of the file) the copying path takes over.
+bool AudioGeneratorMP3a::FindFrameInPlace(const uint8_t **frame, int *len) {
+    uint32_t avail;
+    if (buffValid > lastFrameEnd) {
+        return false;
+    }
+    const uint8_t *mem = file->peek(&avail);
+    if (!mem || (avail < (uint32_t)sizeof(buff))) {
+        return false;
+    }
+    int nextSync = MP3FindSyncWord(const_cast<unsigned char *>(mem), avail);
+    if (nextSync < 0) {
+        return false;
+    }
+    file->consume(nextSync);
+    buffValid = 0;
+    lastFrameEnd = 0;
+    *frame = mem + nextSync;
+    *len = avail - nextSync;
+    return true;
+}
+
 bool AudioGeneratorMP3a::loop() {
     if (!running) {
         goto done;    // Nothing to do here!
@@ -112,18 +136,26 @@ bool AudioGeneratorMP3a::loop() {
     }
 
     // No samples available, need to decode a new frame
-    if (FillBufferWithValidFrame()) {
-        // buff[0] start of frame, decode it...
-        unsigned char *inBuff = reinterpret_cast<unsigned char *>(buff);
-        int bytesLeft = buffValid;
+    const uint8_t *frame;
+    int frameLen;
+    bool inPlace;
+    inPlace = FindFrameInPlace(&frame, &frameLen);
+    if (inPlace || FillBufferWithValidFrame()) {
+        // buff[0] or frame[0] start of frame, decode it...
+        unsigned char *inBuff = inPlace ? const_cast<unsigned char *>(frame) : reinterpret_cast<unsigned char *>(buff);
+        int bytesLeft = inPlace ? frameLen : buffValid;
         int ret = MP3Decode(hMP3Decoder, &inBuff, &bytesLeft, outSample, 0);
+        if (inPlace) {
+            // Step over the frame, or just its sync word if it was bad
+            file->consume(ret ? 1 : frameLen - bytesLeft);
+        }
         if (ret) {
             // Error, skip the frame...
             char buff[48];
             sprintf(buff, "MP3 decode error %d", ret);
             cb.st(ret, buff);
         } else {
-            lastFrameEnd = buffValid - bytesLeft;
+            lastFrameEnd = inPlace ? 0 : buffValid - bytesLeft;
             MP3FrameInfo fi;
             MP3GetLastFrameInfo(hMP3Decoder, &fi);
             if ((int)fi.samprate != (int)lastRate) {
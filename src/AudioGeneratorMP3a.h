@@ -42,6 +42,7 @@ protected:
     int16_t buffValid;
     int16_t lastFrameEnd;
     bool FillBufferWithValidFrame(); // Read until we get a valid syncword and min(feof, 2048) butes in the buffer
+    bool FindFrameInPlace(const uint8_t **frame, int *len); // Same, but pointing into a memory-backed source
 
     // Output buffering
     int16_t outSample[1152 * 2]; // Interleaved L/R
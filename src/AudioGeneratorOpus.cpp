@@ -22,10 +22,19 @@
 
 AudioGeneratorOpus::AudioGeneratorOpus() {
     od = nullptr;
+    msd = nullptr;
+    decoderBytes = 0;
+    memoryLimit = 0;
     buff = nullptr;
+    buffSamples = 0;
     buffPtr = 0;
-    packet = nullptr;
     buffLen = 0;
+    decodeRate = 48000;
+    decodeChannels = 2;
+    r128 = false;
+    streaming = false;
+    plcFrames = 0;
+    fecFrames = 0;
     running = false;
 }
 
@@ -34,10 +43,10 @@ AudioGeneratorOpus::~AudioGeneratorOpus() {
         free(od);
     }
     od = nullptr;
+    free(msd);
+    msd = nullptr;
     free(buff);
     buff = nullptr;
-    free(packet);
-    packet = nullptr;
 }
 
 bool AudioGeneratorOpus::begin(AudioFileSource *source, AudioOutput *output) {
@@ -45,24 +54,16 @@ bool AudioGeneratorOpus::begin(AudioFileSource *source, AudioOutput *output) {
     if (!buff) {
         return false;
     }
+    buffSamples = 4096;
 
-    packet = (uint8_t *)malloc(1024);
-    if (!packet) {
-        free(buff);
-        buff = nullptr;
-        return false;
-    }
-    packetOff = 0;
-
-    od = (OpusDecoder *) malloc(opus_decoder_get_size(2));
+    decoderBytes = opus_decoder_get_size(decodeChannels);
+    od = (OpusDecoder *) malloc(decoderBytes);
     if (!od) {
         free(buff);
         buff = nullptr;
-        free(packet);
-        packet = nullptr;
         return false;
     }
-    opus_decoder_init(od, 48000, 2);
+    opus_decoder_init(od, decodeRate, decodeChannels);
 
     if (!source) {
         return false;
@@ -84,144 +85,296 @@ bool AudioGeneratorOpus::begin(AudioFileSource *source, AudioOutput *output) {
     buffPtr = 0;
     buffLen = 0;
 
-    bzero(hdr, sizeof(hdr));
-    packetOff = 0;
-    state = WaitHeader;
+    ogg.begin(file);
     preskip = 0;
+    skip = 0;
+    serial = 0;
+    dataStart = 0;
+    lastGranule = 0;
+    lengthKnown = false;
+    seqValid = false;
+    pending = nullptr;
+    plcLeft = 0;
+    fecLeft = 0;
+    late = 0;
+    underrun = 0;
+    plcFrames = 0;
+    fecFrames = 0;
 
     output->begin();
 
-    // These are fixed by Opus
-    output->SetRate(48000);
-    output->SetChannels(2);
+    output->SetRate(decodeRate);
+    output->SetChannels(decodeChannels);
 
     running = true;
     return true;
 }
 
+// Q14 gains of each channel into the left and right outputs, by channel count in Vorbis order.
+// Mono is sent to both sides, 3.0 up to 7.1 use the same mix as opusfile's stereo downmix.
+static const int16_t opusDownmix[8][8][2] PROGMEM = {
+    { {16384, 16384} },
+    { {16384, 0}, {0, 16384} },
+    { {9598, 0}, {6786, 6786}, {0, 9598} },
+    { {6924, 0}, {0, 6924}, {5997, 3464}, {3464, 5997} },
+    { {10666, 0}, {7537, 7537}, {0, 10666}, {9234, 5331}, {5331, 9234} },
+    { {8667, 0}, {6129, 6129}, {0, 8667}, {7507, 4334}, {4334, 7507}, {6129, 6129} },
+    { {7460, 0}, {5276, 5276}, {0, 7460}, {6460, 3731}, {3731, 6460}, {4568, 4568}, {5276, 5276} },
+    { {6367, 0}, {4502, 4502}, {0, 6367}, {5515, 3183}, {3183, 5515}, {5515, 3183}, {3183, 5515}, {4502, 4502} }
+};
+
+// Mapping family 1 OpusHead: stream count, coupled count, then the channel mapping table
+bool AudioGeneratorOpus::multistream(const uint8_t *packet, uint32_t packetLen) {
+    if ((packet[18] != 1) || (channels < 1) || (channels > 8) || (packetLen < 21u + channels)) {
+        cb.st(STATUS_UNSUPPORTED, PSTR("Unsupported Opus channel mapping"));
+        return false;
+    }
+    uint8_t streams = packet[19];
+    uint8_t coupled = packet[20];
+    uint32_t bytes = opus_multistream_decoder_get_size(streams, coupled);
+    uint32_t samples = 2048 * (((channels > decodeChannels) ? channels : decodeChannels) + 2);
+    if (!bytes || (memoryLimit && (bytes + samples * sizeof(opus_int16) > memoryLimit))) {
+        cb.st(STATUS_UNSUPPORTED, PSTR("Opus multistream decoder too large"));
+        return false;
+    }
+    // The single stream decoder is no longer needed, so its memory goes first
+    free(od);
+    od = nullptr;
+    free(msd);
+    msd = (OpusMSDecoder *)malloc(bytes);
+    opus_int16 *newBuff = (opus_int16 *)realloc(buff, samples * sizeof(opus_int16));
+    if (newBuff) {
+        buff = newBuff;
+        buffSamples = samples;
+    }
+    if (!msd || !newBuff || (opus_multistream_decoder_init(msd, decodeRate, channels, streams, coupled, packet + 21) != OPUS_OK)) {
+        free(msd);
+        msd = nullptr;
+        decoderBytes = 0;
+        cb.st(STATUS_UNSUPPORTED, PSTR("Unable to set up Opus multistream decoder"));
+        return false;
+    }
+    decoderBytes = bytes;
+    msChannels = channels;
+    return true;
+}
+
+// Mixes the msChannels decoded into buff down to decodeChannels, in place.  When fewer channels
+// come out than go in, each frame is written at or before where it was read so it can go forwards.
+void AudioGeneratorOpus::downmix(int frames) {
+    const int16_t (*m)[2] = opusDownmix[msChannels - 1];
+    int in = msChannels;
+    int out = decodeChannels;
+    int i = (out <= in) ? 0 : frames - 1;
+    int step = (out <= in) ? 1 : -1;
+    for (; (i >= 0) && (i < frames); i += step) {
+        const opus_int16 *x = buff + i * in;
+        int32_t l = 8192;
+        int32_t r = 8192;
+        for (int c = 0; c < in; c++) {
+            l += x[c] * (int16_t)pgm_read_word(&m[c][0]);
+            r += x[c] * (int16_t)pgm_read_word(&m[c][1]);
+        }
+        l >>= 14;
+        r >>= 14;
+        if (out == 1) {
+            l = (l + r) >> 1;
+        }
+        l = (l < -32768) ? -32768 : (l > 32767) ? 32767 : l;
+        r = (r < -32768) ? -32768 : (r > 32767) ? 32767 : r;
+        buff[i * out] = l;
+        if (out == 2) {
+            buff[i * out + 1] = r;
+        }
+    }
+}
+
+// Grows buff for a packet longer than it holds (up to 120 ms), within the memory limit
+bool AudioGeneratorOpus::reserve(int frames) {
+    uint32_t samples = frames * frameSamples();
+    if (samples <= buffSamples) {
+        return true;
+    }
+    if (memoryLimit && (decoderBytes + samples * sizeof(opus_int16) > memoryLimit)) {
+        return false;
+    }
+    opus_int16 *newBuff = (opus_int16 *)realloc(buff, samples * sizeof(opus_int16));
+    if (!newBuff) {
+        return false;
+    }
+    buff = newBuff;
+    buffSamples = samples;
+    return true;
+}
+
+// Single or multistream decode into buff, always leaving decodeChannels interleaved
+int AudioGeneratorOpus::decode(const uint8_t *packet, uint32_t packetLen, int frames, int fec) {
+    if (!msd) {
+        return opus_decode(od, packet, packetLen, buff, frames, fec);
+    }
+    // Each stream is decoded into the end of buff, rather than the stack
+    int ret = opus_multistream_decode_scratch(msd, packet, packetLen, buff, frames, fec, buff + maxFrames() * pcmChannels());
+    if (ret > 0) {
+        downmix(ret);
+    }
+    return ret;
+}
+
+// Take a decoder result into buff, less anything still to be skipped
+bool AudioGeneratorOpus::fill(int ret) {
+    if (ret <= 0) {
+        return false;
+    }
+    if (skip >= (uint32_t)ret) {
+        // Entirely pre-skip or seek pre-roll, keep going
+        skip -= ret;
+        return false;
+    }
+    buffLen = ret * decodeChannels;
+    buffPtr = skip * decodeChannels;
+    skip = 0;
+    return true;
+}
+
+// Called with the first packet after a gap in the page sequence.  The granule positions on either
+// side of the gap, less the packets completed on this page, tell how much audio went missing.
+// That is made up with PLC, except the last frame which may be recoverable from this packet's FEC.
+void AudioGeneratorOpus::lostPackets(const uint8_t *packet, uint32_t packetLen) {
+    int frame = opus_packet_get_nb_samples(packet, packetLen, 48000);
+    if (frame <= 0) {
+        return;
+    }
+    uint64_t here = frame;
+    const uint8_t *p;
+    uint32_t l;
+    for (uint32_t i = 0; ogg.peekPacket(i, &p, &l); i++) {
+        int n = opus_packet_get_nb_samples(p, l, 48000);
+        here += (n > 0) ? n : 0;
+    }
+    if ((ogg.granule() == (uint64_t) -1) || (ogg.granule() < pageGranule + here)) {
+        return;
+    }
+    uint32_t lost = toDecodeRate(ogg.granule() - pageGranule - here);
+    // Concealment already played out during an underrun covers the same time
+    if (skip >= lost) {
+        skip -= lost;
+        return;
+    }
+    lost -= skip;
+    skip = 0;
+    frame = toDecodeRate(frame);
+    fecLeft = (lost >= (uint32_t)frame) ? frame : 0;
+    plcLeft = lost - fecLeft;
+    cb.st(STATUS_CONCEALED, PSTR("Concealing lost Opus packets"));
+}
+
 bool AudioGeneratorOpus::demux() {
-    int r;
-    uint8_t b;
-    //static int pktno = 0;
+    const uint8_t *packet;
+    uint32_t packetLen;
 
+    // Will run until we either run out of data or decode something
     while (true) {
-        switch (state) {
-        case WaitHeader:
-            //audioLogger->printf("STATE: WaitHeader\n");
-            if (!file->read(&b, 1)) {
-                return false; // No data
-            }
-            memmove(hdr, hdr + 1, 26);
-            hdr[26] = b;
-            if ((hdr[0] == 'O') && (hdr[1] == 'g') && (hdr[2] == 'g') && (hdr[3] == 'S') && (hdr[4] == 0)) {
-                // We have a header!
-                type = hdr[5];
-                agp = hdr[13];
-                for (int i = 1; i < 7; i++) {
-                    agp <<= 8;
-                    agp |= hdr[13 - i];
+        if (pending) {
+            int ret;
+            if (plcLeft) {
+                // PLC works in multiples of 2.5ms, up to a frame at a time
+                uint32_t n = plcLeft;
+                uint32_t max = (uint32_t)opus_packet_get_nb_samples(pending, pendingLen, decodeRate);
+                n = ((max > 0) && (n > max)) ? max : n;
+                n = (n > (uint32_t)maxFrames()) ? maxFrames() : n;
+                n -= n % (decodeRate / 400);
+                if (!n) {
+                    plcLeft = 0;
+                    continue;
                 }
-                ssn = hdr[14] | (hdr[15] << 8) | (hdr[16] << 16) | (hdr[17] << 24);
-                psn = hdr[18] | (hdr[19] << 8) | (hdr[20] << 16) | (hdr[21] << 24);
-                pcs = hdr[22] | (hdr[23] << 8) | (hdr[24] << 16) | (hdr[25] << 24);
-                ps = hdr[26];
-                readPS = 0;
-                //audioLogger->printf("HEADER: typ: %d, agp: %llu, ssn: %08x, psn: %08x, pcs: %08x, ps: %d\n", type, agp, ssn, psn, pcs, ps);
-                state = WaitSegment;
+                ret = decode(nullptr, 0, n, 0);
+                plcLeft -= n;
+                plcFrames++;
+            } else if (fecLeft) {
+                ret = decode(pending, pendingLen, fecLeft, 1);
+                fecLeft = 0;
+                fecFrames++;
+            } else {
+                ret = decode(pending, pendingLen, maxFrames(), 0);
+                pending = nullptr;
             }
-            break;
-        case WaitSegment:
-            //audioLogger->printf("STATE: WaitSegment\n");
-            r = file->read(seg + readPS, ps - readPS);
-            readPS += r; // Keep track of what we read
-            if (readPS < ps) {
-                // Not enough data avail to finish, loop
+            if (fill(ret)) {
+                return true; // We have filled a buffer
+            }
+            continue;
+        }
+
+        if (!ogg.nextPacket(&packet, &packetLen)) {
+            if (!streaming || ogg.eos() || ogg.packetTooLarge() || !seqValid || (underrun >= (uint32_t)decodeRate)) {
                 return false;
             }
-            //audioLogger->printf("SEGMENTS (%d): ", ps);
-            for (int i = 0; i < ps; i++) {
-                //audioLogger->printf(" %02x", seg[i]);
+            // Nothing arrived in time, play a concealment frame and remember to drop as much later
+            if (!underrun) {
+                cb.st(STATUS_UNDERRUN, PSTR("Opus stream underrun, concealing"));
             }
-            //audioLogger->printf("\n");
-            curSeg = 0;
-            lacingBytesToRead = seg[0];
-            state = ReadPacket;
-            break;
-        case ReadPacket:
-            //audioLogger->printf("STATE: ReadPacket\n");
-            //audioLogger->printf("readpacket seg %d len %d\n", curSeg, seg[curSeg]);
-            r = file->read(packet + packetOff, lacingBytesToRead);
-            packetOff += r;
-            lacingBytesToRead -= r;
-            if (lacingBytesToRead) {
-                //audioLogger->printf("short read\n");
-                return false; // Not enough avail
+            int ret = decode(nullptr, 0, decodeRate / 50, 0);
+            if (ret <= 0) {
+                return false;
+            }
+            plcFrames++;
+            late += ret;
+            underrun += ret;
+            buffLen = ret * decodeChannels;
+            buffPtr = 0;
+            return true;
+        }
+
+        // First, is it a header?
+        if ((packetLen >= 19) && !memcmp(packet, "OpusHead", 8) && (packet[8] == 1)) {
+            channels = packet[9];
+            preskip = packet[10] | (packet[11] << 8);
+            skip = toDecodeRate(preskip);
+            serial = ogg.serial();
+            samplerate = packet[12] | (packet[13] << 8) | (packet[14] << 16) | (packet[15] << 24);
+            gain = (int16_t)(packet[16] | (packet[17] << 8));
+            if (packet[18] ? !multistream(packet, packetLen) : !od) {
+                // Also a plain stream chained after a multistream one, the decoder for it is gone
+                running = false;
+                return false;
+            }
+            if (msd) {
+                opus_multistream_decoder_ctl(msd, OPUS_SET_GAIN(gain));
+            } else {
+                opus_decoder_ctl(od, OPUS_SET_GAIN(gain));
+            }
+            lengthKnown = false;
+        } else if ((packetLen >= 8) && !memcmp(packet, "OpusTags", 8)) {
+            parseTags(packet, packetLen);
+            // Header pages have a granule position of 0, audio follows on the next page
+            seqValid = true;
+            lastSeq = ogg.sequence();
+            pageGranule = 0;
+        } else if (ogg.serial() == serial) {
+            // This should be a regular packet
+            if (!dataStart) {
+                dataStart = ogg.pageOffset();
             }
-            // Read lacing bit, see if there's more
-            if (seg[curSeg] != 0xff) {
-                //audioLogger->printf("PACKET %d (%d): ", pktno++, packetOff);
-                for (uint32_t i = 0; i < packetOff; i++) {
-                    //audioLogger->printf(" %02X", packet[i]);
+            skip += late;
+            late = 0;
+            underrun = 0;
+            if (ogg.sequence() != lastSeq) {
+                if (seqValid && (ogg.sequence() != lastSeq + 1)) {
+                    lostPackets(packet, packetLen);
                 }
-                //audioLogger->printf("\n");
-                // We have a full packet in the buffer, decode it
-                // First, is it a header?
-                if ((packetOff >= 17) && !memcmp(packet, "OpusHead", 8) && (packet[8] == 1)) {
-                    channels = packet[9];
-                    preskip = packet[10] | (packet[11] << 8);
-                    samplerate = packet[12] | (packet[13] << 8) | (packet[14] << 16) | (packet[15] << 24);
-                    gain = packet[16] | (packet[17]++);
-                    //audioLogger->printf("HEADER: chan: %d, sr: %d, skip %d\n", channels, samplerate, preskip);
-                    packetOff = 0; // For better or worse, we've processed this pkt
-                } else if ((packetOff >= 9) && !memcmp(packet, "OpusTags", 8)) {
-                    // This is an unparsed TAG.  TODO find metadata format
-                    packetOff = 0; // For better or worse, we've processed this pkt
-                } else {
-                    // This should be a regular packet
-                    int ret = opus_decode(od, packet, packetOff, buff, 2048, 0);
-                    packetOff = 0; // For better or worse, we've processed this pkt
-                    if (ret > 0) {
-                        buffLen = ret * 2;
-                        if (preskip) {
-                            if (buffLen >= preskip) {
-                                buffPtr = preskip;
-                                preskip = 0;
-                                //audioLogger->printf("donepreskip\n");
-                            } else {
-                                buffPtr = buffLen;
-                                preskip -= buffLen;
-                            }
-                        } else {
-                            buffPtr = 0;
-                        }
-                        curSeg++;
-                        if (curSeg >= ps) {
-                            state = WaitHeader;
-                            lacingBytesToRead = 0;
-                        } else {
-                            lacingBytesToRead = seg[curSeg];
-                        }
-                        return true; // We have filled a buffer
-                    } else {
-                        //audioLogger->printf("nodecode\n");
-                        // Could be header pkt, we ignore them here
-                        // That means we ignore the preskip value, for now
-                    }
-                    packetOff = 0; // For better or worse, we've processed this pkt
+                seqValid = true;
+                lastSeq = ogg.sequence();
+                if (ogg.granule() != (uint64_t) -1) {
+                    pageGranule = ogg.granule();
                 }
             }
-            // Only have partial pkt, need next segment
-            curSeg++;
-            if (curSeg >= ps) {
-                state = WaitHeader;
-                lacingBytesToRead = 0;
-            } else {
-                lacingBytesToRead = seg[curSeg];
+            int frames = opus_packet_get_nb_samples(packet, packetLen, decodeRate);
+            if ((frames > maxFrames()) && !reserve(frames)) {
+                cb.st(STATUS_UNSUPPORTED, PSTR("Opus packet too long for the memory limit"));
+                running = false;
+                return false;
             }
-            break;
-        default:
-            state = WaitHeader;
-            break;
+            pending = packet;
+            pendingLen = packetLen;
         }
     }
 }
@@ -240,7 +393,10 @@ bool AudioGeneratorOpus::loop() {
         if (buffPtr == buffLen) {
             // Will run until we either run out of data, would block, or decode something
             if (!demux()) {
-                running = false;
+                // A stream that is only late keeps going, concealment aside
+                if (!streaming || ogg.eos() || !file->isOpen()) {
+                    running = false;
+                }
                 goto done;
             }
         }
@@ -250,8 +406,8 @@ bool AudioGeneratorOpus::loop() {
         }
 
         lastSample[AudioOutput::LEFTCHANNEL] = buff[buffPtr] & 0xffff;
-        lastSample[AudioOutput::RIGHTCHANNEL] = buff[buffPtr + 1] & 0xffff;
-        buffPtr += 2;
+        lastSample[AudioOutput::RIGHTCHANNEL] = buff[buffPtr + decodeChannels - 1] & 0xffff;
+        buffPtr += decodeChannels;
     } while (running && output->ConsumeSample(lastSample));
 
 done:
@@ -266,8 +422,11 @@ bool AudioGeneratorOpus::stop() {
         free(od);
     }
     od = nullptr;
+    free(msd);
+    msd = nullptr;
     free(buff);
     buff = nullptr;
+    ogg.end();
     running = false;
     output->stop();
     return true;
@@ -276,3 +435,200 @@ bool AudioGeneratorOpus::stop() {
 bool AudioGeneratorOpus::isRunning() {
     return running;
 }
+
+static uint32_t le32(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Vendor string, then a count of "NAME=value" comments, each with a 32-bit length
+void AudioGeneratorOpus::parseTags(const uint8_t *packet, uint32_t packetLen) {
+    const uint8_t *p = packet + 8;
+    const uint8_t *end = packet + packetLen;
+    if ((end - p < 4) || (le32(p) > (uint32_t)(end - p - 4))) {
+        return;
+    }
+    p += 4 + le32(p);
+    if (end - p < 4) {
+        return;
+    }
+    uint32_t count = le32(p);
+    p += 4;
+    for (uint32_t i = 0; (i < count) && (end - p >= 4); i++) {
+        uint32_t len = le32(p);
+        p += 4;
+        if (len > (uint32_t)(end - p)) {
+            return;
+        }
+        const uint8_t *eq = (const uint8_t *)memchr(p, '=', len);
+        if (eq) {
+            // Long values (e.g. cover art) are cut short, same as the ID3 parser does
+            char name[32];
+            char value[64];
+            uint32_t nameLen = eq - p;
+            uint32_t valueLen = len - nameLen - 1;
+            if (nameLen > sizeof(name) - 1) {
+                nameLen = sizeof(name) - 1;
+            }
+            if (valueLen > sizeof(value) - 1) {
+                valueLen = sizeof(value) - 1;
+            }
+            memcpy(name, p, nameLen);
+            name[nameLen] = 0;
+            memcpy(value, eq + 1, valueLen);
+            value[valueLen] = 0;
+            if (r128 && !strcasecmp(name, "R128_TRACK_GAIN")) {
+                // Also Q7.8 dB, relative to the output gain
+                int32_t g = gain + atoi(value);
+                g = (g < -32768) ? -32768 : (g > 32767) ? 32767 : g;
+                if (msd) {
+                    opus_multistream_decoder_ctl(msd, OPUS_SET_GAIN(g));
+                } else {
+                    opus_decoder_ctl(od, OPUS_SET_GAIN(g));
+                }
+            }
+            cb.md(name, false, value);
+        }
+        p += len;
+    }
+}
+
+// Next page of our stream with a granule position, starting the scan at byte from
+bool AudioGeneratorOpus::findPage(uint32_t from, uint32_t limit, uint32_t *offset, uint64_t *granule) {
+    if (!file->seek(from, SEEK_SET)) {
+        return false;
+    }
+    ogg.flush();
+    while (ogg.nextPage() && (ogg.pageOffset() < limit)) {
+        if ((ogg.serial() == serial) && (ogg.granule() != (uint64_t) -1)) {
+            *offset = ogg.pageOffset();
+            *granule = ogg.granule();
+            return true;
+        }
+    }
+    return false;
+}
+
+// Granule of the last page is the stream length.  Search back from the end of the file for a page
+// header of our stream, reading the source directly so the demuxer's page (and the packet pending on
+// it) is left alone, then put the read position back.  Pages are at most 64K so only the tail is read.
+void AudioGeneratorOpus::findLastGranule() {
+    uint8_t chunk[64 + 3];
+    uint8_t hdr[27];
+    uint32_t pos = file->getPos();
+    uint32_t size = file->getSize();
+    uint32_t stop = (size > dataStart + 65536) ? size - 65536 : dataStart;
+    uint32_t end = size;
+    lastGranule = 0;
+    while ((end > stop) && !lastGranule) {
+        uint32_t start = (end - stop > 64) ? end - 64 : stop;
+        uint32_t len = ((size - start) < sizeof(chunk)) ? size - start : sizeof(chunk);
+        if (!file->seek(start, SEEK_SET) || (file->read(chunk, len) != len)) {
+            break;
+        }
+        // Each offset is tried once, the 3 bytes of overlap catch a capture pattern across chunks
+        for (int i = (int)(end - start) - 1; (i >= 0) && !lastGranule; i--) {
+            if ((i + 4 > (int)len) || memcmp(chunk + i, "OggS", 4)) {
+                continue;
+            }
+            if (!file->seek(start + i, SEEK_SET) || (file->read(hdr, sizeof(hdr)) != sizeof(hdr)) || hdr[4]) {
+                continue;
+            }
+            uint32_t pageSerial = hdr[14] | (hdr[15] << 8) | (hdr[16] << 16) | ((uint32_t)hdr[17] << 24);
+            uint64_t granule = 0;
+            for (int b = 13; b >= 6; b--) {
+                granule = (granule << 8) | hdr[b];
+            }
+            if ((pageSerial == serial) && (granule != (uint64_t) -1)) {
+                lastGranule = granule;
+            }
+        }
+        end = start;
+    }
+    file->seek(pos, SEEK_SET);
+}
+
+uint32_t AudioGeneratorOpus::duration() {
+    if (!dataStart) {
+        return 0;
+    }
+    if (!lengthKnown) {
+        // Looked for on the first call rather than at begin(), which costs a read of the file's tail
+        findLastGranule();
+        lengthKnown = true;
+    }
+    return (lastGranule > preskip) ? (uint32_t)((lastGranule - preskip) / 48) : 0;
+}
+
+bool AudioGeneratorOpus::seek(uint32_t ms) {
+    if (!running || !dataStart) {
+        return false;
+    }
+    // Granule positions count the pre-skip, and decoding starts 80ms early so the decoder has converged
+    uint64_t target = (uint64_t)ms * 48 + preskip;
+    uint64_t start = (target > 3840) ? target - 3840 : 0;
+
+    // Bisect for the last page ending at or before start, packets after it begin at its granule
+    uint32_t lo = dataStart;
+    uint32_t hi = file->getSize();
+    uint32_t best = 0;
+    uint64_t bestGranule = 0;
+    uint32_t offset;
+    uint64_t granule;
+    while (hi - lo > 65536) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (findPage(mid, hi, &offset, &granule) && (granule <= start)) {
+            lo = offset;
+            best = offset;
+            bestGranule = granule;
+        } else {
+            hi = mid;
+        }
+    }
+    // Then walk the last stretch page by page
+    if (!file->seek(lo, SEEK_SET)) {
+        return false;
+    }
+    ogg.flush();
+    while (ogg.nextPage()) {
+        if ((ogg.serial() != serial) || (ogg.granule() == (uint64_t) -1)) {
+            continue;
+        }
+        if (ogg.granule() > start) {
+            break;
+        }
+        best = ogg.pageOffset();
+        bestGranule = ogg.granule();
+    }
+
+    if (best) {
+        if (!file->seek(best, SEEK_SET)) {
+            return false;
+        }
+        ogg.flush();
+        if (!ogg.nextPage()) {
+            return false;
+        }
+        ogg.skipPagePackets();
+    } else {
+        // Before the first page's granule, just start over at the first audio page
+        if (!file->seek(dataStart, SEEK_SET)) {
+            return false;
+        }
+        ogg.flush();
+    }
+    if (msd) {
+        opus_multistream_decoder_ctl(msd, OPUS_RESET_STATE);
+    } else {
+        opus_decoder_ctl(od, OPUS_RESET_STATE);
+    }
+    skip = toDecodeRate(target - bestGranule);
+    seqValid = false;
+    pending = nullptr;
+    plcLeft = 0;
+    fecLeft = 0;
+    late = 0;
+    underrun = 0;
+    buffPtr = 0;
+    buffLen = 0;
+    return true;
+}
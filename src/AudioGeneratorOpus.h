@@ -22,7 +22,9 @@
 #define _AUDIOGENERATOROPUS_H
 
 #include <AudioGenerator.h>
+#include "AudioOggDemux.h"
 #include "libopus/include/opus.h"
+#include "libopus/include/opus_multistream_scratch.h"
 
 class AudioGeneratorOpus : public AudioGenerator {
 public:
@@ -33,34 +35,141 @@ public:
     virtual bool stop() override;
     virtual bool isRunning() override;
 
+    // libopus can synthesize directly at 8, 12, 16, 24 or 48 kHz and in mono or stereo, which is
+    // much cheaper than decoding full band stereo only to decimate or mix it down later.
+    bool SetSampleRate(int hz) {
+        if (running || ((hz != 8000) && (hz != 12000) && (hz != 16000) && (hz != 24000) && (hz != 48000))) {
+            return false;
+        }
+        decodeRate = hz;
+        return true;
+    }
+    bool SetChannels(int ch) {
+        if (running || (ch < 1) || (ch > 2)) {
+            return false;
+        }
+        decodeChannels = ch;
+        return true;
+    }
+
+    // Add the R128_TRACK_GAIN tag, when present, to the OpusHead output gain.  Both are applied
+    // inside the decoder by OPUS_SET_GAIN, so there is no extra pass over the PCM.
+    bool SetR128TrackGain(bool use) {
+        if (running) {
+            return false;
+        }
+        r128 = use;
+        return true;
+    }
+
+    // For network streams: when the source has nothing ready, keep playing packet loss concealment
+    // (up to a second) instead of ending, and skip the same amount of audio once the late packets
+    // arrive.  The stream then ends at its EOS page or when the source closes.  Pages lost outside
+    // of this mode are still concealed, using the page sequence numbers and granule positions.
+    bool SetStreaming(bool use) {
+        if (running) {
+            return false;
+        }
+        streaming = use;
+        return true;
+    }
+
+    // Surround files (channel mapping family 1, up to 7.1) need one decoder per elementary stream
+    // and a buffer for every channel before they are mixed down to stereo, and 60 or 120 ms packets
+    // need a larger buffer than the usual 20 ms ones.  Refuse any stream whose decoders and buffer
+    // would need more than this many bytes, 0 for no limit.
+    bool SetMemoryLimit(uint32_t bytes) {
+        if (running) {
+            return false;
+        }
+        memoryLimit = bytes;
+        return true;
+    }
+    // Bytes of decoder state and PCM buffer in use for the current stream
+    uint32_t memoryUsed() {
+        return decoderBytes + buffSamples * sizeof(opus_int16);
+    }
+
+    // Frames synthesized by packet loss concealment, and frames recovered from in-band FEC
+    uint32_t concealedFrames() {
+        return plcFrames;
+    }
+    uint32_t recoveredFrames() {
+        return fecFrames;
+    }
+    enum { STATUS_CONCEALED = 16, STATUS_UNDERRUN, STATUS_UNSUPPORTED };
+
+    // Jump to a time in the stream by bisecting over the page granule positions.  Needs a
+    // seekable source, and can be called at any point after begin().
+    bool seek(uint32_t ms);
+    // Stream length from the last page's granule position, 0 if the source can't seek.  The
+    // file's tail is read on the first call after the headers, not while playing.
+    uint32_t duration();
+
 private:
     OpusDecoder *od = nullptr;
+    OpusMSDecoder *msd = nullptr; // Replaces od for multistream files
+    uint8_t msChannels; // Channels coming out of msd, before the downmix
+    uint32_t decoderBytes;
+    uint32_t memoryLimit;
+    bool multistream(const uint8_t *packet, uint32_t packetLen);
+    int decode(const uint8_t *packet, uint32_t packetLen, int frames, int fec);
+    void downmix(int frames);
+    bool reserve(int frames);
+    // Samples of buff each frame takes.  Multistream frames hold every channel (or the wider
+    // downmix), followed by room for the 2 samples a frame the decoder uses for each stream.
+    int pcmChannels() {
+        return (msd && (msChannels > decodeChannels)) ? msChannels : decodeChannels;
+    }
+    int frameSamples() {
+        return pcmChannels() + (msd ? 2 : 0);
+    }
+    int maxFrames() {
+        return buffSamples / frameSamples();
+    }
 
-    uint8_t *packet; // Raw compressed, demuxed packet
-    uint32_t packetOff;
     opus_int16 *buff; // Decoded PCM
     uint32_t buffPtr;
     uint32_t buffLen;
+    uint32_t buffSamples;
+    int decodeRate;
+    int decodeChannels;
+    bool r128;
+    bool streaming;
 
     bool demux();
-    uint8_t hdr[27]; // Page header
-    enum {WaitHeader, WaitSegment, ReadPacket} state;
-    uint8_t type;
-    uint64_t agp;
-    uint32_t ssn;
-    uint32_t psn;
-    uint32_t pcs;
-    uint16_t ps; // packet lacing segments
-    uint16_t readPS;
-    uint8_t seg[256]; // Packet lacing in the current page
-    uint16_t curSeg;
-    uint32_t lacingBytesToRead;
-    void processPacket();
+    bool fill(int ret);
+    void lostPackets(const uint8_t *packet, uint32_t packetLen);
+    AudioOggDemux ogg;
+    uint32_t skip; // Decoded samples to throw away, for the pre-skip and after a seek, at decodeRate
+    uint32_t serial; // Logical stream the OpusHead came in
+    uint32_t dataStart; // Offset of the first audio page
+    uint64_t lastGranule;
+    bool lengthKnown; // lastGranule has been looked for
+    // Loss concealment
+    bool seqValid; // lastSeq and pageGranule are of the last page we took audio from
+    uint32_t lastSeq;
+    uint64_t pageGranule;
+    const uint8_t *pending; // Packet to decode after plcLeft and fecLeft have been synthesized
+    uint32_t pendingLen;
+    uint32_t plcLeft;
+    uint32_t fecLeft;
+    uint32_t late; // Concealment played during an underrun, to skip when the data turns up
+    uint32_t underrun;
+    uint32_t plcFrames;
+    uint32_t fecFrames;
+    void findLastGranule();
+    bool findPage(uint32_t from, uint32_t limit, uint32_t *offset, uint64_t *granule);
+    void parseTags(const uint8_t *packet, uint32_t packetLen);
+    // Granule positions and the pre-skip are always in 48 kHz samples
+    uint32_t toDecodeRate(uint64_t samples48k) {
+        return (uint32_t)(samples48k / (48000 / decodeRate));
+    }
     // From the OpusHead
     uint16_t preskip;
     uint8_t channels;
     uint32_t samplerate;
-    uint16_t gain;
+    int16_t gain; // Q7.8 dB
 };
 
 #endif
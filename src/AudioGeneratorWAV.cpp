@@ -1,6 +1,6 @@
 /*
     AudioGeneratorWAV
-    Audio output generator that reads 8 and 16-bit WAV files
+    Audio output generator that reads PCM, float, G.711 and ADPCM WAV files
 
     Copyright (C) 2017  Earle F. Philhower, III
 
@@ -19,21 +19,290 @@
 */
 
 
+#include <math.h>
 #include "AudioGeneratorWAV.h"
 
+// Format tags from mmreg.h
+enum {
+    WAVE_FORMAT_PCM = 0x0001,
+    WAVE_FORMAT_ADPCM = 0x0002,
+    WAVE_FORMAT_IEEE_FLOAT = 0x0003,
+    WAVE_FORMAT_ALAW = 0x0006,
+    WAVE_FORMAT_MULAW = 0x0007,
+    WAVE_FORMAT_IMA_ADPCM = 0x0011,
+    WAVE_FORMAT_EXTENSIBLE = 0xfffe
+};
+
+// G.711 expansion tables, ITU-T reference decoder output
+static const int16_t ulawTable[256] PROGMEM = {
+    -32124, -31100, -30076, -29052, -28028, -27004, -25980, -24956,
+    -23932, -22908, -21884, -20860, -19836, -18812, -17788, -16764,
+    -15996, -15484, -14972, -14460, -13948, -13436, -12924, -12412,
+    -11900, -11388, -10876, -10364, -9852, -9340, -8828, -8316,
+    -7932, -7676, -7420, -7164, -6908, -6652, -6396, -6140,
+    -5884, -5628, -5372, -5116, -4860, -4604, -4348, -4092,
+    -3900, -3772, -3644, -3516, -3388, -3260, -3132, -3004,
+    -2876, -2748, -2620, -2492, -2364, -2236, -2108, -1980,
+    -1884, -1820, -1756, -1692, -1628, -1564, -1500, -1436,
+    -1372, -1308, -1244, -1180, -1116, -1052, -988, -924,
+    -876, -844, -812, -780, -748, -716, -684, -652,
+    -620, -588, -556, -524, -492, -460, -428, -396,
+    -372, -356, -340, -324, -308, -292, -276, -260,
+    -244, -228, -212, -196, -180, -164, -148, -132,
+    -120, -112, -104, -96, -88, -80, -72, -64,
+    -56, -48, -40, -32, -24, -16, -8, 0,
+    32124, 31100, 30076, 29052, 28028, 27004, 25980, 24956,
+    23932, 22908, 21884, 20860, 19836, 18812, 17788, 16764,
+    15996, 15484, 14972, 14460, 13948, 13436, 12924, 12412,
+    11900, 11388, 10876, 10364, 9852, 9340, 8828, 8316,
+    7932, 7676, 7420, 7164, 6908, 6652, 6396, 6140,
+    5884, 5628, 5372, 5116, 4860, 4604, 4348, 4092,
+    3900, 3772, 3644, 3516, 3388, 3260, 3132, 3004,
+    2876, 2748, 2620, 2492, 2364, 2236, 2108, 1980,
+    1884, 1820, 1756, 1692, 1628, 1564, 1500, 1436,
+    1372, 1308, 1244, 1180, 1116, 1052, 988, 924,
+    876, 844, 812, 780, 748, 716, 684, 652,
+    620, 588, 556, 524, 492, 460, 428, 396,
+    372, 356, 340, 324, 308, 292, 276, 260,
+    244, 228, 212, 196, 180, 164, 148, 132,
+    120, 112, 104, 96, 88, 80, 72, 64,
+    56, 48, 40, 32, 24, 16, 8, 0,
+};
+
+static const int16_t alawTable[256] PROGMEM = {
+    -5504, -5248, -6016, -5760, -4480, -4224, -4992, -4736,
+    -7552, -7296, -8064, -7808, -6528, -6272, -7040, -6784,
+    -2752, -2624, -3008, -2880, -2240, -2112, -2496, -2368,
+    -3776, -3648, -4032, -3904, -3264, -3136, -3520, -3392,
+    -22016, -20992, -24064, -23040, -17920, -16896, -19968, -18944,
+    -30208, -29184, -32256, -31232, -26112, -25088, -28160, -27136,
+    -11008, -10496, -12032, -11520, -8960, -8448, -9984, -9472,
+    -15104, -14592, -16128, -15616, -13056, -12544, -14080, -13568,
+    -344, -328, -376, -360, -280, -264, -312, -296,
+    -472, -456, -504, -488, -408, -392, -440, -424,
+    -88, -72, -120, -104, -24, -8, -56, -40,
+    -216, -200, -248, -232, -152, -136, -184, -168,
+    -1376, -1312, -1504, -1440, -1120, -1056, -1248, -1184,
+    -1888, -1824, -2016, -1952, -1632, -1568, -1760, -1696,
+    -688, -656, -752, -720, -560, -528, -624, -592,
+    -944, -912, -1008, -976, -816, -784, -880, -848,
+    5504, 5248, 6016, 5760, 4480, 4224, 4992, 4736,
+    7552, 7296, 8064, 7808, 6528, 6272, 7040, 6784,
+    2752, 2624, 3008, 2880, 2240, 2112, 2496, 2368,
+    3776, 3648, 4032, 3904, 3264, 3136, 3520, 3392,
+    22016, 20992, 24064, 23040, 17920, 16896, 19968, 18944,
+    30208, 29184, 32256, 31232, 26112, 25088, 28160, 27136,
+    11008, 10496, 12032, 11520, 8960, 8448, 9984, 9472,
+    15104, 14592, 16128, 15616, 13056, 12544, 14080, 13568,
+    344, 328, 376, 360, 280, 264, 312, 296,
+    472, 456, 504, 488, 408, 392, 440, 424,
+    88, 72, 120, 104, 24, 8, 56, 40,
+    216, 200, 248, 232, 152, 136, 184, 168,
+    1376, 1312, 1504, 1440, 1120, 1056, 1248, 1184,
+    1888, 1824, 2016, 1952, 1632, 1568, 1760, 1696,
+    688, 656, 752, 720, 560, 528, 624, 592,
+    944, 912, 1008, 976, 816, 784, 880, 848,
+};
+
+// Per-sample decoders, inlined into the block kernels below
+static inline int16_t DecodeU8(const uint8_t *p) {
+    return ((int16_t)p[0] - 128) * 256;
+}
+static inline int16_t DecodeS16(const uint8_t *p) {
+    return (int16_t)(p[0] | (p[1] << 8));
+}
+static inline int16_t DecodeS24(const uint8_t *p) {
+    return (int16_t)(p[1] | (p[2] << 8));
+}
+static inline int16_t DecodeS32(const uint8_t *p) {
+    return (int16_t)(p[2] | (p[3] << 8));
+}
+static inline int16_t DecodeF32(const uint8_t *p) {
+    float f;
+    memcpy(&f, p, sizeof(f));
+    // Casting NaN or anything out of range is undefined, so clamp first and play NaN as silence
+    if (isnan(f)) {
+        return 0;
+    }
+    f *= 32768.0f;
+    if (f >= 32767.0f) {
+        return 32767;
+    } else if (f <= -32768.0f) {
+        return -32768;
+    }
+    return (int16_t)f;
+}
+static inline int16_t DecodeULaw(const uint8_t *p) {
+    return (int16_t)pgm_read_word(&ulawTable[p[0]]);
+}
+static inline int16_t DecodeALaw(const uint8_t *p) {
+    return (int16_t)pgm_read_word(&alawTable[p[0]]);
+}
+
+// Converts a block of interleaved frames to 16-bit stereo, duplicating mono
+template<int16_t (*decode)(const uint8_t *), int bytes, int ch>
+static void ConvertBlock(const uint8_t *in, int16_t *out, uint32_t frames) {
+    while (frames--) {
+        int16_t l = decode(in);
+        out[AudioOutput::LEFTCHANNEL] = l;
+        out[AudioOutput::RIGHTCHANNEL] = (ch == 2) ? decode(in + bytes) : l;
+        in += bytes * ch;
+        out += 2;
+    }
+}
+
+// IMA ADPCM step sizes and index adjustments
+static const uint16_t imaStepTable[89] PROGMEM = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+    19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+    337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+    876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+    5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+};
+
+static const int8_t imaIndexTable[16] PROGMEM = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+// MS ADPCM delta adaptation and the 7 standard predictor coefficient pairs
+static const uint16_t msAdaptTable[16] PROGMEM = {
+    230, 230, 230, 230, 307, 409, 512, 614,
+    768, 614, 512, 409, 307, 230, 230, 230
+};
+
+static const int16_t msCoefTable[7][2] PROGMEM = {
+    { 256, 0 }, { 512, -256 }, { 0, 0 }, { 192, 64 }, { 240, 0 }, { 460, -208 }, { 392, -232 }
+};
+
+static inline int16_t Clamp16(int32_t v) {
+    return (v > 32767) ? 32767 : ((v < -32768) ? -32768 : v);
+}
+
+static inline int16_t ReadS16(const uint8_t *p) {
+    return (int16_t)(p[0] | (p[1] << 8));
+}
+
+// Decodes one IMA ADPCM block: a 4 byte header per channel, then 4 byte groups
+// of 8 nibbles (low nibble first) alternating between the channels
+template<int ch>
+static void DecodeIMABlock(const uint8_t *in, int16_t *out, uint32_t frames) {
+    int32_t pred[2];
+    int index[2];
+    for (int c = 0; c < ch; c++) {
+        pred[c] = ReadS16(in);
+        index[c] = (in[2] > 88) ? 88 : in[2];
+        in += 4;
+    }
+    out[AudioOutput::LEFTCHANNEL] = pred[0];
+    out[AudioOutput::RIGHTCHANNEL] = pred[ch - 1];
+    out += 2;
+    frames--;
+    while (frames) {
+        uint32_t n = (frames < 8) ? frames : 8;
+        for (int c = 0; c < ch; c++) {
+            for (uint32_t k = 0; k < n; k++) {
+                uint8_t nib = (k & 1) ? (in[k >> 1] >> 4) : (in[k >> 1] & 0x0f);
+                int32_t step = pgm_read_word(&imaStepTable[index[c]]);
+                int32_t diff = step >> 3;
+                if (nib & 1) {
+                    diff += step >> 2;
+                }
+                if (nib & 2) {
+                    diff += step >> 1;
+                }
+                if (nib & 4) {
+                    diff += step;
+                }
+                pred[c] = Clamp16((nib & 8) ? pred[c] - diff : pred[c] + diff);
+                index[c] += (int8_t)pgm_read_byte(&imaIndexTable[nib]);
+                index[c] = (index[c] < 0) ? 0 : ((index[c] > 88) ? 88 : index[c]);
+                out[k * 2 + c] = pred[c];
+                if (ch == 1) {
+                    out[k * 2 + 1] = pred[c];
+                }
+            }
+            in += 4;
+        }
+        out += n * 2;
+        frames -= n;
+    }
+}
+
+// Decodes one MS ADPCM block: predictor, delta and two history samples per
+// channel, then nibbles (high nibble first) interleaved by channel
+template<int ch>
+static void DecodeMSBlock(const uint8_t *in, int16_t *out, uint32_t frames) {
+    int32_t coef1[2], coef2[2], delta[2], s1[2], s2[2];
+    for (int c = 0; c < ch; c++) {
+        uint8_t p = (in[c] > 6) ? 0 : in[c];
+        coef1[c] = (int16_t)pgm_read_word(&msCoefTable[p][0]);
+        coef2[c] = (int16_t)pgm_read_word(&msCoefTable[p][1]);
+        delta[c] = ReadS16(in + ch + c * 2);
+        s1[c] = ReadS16(in + ch * 3 + c * 2);
+        s2[c] = ReadS16(in + ch * 5 + c * 2);
+    }
+    in += ch * 7;
+    // The history samples are the first two frames, oldest first
+    out[0] = s2[0];
+    out[1] = s2[ch - 1];
+    out[2] = s1[0];
+    out[3] = s1[ch - 1];
+    out += 4;
+    uint32_t nibbles = (frames - 2) * ch;
+    for (uint32_t i = 0; i < nibbles; i++) {
+        int c = (ch == 2) ? (i & 1) : 0;
+        uint8_t nib = (i & 1) ? (in[i >> 1] & 0x0f) : (in[i >> 1] >> 4);
+        int32_t pred = (s1[c] * coef1[c] + s2[c] * coef2[c]) / 256;
+        pred = Clamp16(pred + ((nib & 8) ? (int32_t)nib - 16 : nib) * delta[c]);
+        s2[c] = s1[c];
+        s1[c] = pred;
+        delta[c] = (pgm_read_word(&msAdaptTable[nib]) * delta[c]) >> 8;
+        if (delta[c] < 16) {
+            delta[c] = 16;
+        }
+        if (ch == 2) {
+            out[i] = pred;
+        } else {
+            out[i * 2] = pred;
+            out[i * 2 + 1] = pred;
+        }
+    }
+}
+
 AudioGeneratorWAV::AudioGeneratorWAV() {
     running = false;
     file = NULL;
     output = NULL;
-    buffSize = 128;
+    buffSize = 512;
     buff = NULL;
-    buffPtr = 0;
     buffLen = 0;
+    pcm = NULL;
+    block = NULL;
+    blockFrames = 0;
+    pcmPtr = 0;
+    pcmLen = 0;
+    convert = NULL;
+    blockAlign = 0;
+    samplesPerBlock = 1;
+    dataStart = 0;
+    dataBytes = 0;
+    totalFrames = 0;
+    framesLeft = 0;
+    skipFrames = 0;
 }
 
 AudioGeneratorWAV::~AudioGeneratorWAV() {
+    if (pcm != reinterpret_cast<int16_t *>(buff)) {
+        free(pcm);
+    }
     free(buff);
     buff = NULL;
+    pcm = NULL;
 }
 
 bool AudioGeneratorWAV::stop() {
@@ -41,8 +310,12 @@ bool AudioGeneratorWAV::stop() {
         return true;
     }
     running = false;
+    if (pcm != reinterpret_cast<int16_t *>(buff)) {
+        free(pcm);
+    }
     free(buff);
     buff = NULL;
+    pcm = NULL;
     output->stop();
     return file->close();
 }
@@ -52,25 +325,103 @@ bool AudioGeneratorWAV::isRunning() {
 }
 
 
-// Handle buffered reading, reload each time we run out of data
-bool AudioGeneratorWAV::GetBufferedData(int bytes, void *dest) {
-    if (!running) {
-        return false;    // Nothing to do here!
-    }
-    uint8_t *p = reinterpret_cast<uint8_t*>(dest);
-    while (bytes--) {
-        // Potentially load next batch of data...
-        if (buffPtr >= buffLen) {
-            buffPtr = 0;
-            uint32_t toRead = availBytes > buffSize ? buffSize : availBytes;
-            buffLen = file->read(buff, toRead);
-            availBytes -= buffLen;
+// Frames held in len bytes of a (possibly short) block
+uint32_t AudioGeneratorWAV::FramesInBlock(uint32_t len) {
+    uint32_t frames;
+    if (samplesPerBlock == 1) {
+        return len / bytesPerFrame;
+    } else if (format == WAVE_FORMAT_IMA_ADPCM) {
+        frames = (len < 4U * channels) ? 0 : 1 + ((len - 4 * channels) / (4 * channels)) * 8;
+    } else {
+        frames = (len < 7U * channels) ? 0 : 2 + ((len - 7 * channels) * 2) / channels;
+    }
+    return (frames > samplesPerBlock) ? samplesPerBlock : frames;
+}
+
+// Read the next block and convert it to 16-bit stereo.  PCM reads as many
+// whole frames as fit, ADPCM decodes exactly one block.
+bool AudioGeneratorWAV::FillBlock() {
+    uint32_t want = (samplesPerBlock == 1) ? blockFrames * bytesPerFrame : blockAlign;
+    if (buffLen && (samplesPerBlock == 1)) {
+        // A short read may have left a partial frame behind the last block
+        uint32_t used = pcmLen * bytesPerFrame;
+        buffLen -= used;
+        if (buffLen) {
+            memmove(buff, buff + used, buffLen);
+        }
+    } else {
+        buffLen = 0;
+    }
+    pcmPtr = 0;
+    pcmLen = 0;
+    block = pcm;
+    uint32_t frames;
+    uint32_t avail;
+    const uint8_t *mem = buffLen ? NULL : file->peek(&avail);
+    if (mem) {
+        // Memory-backed sources are converted straight from their bytes, with no copy into buff
+        if (avail > availBytes) {
+            avail = availBytes;
         }
-        if (buffPtr >= buffLen) {
+        if (avail > want) {
+            avail = want;
+        }
+        frames = FramesInBlock(avail);
+        if (!frames) {
+            return false;    // No data left!
+        }
+        uint32_t used = (samplesPerBlock == 1) ? frames * bytesPerFrame : avail;
+        if (convert) {
+            convert(mem, pcm, frames);
+        } else if (!((uintptr_t)mem & 1)) {
+            block = const_cast<int16_t *>(reinterpret_cast<const int16_t *>(mem));
+        } else {
+            memcpy(pcm, mem, used);
+        }
+        file->consume(used);
+        availBytes -= used;
+    } else {
+        uint32_t got;
+        do {
+            uint32_t toRead = want - buffLen;
+            if (toRead > availBytes) {
+                toRead = availBytes;
+            }
+            got = toRead ? file->read(buff + buffLen, toRead) : 0;
+            availBytes -= got;
+            buffLen += got;
+        } while ((buffLen < want) && got && ((samplesPerBlock > 1) || (buffLen < bytesPerFrame)));
+        frames = FramesInBlock(buffLen);
+        if (!frames) {
             return false;    // No data left!
         }
-        *(p++) = buff[buffPtr++];
+        if (convert) {
+            convert(buff, pcm, frames);
+        }
+    }
+    // Drop the padding at the end of the last ADPCM block, and any frames before a seek target
+    pcmLen = (frames > framesLeft) ? framesLeft : frames;
+    framesLeft -= pcmLen;
+    pcmPtr = (skipFrames > pcmLen) ? pcmLen : skipFrames;
+    skipFrames -= pcmPtr;
+    return pcmLen != 0;
+}
+
+bool AudioGeneratorWAV::seekFrame(uint32_t frame) {
+    if (!running || (frame > totalFrames)) {
+        return false;
     }
+    uint32_t block = frame / samplesPerBlock;
+    uint32_t offset = block * blockAlign;
+    if (!file->seek(dataStart + offset, SEEK_SET)) {
+        return false;
+    }
+    availBytes = dataBytes - offset;
+    framesLeft = totalFrames - block * samplesPerBlock;
+    skipFrames = frame - block * samplesPerBlock;
+    buffLen = 0;
+    pcmPtr = 0;
+    pcmLen = 0;
     return true;
 }
 
@@ -79,42 +430,15 @@ bool AudioGeneratorWAV::loop() {
         goto done;    // Nothing to do here!
     }
 
-    // First, try and push in the stored sample.  If we can't, then punt and try later
-    if (!output->ConsumeSample(lastSample)) {
-        goto done;    // Can't send, but no error detected
-    }
-
-    // Try and stuff the buffer one sample at a time
     do {
-        if (bitsPerSample == 8) {
-            uint8_t u8s; // For read u8 sample
-            if (!GetBufferedData(1, &u8s)) {
+        if (pcmPtr == pcmLen) {
+            if (!FillBlock()) {
                 stop();
-            }
-            // Upsample from unsigned 8 bits to signed 16 bits
-            lastSample[AudioOutput::LEFTCHANNEL] = ((int16_t)u8s - 128) << 8;
-            if (channels == 2) {
-                if (!GetBufferedData(1, &u8s)) {
-                    stop();
-                }
-                // Upsample from unsigned 8 bits to signed 16 bits
-                lastSample[AudioOutput::RIGHTCHANNEL] = ((int16_t)u8s - 128) << 8;
-            } else {
-                lastSample[AudioOutput::RIGHTCHANNEL] = lastSample[AudioOutput::LEFTCHANNEL];
-            }
-        } else if (bitsPerSample == 16) {
-            if (!GetBufferedData(2, &lastSample[AudioOutput::LEFTCHANNEL])) {
-                stop();
-            }
-            if (channels == 2) {
-                if (!GetBufferedData(2, &lastSample[AudioOutput::RIGHTCHANNEL])) {
-                    stop();
-                }
-            } else {
-                lastSample[AudioOutput::RIGHTCHANNEL] = lastSample[AudioOutput::LEFTCHANNEL];
+                goto done;
             }
         }
-    } while (running && output->ConsumeSample(lastSample));
+        pcmPtr += output->ConsumeSamples(block + pcmPtr * 2, pcmLen - pcmPtr);
+    } while (running && (pcmPtr == pcmLen));
 
 done:
     file->loop();
@@ -126,7 +450,6 @@ done:
 
 bool AudioGeneratorWAV::ReadWAVInfo() {
     uint32_t u32;
-    uint16_t u16;
     int toSkip;
 
     // WAV specification document:
@@ -174,26 +497,17 @@ bool AudioGeneratorWAV::ReadWAVInfo() {
         Serial.printf_P(PSTR("AudioGeneratorWAV::ReadWAVInfo: failed to read WAV data\n"));
         return false;
     };
-    if (u32 == 16) {
-        toSkip = 0;
-    } else if (u32 == 18) {
-        toSkip = 18 - 16;
-    } else if (u32 == 40) {
-        toSkip = 40 - 16;
-    } else {
-        Serial.printf_P(PSTR("AudioGeneratorWAV::ReadWAVInfo: cannot read WAV, appears not to be standard PCM \n"));
+    if ((u32 < 16) || (u32 > 1024)) {
+        Serial.printf_P(PSTR("AudioGeneratorWAV::ReadWAVInfo: cannot read WAV, invalid fmt chunk size\n"));
         return false;
-    } // we only do standard PCM
+    }
+    toSkip = (u32 - 16) + (u32 & 1); // Chunks are padded to even sizes
 
     // AudioFormat
-    if (!ReadU16(&u16)) {
+    if (!ReadU16(&format)) {
         Serial.printf_P(PSTR("AudioGeneratorWAV::ReadWAVInfo: failed to read WAV data\n"));
         return false;
     };
-    if (u16 != 1) {
-        Serial.printf_P(PSTR("AudioGeneratorWAV::ReadWAVInfo: cannot read WAV, AudioFormat appears not to be standard PCM \n"));
-        return false;
-    } // we only do standard PCM
 
     // NumChannels
     if (!ReadU16(&channels)) {
@@ -215,12 +529,12 @@ bool AudioGeneratorWAV::ReadWAVInfo() {
         return false;
     }  // Weird rate, punt.  Will need to check w/DAC to see if supported
 
-    // Ignore byterate and blockalign
+    // Ignore byterate, blockalign is only needed for ADPCM
     if (!ReadU32(&u32)) {
         Serial.printf_P(PSTR("AudioGeneratorWAV::ReadWAVInfo: failed to read WAV data\n"));
         return false;
     };
-    if (!ReadU16(&u16)) {
+    if (!ReadU16(&blockAlign)) {
         Serial.printf_P(PSTR("AudioGeneratorWAV::ReadWAVInfo: failed to read WAV data\n"));
         return false;
     };
@@ -230,10 +544,56 @@ bool AudioGeneratorWAV::ReadWAVInfo() {
         Serial.printf_P(PSTR("AudioGeneratorWAV::ReadWAVInfo: failed to read WAV data\n"));
         return false;
     };
-    if ((bitsPerSample != 8) && (bitsPerSample != 16)) {
-        Serial.printf_P(PSTR("AudioGeneratorWAV::ReadWAVInfo: cannot read WAV, only 8 or 16 bits is supported \n"));
+
+    // WAVE_FORMAT_EXTENSIBLE keeps the real format in the first 2 bytes of the SubFormat GUID
+    if ((format == WAVE_FORMAT_EXTENSIBLE) && (toSkip >= 24)) {
+        // cbSize, valid bits and channel mask are not needed
+        if (!ReadU32(&u32) || !ReadU32(&u32) || !ReadU16(&format)) {
+            Serial.printf_P(PSTR("AudioGeneratorWAV::ReadWAVInfo: failed to read WAV data\n"));
+            return false;
+        };
+        toSkip -= 10;
+    }
+
+    // Pick the block conversion here so loop() never has to look at the format again
+    bool stereo = channels == 2;
+    bool known = true;
+    uint32_t perBlock = 1;
+    bytesPerFrame = channels * (bitsPerSample / 8);
+    if ((format == WAVE_FORMAT_PCM) && (bitsPerSample == 8)) {
+        convert = stereo ? ConvertBlock<DecodeU8, 1, 2> : ConvertBlock<DecodeU8, 1, 1>;
+    } else if ((format == WAVE_FORMAT_PCM) && (bitsPerSample == 16)) {
+        convert = stereo ? NULL : ConvertBlock<DecodeS16, 2, 1>; // Stereo is read straight into pcm
+    } else if ((format == WAVE_FORMAT_PCM) && (bitsPerSample == 24)) {
+        convert = stereo ? ConvertBlock<DecodeS24, 3, 2> : ConvertBlock<DecodeS24, 3, 1>;
+    } else if ((format == WAVE_FORMAT_PCM) && (bitsPerSample == 32)) {
+        convert = stereo ? ConvertBlock<DecodeS32, 4, 2> : ConvertBlock<DecodeS32, 4, 1>;
+    } else if ((format == WAVE_FORMAT_IEEE_FLOAT) && (bitsPerSample == 32)) {
+        convert = stereo ? ConvertBlock<DecodeF32, 4, 2> : ConvertBlock<DecodeF32, 4, 1>;
+    } else if ((format == WAVE_FORMAT_ALAW) && (bitsPerSample == 8)) {
+        convert = stereo ? ConvertBlock<DecodeALaw, 1, 2> : ConvertBlock<DecodeALaw, 1, 1>;
+    } else if ((format == WAVE_FORMAT_MULAW) && (bitsPerSample == 8)) {
+        convert = stereo ? ConvertBlock<DecodeULaw, 1, 2> : ConvertBlock<DecodeULaw, 1, 1>;
+    } else if ((format == WAVE_FORMAT_IMA_ADPCM) && (bitsPerSample == 4) && (blockAlign >= 4 * channels)) {
+        convert = stereo ? DecodeIMABlock<2> : DecodeIMABlock<1>;
+        perBlock = 1 + ((blockAlign - 4 * channels) / (4 * channels)) * 8;
+    } else if ((format == WAVE_FORMAT_ADPCM) && (bitsPerSample == 4) && (blockAlign >= 7 * channels)) {
+        // Coefficients in the header are always the 7 standard ones, so they come from flash instead
+        convert = stereo ? DecodeMSBlock<2> : DecodeMSBlock<1>;
+        perBlock = 2 + ((blockAlign - 7 * channels) * 2) / channels;
+    } else {
+        known = false;
+    }
+    if (!known || (perBlock > 65535)) {
+        Serial.printf_P(PSTR("AudioGeneratorWAV::ReadWAVInfo: cannot read WAV, unsupported format %d with %d bits\n"), format, bitsPerSample);
         return false;
-    }  // Only 8 or 16 bits
+    }
+    samplesPerBlock = perBlock;
+    if (samplesPerBlock == 1) {
+        blockAlign = bytesPerFrame;
+    } else {
+        bytesPerFrame = 1; // Unused, ADPCM reads whole blocks
+    }
 
     // Skip any extra header
     while (toSkip) {
@@ -246,6 +606,7 @@ bool AudioGeneratorWAV::ReadWAVInfo() {
     }
 
     // look for data subchunk
+    uint32_t factFrames = 0;
     do {
         // id == "data"
         if (!ReadU32(&u32)) {
@@ -255,12 +616,21 @@ bool AudioGeneratorWAV::ReadWAVInfo() {
         if (u32 == 0x61746164) {
             break;    // "data"
         }
+        uint32_t id = u32;
         // Skip size, read until end of chunk
         if (!ReadU32(&u32)) {
             Serial.printf_P(PSTR("AudioGeneratorWAV::ReadWAVInfo: failed to read WAV data\n"));
             return false;
         };
-        if (!file->seek(u32, SEEK_CUR)) {
+        // "fact" holds the real length of compressed data, whose last block is padded
+        if ((id == 0x74636166) && (u32 >= 4)) {
+            if (!ReadU32(&factFrames)) {
+                Serial.printf_P(PSTR("AudioGeneratorWAV::ReadWAVInfo: failed to read WAV data\n"));
+                return false;
+            };
+            u32 -= 4;
+        }
+        if (!file->seek(u32 + (u32 & 1), SEEK_CUR)) {
             Serial.printf_P(PSTR("AudioGeneratorWAV::ReadWAVInfo: failed to read WAV data, seek failed\n"));
             return false;
         }
@@ -276,15 +646,39 @@ bool AudioGeneratorWAV::ReadWAVInfo() {
         return false;
     };
     availBytes = u32;
+    dataBytes = u32;
+    dataStart = file->getPos();
+    totalFrames = (dataBytes / blockAlign) * samplesPerBlock + FramesInBlock(dataBytes % blockAlign);
+    if (factFrames && (samplesPerBlock > 1) && (factFrames < totalFrames)) {
+        totalFrames = factFrames;
+    }
+    framesLeft = totalFrames;
+    skipFrames = 0;
 
-    // Now set up the buffer or fail
-    buff = reinterpret_cast<uint8_t *>(malloc(buffSize));
-    if (!buff) {
+    // Now set up the buffers or fail.  ADPCM always works on one whole block.
+    if (samplesPerBlock > 1) {
+        blockFrames = samplesPerBlock;
+    } else {
+        blockFrames = (buffSize / 4 > 65535) ? 65535 : (buffSize / 4);
+    }
+    if (!blockFrames) {
+        blockFrames = 1;
+    }
+    buff = reinterpret_cast<uint8_t *>(malloc((samplesPerBlock > 1) ? blockAlign : blockFrames * bytesPerFrame));
+    pcm = convert ? reinterpret_cast<int16_t *>(malloc(blockFrames * 4)) : reinterpret_cast<int16_t *>(buff);
+    if (!buff || !pcm) {
         Serial.printf_P(PSTR("AudioGeneratorWAV::ReadWAVInfo: cannot read WAV, failed to set up buffer \n"));
+        if (pcm != reinterpret_cast<int16_t *>(buff)) {
+            free(pcm);
+        }
+        free(buff);
+        buff = NULL;
+        pcm = NULL;
         return false;
     };
-    buffPtr = 0;
     buffLen = 0;
+    pcmPtr = 0;
+    pcmLen = 0;
 
     return true;
 }
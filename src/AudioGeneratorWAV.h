@@ -1,6 +1,6 @@
 /*
     AudioGeneratorWAV
-    Audio output generator that reads 8 and 16-bit WAV files
+    Audio output generator that reads PCM, float, G.711 and ADPCM WAV files
 
     Copyright (C) 2017  Earle F. Philhower, III
 
@@ -34,6 +34,11 @@ public:
     void SetBufferSize(int sz) {
         buffSize = sz;
     }
+    // Jump to an exact frame.  ADPCM seeks to the enclosing block and decodes up to the frame.
+    bool seekFrame(uint32_t frame);
+    uint32_t frames() {
+        return totalFrames;
+    }
 
 private:
     bool ReadU32(uint32_t *dest) {
@@ -45,23 +50,43 @@ private:
     bool ReadU8(uint8_t *dest) {
         return file->read(reinterpret_cast<uint8_t*>(dest), 1);
     }
-    bool GetBufferedData(int bytes, void *dest);
     bool ReadWAVInfo();
-
+    bool FillBlock();
+    uint32_t FramesInBlock(uint32_t len);
 
 protected:
+    // Converts a block of raw frames into 16-bit stereo
+    typedef void (*ConvertFn)(const uint8_t *in, int16_t *out, uint32_t frames);
+
     // WAV info
+    uint16_t format;
     uint16_t channels;
     uint32_t sampleRate;
     uint16_t bitsPerSample;
+    uint16_t bytesPerFrame;
+    uint16_t blockAlign;      // ADPCM block size in bytes, same as bytesPerFrame for PCM
+    uint16_t samplesPerBlock; // Frames in each ADPCM block, 1 for PCM
 
+    uint32_t dataStart;
+    uint32_t dataBytes;
     uint32_t availBytes;
+    uint32_t totalFrames;
+    uint32_t framesLeft;
+    uint32_t skipFrames;      // Frames to drop from the next block after a seek
+
+    // Chosen once in ReadWAVInfo, NULL when the data is already 16-bit stereo
+    ConvertFn convert;
 
-    // We need to buffer some data in-RAM to avoid doing 1000s of small reads
+    // Whole blocks are read into buff and converted into pcm, which is the
+    // same memory when no conversion is needed.  buffSize sets the pcm size.
     uint32_t buffSize;
     uint8_t *buff;
-    uint16_t buffPtr;
-    uint16_t buffLen;
+    uint32_t buffLen;
+    int16_t *pcm;
+    int16_t *block; // Frames being sent, either pcm or straight from a memory-backed source
+    uint16_t blockFrames;
+    uint16_t pcmPtr;
+    uint16_t pcmLen;
 };
 
 #endif
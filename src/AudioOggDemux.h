@@ -0,0 +1,118 @@
+/*
+    AudioOggDemux
+    Page-at-a-time Ogg demuxer shared by the Ogg based generators
+
+    Copyright (C) 2025  Earle F. Philhower, III
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _AUDIOOGGDEMUX_H
+#define _AUDIOOGGDEMUX_H
+
+#include <Arduino.h>
+#include "AudioFileSource.h"
+
+// Reads whole Ogg pages (header, lacing and payload in three reads), checks the page CRC,
+// and hands back packets built from the lacing values.  Packets that fit in one page are
+// returned in place, only packets continued across pages are copied.  The page buffer grows
+// to the largest page seen, which the format bounds at 65307 bytes.  Sources that can be
+// peek()ed skip the page buffer entirely and packets point straight into their memory.
+class AudioOggDemux {
+public:
+    AudioOggDemux();
+    ~AudioOggDemux();
+
+    // Start on a new source.  Bytes already read from it (e.g. to sniff "OggS") can be given back.
+    bool begin(AudioFileSource *source, const uint8_t *pre = nullptr, uint32_t preLen = 0);
+    void end();
+    // Forget the current page and any partial packet, e.g. after seeking the source
+    void flush();
+
+    // Next complete packet of any logical stream, valid until the next call.  False at the
+    // end of the data (or if the source had nothing to give yet, call again later).
+    bool nextPacket(const uint8_t **data, uint32_t *len);
+
+    // Look ahead at the n'th packet after the last one returned that is wholly on the current
+    // page, without consuming it.  Valid until the next call to nextPacket().
+    bool peekPacket(uint32_t n, const uint8_t **data, uint32_t *len) const;
+
+    // Read the next whole page without returning any of its packets yet, for scanning and seeking
+    bool nextPage();
+    // Drop the packets completed on the current page.  A packet it starts but doesn't finish is
+    // kept, so the next packet returned starts exactly at this page's granule position.
+    void skipPagePackets();
+    // File offset of the current page, only meaningful if the source supports getPos()
+    uint32_t pageOffset() const {
+        return pageStart;
+    }
+
+    // Header fields of the page the last packet completed on
+    uint64_t granule() const;
+    uint32_t serial() const;
+    uint32_t sequence() const;
+    bool bos() const {
+        return pg[5] & 2;
+    }
+    bool eos() const {
+        return pg[5] & 4;
+    }
+    // True if the last packet was the final one completed on its page, so granule() is its end
+    bool lastOnPage() const;
+
+    uint32_t crcErrors() const {
+        return crcErr;
+    }
+
+    // Largest packet continued across pages that will be put together, so a corrupt or hostile
+    // stream can't take the whole heap.  A bigger one ends the stream and sets packetTooLarge().
+    // The default, 255*255 bytes, is one full page.  Raise it for e.g. large embedded cover art.
+    void setMaxPacket(uint32_t bytes) {
+        maxPkt = bytes;
+    }
+    bool packetTooLarge() const {
+        return pktTooLarge;
+    }
+
+    static uint32_t crc(uint32_t crc, const uint8_t *data, uint32_t len);
+
+protected:
+    bool fill(uint32_t need, uint32_t atLeast = 0);
+    bool readPage();
+    bool mapPage();
+    void startPage(const uint8_t *p, uint32_t len);
+    static bool checkCRC(const uint8_t *p, uint32_t len);
+    void resync(uint32_t from);
+    bool append(const uint8_t *data, uint32_t len);
+
+    AudioFileSource *file;
+    uint8_t *page; // Buffer the current page is read into
+    const uint8_t *pg; // Header, lacing and payload of the current page, in page or the source's memory
+    uint32_t pageSize;
+    uint32_t have; // Bytes of the current page read so far
+    uint32_t pageLen; // 0 until a whole page has been read and checked
+    uint32_t pageStart;
+    uint16_t seg; // Next lacing value to use
+    uint32_t off; // Payload offset of the next packet
+    uint8_t *pkt; // Packet continued across pages
+    uint32_t pktSize;
+    uint32_t pktLen;
+    bool pktPartial;
+    uint32_t maxPkt;
+    bool pktTooLarge; // Latched until begin() or flush()
+    uint32_t crcErr;
+    uint8_t empty[27]; // Stand in page header before the first page is read
+};
+
+#endif
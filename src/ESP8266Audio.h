@@ -13,6 +13,7 @@
 #include "AudioFileSourceICYStream.h"
 #include "AudioFileSourceID3.h"
 #include "AudioFileSourceLittleFS.h"
+#include "AudioFileSourceMMAP.h"
 #include "AudioFileSourcePROGMEM.h"
 #include "AudioFileSourceSD.h"
 #include "AudioFileSourceSPIFFS.h"
@@ -22,6 +23,7 @@
 // Misc. plumbing
 #include "AudioFileStream.h"
 #include "AudioLogger.h"
+#include "AudioOggDemux.h"
 #include "AudioStatus.h"
 
 // Actual decode/audio generation logic
@@ -21,7 +21,12 @@
 #define CPU_IS_LITTLE_ENDIAN 1
 
 /* Set FLAC__BYTES_PER_WORD to 8 (4 is the default) */
+#if !defined(ARDUINO) && (defined(__x86_64__) || defined(__aarch64__))
+/* 64-bit hosts read the bitstream (and Rice residuals) a machine word at a time */
+#define ENABLE_64_BIT_WORDS 1
+#else
 #define ENABLE_64_BIT_WORDS 0
+#endif
 
 /* define to align allocated memory on 32-byte boundaries */
 #define FLAC__ALIGN_MALLOC_DATA 1
@@ -39,7 +44,7 @@
 /* #undef FLAC__CPU_SPARC */
 
 /* define if building for x86_64 */
-#undef FLAC__CPU_X86_64
+/* #undef FLAC__CPU_X86_64 */
 
 /* define if you have docbook-to-man or docbook2man */
 #undef FLAC__HAS_DOCBOOK_TO_MAN
@@ -51,10 +56,17 @@
 #define FLAC__HAS_OGG 0
 
 /* Set to 1 if <x86intrin.h> is available. */
-#undef FLAC__HAS_X86INTRIN
+/* #undef FLAC__HAS_X86INTRIN */
 
 /* define to disable use of assembly code */
+#if !defined(ARDUINO) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/* Host builds get the SSE4.1/AVX2 intrinsics, picked at runtime by FLAC__cpu_info() */
+#define FLAC__HAS_X86INTRIN 1
+#define FLAC__USE_AVX
+#define HAVE_CPUID_H 1
+#else
 #define FLAC__NO_ASM 1
+#endif
 
 /* define if building for Darwin / MacOS X */
 /* #undef FLAC__SYS_DARWIN */
@@ -66,7 +78,7 @@
 #undef FLAC__USE_ALTIVEC
 
 /* define to enable use of AVX instructions */
-#undef FLAC__USE_AVX
+/* #undef FLAC__USE_AVX */
 
 /* Compiler has the __builtin_bswap16 intrinsic */
 #undef HAVE_BSWAP16
@@ -81,7 +93,7 @@
 #undef HAVE_CLOCK_GETTIME
 
 /* Define to 1 if you have the <cpuid.h> header file. */
-#undef HAVE_CPUID_H
+/* #undef HAVE_CPUID_H */
 
 /* Define to 1 if C++ supports variable-length arrays. */
 #define HAVE_CXX_VARARRAYS 1
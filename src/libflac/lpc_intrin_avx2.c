@@ -0,0 +1,286 @@
+/*  libFLAC - Free Lossless Audio Codec library
+    Copyright (C) 2000-2009  Josh Coalson
+    Copyright (C) 2011-2016  Xiph.Org Foundation
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+
+    - Neither the name of the Xiph.org Foundation nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE FOUNDATION OR
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+    EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+    PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+    PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+    NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//#ifdef HAVE_CONFIG_H
+#  include "config.h"
+//#endif
+
+#include "private/cpu.h"
+
+#ifndef FLAC__INTEGER_ONLY_LIBRARY
+#ifndef FLAC__NO_ASM
+#if (defined FLAC__CPU_IA32 || defined FLAC__CPU_X86_64) && FLAC__HAS_X86INTRIN
+#include "private/lpc.h"
+#ifdef FLAC__AVX2_SUPPORTED
+
+#include "FLAC/assert.h"
+#include "FLAC/format.h"
+
+#include <immintrin.h> /* AVX2 */
+
+#pragma GCC optimize ("O3")
+
+/*
+    Same scheme as lpc_intrin_sse41.c (three scalar taps, the older taps as a
+    vector dot product over a register-resident history) with 8 lanes per
+    register.  PALIGNR only works within 128-bit halves, so each history
+    register is shifted by pairing it with the next one through VPERM2I128.
+*/
+
+#define SCALAR_TAPS 3
+
+/* Lowest orders where these beat the SSE4.1 versions (measured on x86_64) */
+#define MIN_ORDER 13
+#define MIN_ORDER_16 16
+#define MIN_ORDER_WIDE 11
+
+/* lane k of 8 reversed, so coefficients line up with the oldest-first history */
+#define REVERSE_(v) _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0))
+
+/*
+    As in lpc_intrin_sse41.c only group 0 can have padding lanes, so it is
+    built lane by lane and the rest are loaded straight from data[] and
+    qlp_coeff[], which keeps every vector out of memory.
+*/
+FLAC__SSE_TARGET("avx2")
+static inline __attribute__((always_inline)) void load_history_(const FLAC__int32 data[], uint32_t order, const uint32_t groups, __m256i hist[], const FLAC__int32 qlp_coeff[], __m256i coeff[]) {
+    FLAC__int32 h[8], c[8];
+    uint32_t g, k;
+
+    for (k = 0; k < 8; k++) {
+        uint32_t back = groups * 8 - k + SCALAR_TAPS; /* this lane holds data[i - back] */
+        h[k] = (back <= order) ? data[-(int)back] : 0;
+        c[k] = (back <= order) ? qlp_coeff[back - 1] : 0;
+    }
+    hist[0] = _mm256_loadu_si256((const __m256i *)h);
+    coeff[0] = _mm256_loadu_si256((const __m256i *)c);
+    for (g = 1; g < groups; g++) {
+        hist[g] = _mm256_loadu_si256((const __m256i *)(data - (groups - g) * 8 - SCALAR_TAPS));
+        coeff[g] = REVERSE_(_mm256_loadu_si256((const __m256i *)(qlp_coeff + (groups - g) * 8 - 5)));
+    }
+}
+
+/* Same with 16 lanes of 16 bits, for when the samples and coefficients are known to fit */
+FLAC__SSE_TARGET("avx2")
+static inline __attribute__((always_inline)) void load_history_16_(const FLAC__int32 data[], uint32_t order, const uint32_t groups, __m256i hist[], const FLAC__int32 qlp_coeff[], __m256i coeff[]) {
+    FLAC__int16 h[16], c[16];
+    uint32_t g, k;
+
+    for (k = 0; k < 16; k++) {
+        uint32_t back = groups * 16 - k + SCALAR_TAPS;
+        h[k] = (back <= order) ? (FLAC__int16)data[-(int)back] : 0;
+        c[k] = (back <= order) ? (FLAC__int16)qlp_coeff[back - 1] : 0;
+    }
+    hist[0] = _mm256_loadu_si256((const __m256i *)h);
+    coeff[0] = _mm256_loadu_si256((const __m256i *)c);
+    for (g = 1; g < groups; g++) {
+        const FLAC__int32 *d = data - (groups - g) * 16 - SCALAR_TAPS;
+        const FLAC__int32 *q = qlp_coeff + (groups - g) * 16 - 13;
+        /* VPACKSSDW interleaves the 128-bit halves, so put them back in order */
+        hist[g] = _mm256_permute4x64_epi64(_mm256_packs_epi32(_mm256_loadu_si256((const __m256i *)d), _mm256_loadu_si256((const __m256i *)(d + 8))), _MM_SHUFFLE(3, 1, 2, 0));
+        coeff[g] = _mm256_permute4x64_epi64(_mm256_packs_epi32(REVERSE_(_mm256_loadu_si256((const __m256i *)(q + 8))), REVERSE_(_mm256_loadu_si256((const __m256i *)q))), _MM_SHUFFLE(3, 1, 2, 0));
+    }
+}
+
+/* Shift every history lane down by one 32-bit (or 16-bit) sample, feeding in x at the top */
+#define SHIFT_HISTORY(bytes) \
+    do { \
+        for (g = 0; g + 1 < groups; g++) { \
+            hist[g] = _mm256_alignr_epi8(_mm256_permute2x128_si256(hist[g], hist[g + 1], 0x21), hist[g], bytes); \
+        } \
+        hist[groups - 1] = _mm256_alignr_epi8(_mm256_permute2x128_si256(hist[groups - 1], _mm256_castsi128_si256(_mm_cvtsi32_si128(x3)), 0x21), hist[groups - 1], bytes); \
+    } while (0)
+
+FLAC__SSE_TARGET("avx2")
+static inline __attribute__((always_inline)) FLAC__int32 hsum_epi32_(__m256i acc) {
+    __m128i a = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    a = _mm_add_epi32(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)));
+    a = _mm_add_epi32(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(a);
+}
+
+FLAC__SSE_TARGET("avx2")
+static inline __attribute__((always_inline)) void restore_signal_groups_(const FLAC__int32 residual[], uint32_t data_len, const FLAC__int32 qlp_coeff[], const __m256i coeff[], __m256i hist[], const uint32_t groups, int lp_quantization, FLAC__int32 data[]) {
+    const FLAC__uint32 c0 = qlp_coeff[0], c1 = qlp_coeff[1], c2 = qlp_coeff[2];
+    FLAC__int32 x1 = data[-1], x2 = data[-2], x3 = data[-3];
+    uint32_t i, g;
+    for (i = 0; i < data_len; i++) {
+        __m256i acc = _mm256_mullo_epi32(coeff[0], hist[0]);
+        FLAC__uint32 sum;
+        FLAC__int32 x;
+        for (g = 1; g < groups; g++) {
+            acc = _mm256_add_epi32(acc, _mm256_mullo_epi32(coeff[g], hist[g]));
+        }
+        sum = (FLAC__uint32)hsum_epi32_(acc) + c2 * (FLAC__uint32)x3 + c1 * (FLAC__uint32)x2 + c0 * (FLAC__uint32)x1;
+        x = residual[i] + ((FLAC__int32)sum >> lp_quantization);
+        data[i] = x;
+        SHIFT_HISTORY(4);
+        x3 = x2;
+        x2 = x1;
+        x1 = x;
+    }
+}
+
+/*
+    One function per group count, each holding only the vectors it uses, so
+    the loops unroll fully and no frame carries the 32nd order's worth of them.
+*/
+#define RESTORE_GROUPS_(kind, load, n) \
+FLAC__SSE_TARGET("avx2") \
+static __attribute__((noinline)) void restore_signal_##kind##g##n##_(const FLAC__int32 residual[], uint32_t data_len, const FLAC__int32 qlp_coeff[], uint32_t order, int lp_quantization, FLAC__int32 data[]) { \
+    __m256i hist[n], coeff[n]; \
+    load(data, order, n, hist, qlp_coeff, coeff); \
+    restore_signal_##kind##groups_(residual, data_len, qlp_coeff, coeff, hist, n, lp_quantization, data); \
+}
+
+RESTORE_GROUPS_(, load_history_, 1)
+RESTORE_GROUPS_(, load_history_, 2)
+RESTORE_GROUPS_(, load_history_, 3)
+RESTORE_GROUPS_(, load_history_, 4)
+
+void FLAC__lpc_restore_signal_intrin_avx2(const FLAC__int32 residual[], uint32_t data_len, const FLAC__int32 qlp_coeff[], uint32_t order, int lp_quantization, FLAC__int32 data[]) {
+    FLAC__ASSERT(order > 0);
+    FLAC__ASSERT(order <= 32);
+
+    if (order < MIN_ORDER) {
+        FLAC__lpc_restore_signal_intrin_sse41(residual, data_len, qlp_coeff, order, lp_quantization, data);
+        return;
+    }
+
+    switch ((order - SCALAR_TAPS + 7) / 8) {
+    case 1: restore_signal_g1_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 2: restore_signal_g2_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 3: restore_signal_g3_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    default: restore_signal_g4_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    }
+}
+
+FLAC__SSE_TARGET("avx2")
+static inline __attribute__((always_inline)) void restore_signal_16_groups_(const FLAC__int32 residual[], uint32_t data_len, const FLAC__int32 qlp_coeff[], const __m256i coeff[], __m256i hist[], const uint32_t groups, int lp_quantization, FLAC__int32 data[]) {
+    const FLAC__uint32 c0 = qlp_coeff[0], c1 = qlp_coeff[1], c2 = qlp_coeff[2];
+    FLAC__int32 x1 = data[-1], x2 = data[-2], x3 = data[-3];
+    uint32_t i, g;
+    for (i = 0; i < data_len; i++) {
+        __m256i acc = _mm256_madd_epi16(coeff[0], hist[0]);
+        FLAC__uint32 sum;
+        FLAC__int32 x;
+        for (g = 1; g < groups; g++) {
+            acc = _mm256_add_epi32(acc, _mm256_madd_epi16(coeff[g], hist[g]));
+        }
+        sum = (FLAC__uint32)hsum_epi32_(acc) + c2 * (FLAC__uint32)x3 + c1 * (FLAC__uint32)x2 + c0 * (FLAC__uint32)x1;
+        x = residual[i] + ((FLAC__int32)sum >> lp_quantization);
+        data[i] = x;
+        SHIFT_HISTORY(2);
+        x3 = x2;
+        x2 = x1;
+        x1 = x;
+    }
+}
+
+RESTORE_GROUPS_(16_, load_history_16_, 1)
+RESTORE_GROUPS_(16_, load_history_16_, 2)
+
+void FLAC__lpc_restore_signal_16_intrin_avx2(const FLAC__int32 residual[], uint32_t data_len, const FLAC__int32 qlp_coeff[], uint32_t order, int lp_quantization, FLAC__int32 data[]) {
+    FLAC__ASSERT(order > 0);
+    FLAC__ASSERT(order <= 32);
+
+    if (order < MIN_ORDER_16) {
+        FLAC__lpc_restore_signal_16_intrin_sse41(residual, data_len, qlp_coeff, order, lp_quantization, data);
+        return;
+    }
+
+    if ((order - SCALAR_TAPS + 15) / 16 == 1) {
+        restore_signal_16_g1_(residual, data_len, qlp_coeff, order, lp_quantization, data);
+    } else {
+        restore_signal_16_g2_(residual, data_len, qlp_coeff, order, lp_quantization, data);
+    }
+}
+
+FLAC__SSE_TARGET("avx2")
+static inline __attribute__((always_inline)) void restore_signal_wide_groups_(const FLAC__int32 residual[], uint32_t data_len, const FLAC__int32 qlp_coeff[], const __m256i coeff[], __m256i hist[], const uint32_t groups, int lp_quantization, FLAC__int32 data[]) {
+    const FLAC__int64 c0 = qlp_coeff[0], c1 = qlp_coeff[1], c2 = qlp_coeff[2];
+    FLAC__int32 x1 = data[-1], x2 = data[-2], x3 = data[-3];
+    uint32_t i, g;
+    for (i = 0; i < data_len; i++) {
+        __m256i acc = _mm256_add_epi64(_mm256_mul_epi32(coeff[0], hist[0]), _mm256_mul_epi32(_mm256_srli_epi64(coeff[0], 32), _mm256_srli_epi64(hist[0], 32)));
+        __m128i a;
+        FLAC__int64 sum;
+        FLAC__int32 x;
+        for (g = 1; g < groups; g++) {
+            /* Reloaded each time, for the same reason as in lpc_intrin_sse41.c */
+            __m256i c = REVERSE_(_mm256_loadu_si256((const __m256i *)(qlp_coeff + (groups - g) * 8 - 5)));
+            acc = _mm256_add_epi64(acc, _mm256_mul_epi32(c, hist[g]));
+            acc = _mm256_add_epi64(acc, _mm256_mul_epi32(_mm256_srli_epi64(c, 32), _mm256_srli_epi64(hist[g], 32)));
+        }
+        a = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+        a = _mm_add_epi64(a, _mm_unpackhi_epi64(a, a));
+#if defined FLAC__CPU_X86_64
+        sum = _mm_cvtsi128_si64(a);
+#else
+        _mm_storel_epi64((__m128i *)&sum, a);
+#endif
+        sum += c2 * x3 + c1 * x2 + c0 * x1;
+        x = residual[i] + (FLAC__int32)(sum >> lp_quantization);
+        data[i] = x;
+        SHIFT_HISTORY(4);
+        x3 = x2;
+        x2 = x1;
+        x1 = x;
+    }
+}
+
+RESTORE_GROUPS_(wide_, load_history_, 1)
+RESTORE_GROUPS_(wide_, load_history_, 2)
+RESTORE_GROUPS_(wide_, load_history_, 3)
+RESTORE_GROUPS_(wide_, load_history_, 4)
+
+void FLAC__lpc_restore_signal_wide_intrin_avx2(const FLAC__int32 residual[], uint32_t data_len, const FLAC__int32 qlp_coeff[], uint32_t order, int lp_quantization, FLAC__int32 data[]) {
+    FLAC__ASSERT(order > 0);
+    FLAC__ASSERT(order <= 32);
+
+    if (order < MIN_ORDER_WIDE) {
+        FLAC__lpc_restore_signal_wide_intrin_sse41(residual, data_len, qlp_coeff, order, lp_quantization, data);
+        return;
+    }
+
+    switch ((order - SCALAR_TAPS + 7) / 8) {
+    case 1: restore_signal_wide_g1_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 2: restore_signal_wide_g2_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 3: restore_signal_wide_g3_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    default: restore_signal_wide_g4_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    }
+}
+
+#endif /* FLAC__AVX2_SUPPORTED */
+#endif /* (FLAC__CPU_IA32 || FLAC__CPU_X86_64) && FLAC__HAS_X86INTRIN */
+#endif /* FLAC__NO_ASM */
+#endif /* FLAC__INTEGER_ONLY_LIBRARY */
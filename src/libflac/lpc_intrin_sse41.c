@@ -0,0 +1,323 @@
+/*  libFLAC - Free Lossless Audio Codec library
+    Copyright (C) 2000-2009  Josh Coalson
+    Copyright (C) 2011-2016  Xiph.Org Foundation
+
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions
+    are met:
+
+    - Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    - Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+
+    - Neither the name of the Xiph.org Foundation nor the names of its
+    contributors may be used to endorse or promote products derived from
+    this software without specific prior written permission.
+
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+    ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+    LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+    A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE FOUNDATION OR
+    CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+    EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+    PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+    PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+    LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+    NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+//#ifdef HAVE_CONFIG_H
+#  include "config.h"
+//#endif
+
+#include "private/cpu.h"
+
+#ifndef FLAC__INTEGER_ONLY_LIBRARY
+#ifndef FLAC__NO_ASM
+#if (defined FLAC__CPU_IA32 || defined FLAC__CPU_X86_64) && FLAC__HAS_X86INTRIN
+#include "private/lpc.h"
+#ifdef FLAC__SSE4_1_SUPPORTED
+
+#include "FLAC/assert.h"
+#include "FLAC/format.h"
+
+#include <smmintrin.h> /* SSE4.1 */
+
+#pragma GCC optimize ("O3")
+
+/*
+    The predictor is recursive: every sample needs the one just restored.  A
+    vector dot product plus horizontal sum is much slower than one sample
+    period, so the three newest taps are done in scalar code and the vector
+    part only covers data[i-4] and older.  The vector result then isn't needed
+    until four samples later, and its latency overlaps the scalar chain.
+
+    The last 4*G samples older than data[i-3] are kept in G registers and the
+    newest is shifted in from the top with PALIGNR, so nothing is reloaded from
+    data[] (which would stall on store forwarding).  Lanes older than
+    data[i-order] get a zero coefficient.
+
+    Sums are computed modulo 2^32 (or exactly in 64 bits for the _wide version),
+    so the output is bit exact with FLAC__lpc_restore_signal() and
+    FLAC__lpc_restore_signal_wide().  Low orders are already latency bound in
+    the unrolled C code, so those are passed straight through.
+*/
+
+#define SCALAR_TAPS 3
+
+/* Lowest orders where these beat the unrolled C code (measured on x86_64) */
+#define MIN_ORDER 8
+#define MIN_ORDER_16 7
+#define MIN_ORDER_WIDE 9
+
+/* lane k of 4 reversed, so coefficients line up with the oldest-first history */
+#define REVERSE_(v) _mm_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3))
+
+/*
+    Only group 0 can have padding lanes, which may be older than the caller's
+    history, so it is built lane by lane.  The rest are loaded straight from
+    data[] and qlp_coeff[], which keeps every vector out of memory.
+*/
+FLAC__SSE_TARGET("sse4.1")
+static inline __attribute__((always_inline)) void load_history_(const FLAC__int32 data[], uint32_t order, const uint32_t groups, __m128i hist[], const FLAC__int32 qlp_coeff[], __m128i coeff[]) {
+    FLAC__int32 h[4], c[4];
+    uint32_t g, k;
+
+    for (k = 0; k < 4; k++) {
+        uint32_t back = groups * 4 - k + SCALAR_TAPS; /* this lane holds data[i - back] */
+        h[k] = (back <= order) ? data[-(int)back] : 0;
+        c[k] = (back <= order) ? qlp_coeff[back - 1] : 0;
+    }
+    hist[0] = _mm_loadu_si128((const __m128i *)h);
+    coeff[0] = _mm_loadu_si128((const __m128i *)c);
+    for (g = 1; g < groups; g++) {
+        hist[g] = _mm_loadu_si128((const __m128i *)(data - (groups - g) * 4 - SCALAR_TAPS));
+        coeff[g] = REVERSE_(_mm_loadu_si128((const __m128i *)(qlp_coeff + (groups - g) * 4 - 1)));
+    }
+}
+
+/* Same with 8 lanes of 16 bits, for when the samples and coefficients are known to fit */
+FLAC__SSE_TARGET("sse4.1")
+static inline __attribute__((always_inline)) void load_history_16_(const FLAC__int32 data[], uint32_t order, const uint32_t groups, __m128i hist[], const FLAC__int32 qlp_coeff[], __m128i coeff[]) {
+    FLAC__int16 h[8], c[8];
+    uint32_t g, k;
+
+    for (k = 0; k < 8; k++) {
+        uint32_t back = groups * 8 - k + SCALAR_TAPS;
+        h[k] = (back <= order) ? (FLAC__int16)data[-(int)back] : 0;
+        c[k] = (back <= order) ? (FLAC__int16)qlp_coeff[back - 1] : 0;
+    }
+    hist[0] = _mm_loadu_si128((const __m128i *)h);
+    coeff[0] = _mm_loadu_si128((const __m128i *)c);
+    for (g = 1; g < groups; g++) {
+        const FLAC__int32 *d = data - (groups - g) * 8 - SCALAR_TAPS;
+        const FLAC__int32 *q = qlp_coeff + (groups - g) * 8 - 5;
+        hist[g] = _mm_packs_epi32(_mm_loadu_si128((const __m128i *)d), _mm_loadu_si128((const __m128i *)(d + 4)));
+        coeff[g] = _mm_packs_epi32(REVERSE_(_mm_loadu_si128((const __m128i *)(q + 4))), REVERSE_(_mm_loadu_si128((const __m128i *)q)));
+    }
+}
+
+FLAC__SSE_TARGET("sse4.1")
+static inline __attribute__((always_inline)) void restore_signal_groups_(const FLAC__int32 residual[], uint32_t data_len, const FLAC__int32 qlp_coeff[], const __m128i coeff[], __m128i hist[], const uint32_t groups, int lp_quantization, FLAC__int32 data[]) {
+    const FLAC__uint32 c0 = qlp_coeff[0], c1 = qlp_coeff[1], c2 = qlp_coeff[2];
+    FLAC__int32 x1 = data[-1], x2 = data[-2], x3 = data[-3];
+    uint32_t i, g;
+    for (i = 0; i < data_len; i++) {
+        __m128i acc = _mm_mullo_epi32(coeff[0], hist[0]);
+        FLAC__uint32 sum;
+        FLAC__int32 x;
+        for (g = 1; g < groups; g++) {
+            acc = _mm_add_epi32(acc, _mm_mullo_epi32(coeff[g], hist[g]));
+        }
+        acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+        acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+        sum = (FLAC__uint32)_mm_cvtsi128_si32(acc) + c2 * (FLAC__uint32)x3 + c1 * (FLAC__uint32)x2 + c0 * (FLAC__uint32)x1;
+        x = residual[i] + ((FLAC__int32)sum >> lp_quantization);
+        data[i] = x;
+        for (g = 0; g + 1 < groups; g++) {
+            hist[g] = _mm_alignr_epi8(hist[g + 1], hist[g], 4);
+        }
+        hist[groups - 1] = _mm_alignr_epi8(_mm_cvtsi32_si128(x3), hist[groups - 1], 4);
+        x3 = x2;
+        x2 = x1;
+        x1 = x;
+    }
+}
+
+
+/*
+    One function per group count, each holding only the vectors it uses, so
+    the loops unroll fully and no frame carries the 32nd order's worth of them.
+*/
+#define RESTORE_GROUPS_(kind, load, n) \
+FLAC__SSE_TARGET("sse4.1") \
+static __attribute__((noinline)) void restore_signal_##kind##g##n##_(const FLAC__int32 residual[], uint32_t data_len, const FLAC__int32 qlp_coeff[], uint32_t order, int lp_quantization, FLAC__int32 data[]) { \
+    __m128i hist[n], coeff[n]; \
+    load(data, order, n, hist, qlp_coeff, coeff); \
+    restore_signal_##kind##groups_(residual, data_len, qlp_coeff, coeff, hist, n, lp_quantization, data); \
+}
+
+RESTORE_GROUPS_(, load_history_, 1)
+RESTORE_GROUPS_(, load_history_, 2)
+RESTORE_GROUPS_(, load_history_, 3)
+RESTORE_GROUPS_(, load_history_, 4)
+RESTORE_GROUPS_(, load_history_, 5)
+RESTORE_GROUPS_(, load_history_, 6)
+RESTORE_GROUPS_(, load_history_, 7)
+RESTORE_GROUPS_(, load_history_, 8)
+
+void FLAC__lpc_restore_signal_intrin_sse41(const FLAC__int32 residual[], uint32_t data_len, const FLAC__int32 qlp_coeff[], uint32_t order, int lp_quantization, FLAC__int32 data[]) {
+    FLAC__ASSERT(order > 0);
+    FLAC__ASSERT(order <= 32);
+
+    if (order < MIN_ORDER) {
+        FLAC__lpc_restore_signal(residual, data_len, qlp_coeff, order, lp_quantization, data);
+        return;
+    }
+
+    switch ((order - SCALAR_TAPS + 3) / 4) {
+    case 1: restore_signal_g1_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 2: restore_signal_g2_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 3: restore_signal_g3_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 4: restore_signal_g4_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 5: restore_signal_g5_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 6: restore_signal_g6_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 7: restore_signal_g7_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    default: restore_signal_g8_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    }
+}
+
+/*
+    When both the samples and the coefficients fit in 16 bits, PMADDWD does 8
+    multiplies and 4 adds at once.  The pairwise sums wrap exactly like the
+    32-bit C code, so the result is still bit exact.
+*/
+FLAC__SSE_TARGET("sse4.1")
+static inline __attribute__((always_inline)) void restore_signal_16_groups_(const FLAC__int32 residual[], uint32_t data_len, const FLAC__int32 qlp_coeff[], const __m128i coeff[], __m128i hist[], const uint32_t groups, int lp_quantization, FLAC__int32 data[]) {
+    const FLAC__uint32 c0 = qlp_coeff[0], c1 = qlp_coeff[1], c2 = qlp_coeff[2];
+    FLAC__int32 x1 = data[-1], x2 = data[-2], x3 = data[-3];
+    uint32_t i, g;
+    for (i = 0; i < data_len; i++) {
+        __m128i acc = _mm_madd_epi16(coeff[0], hist[0]);
+        FLAC__uint32 sum;
+        FLAC__int32 x;
+        for (g = 1; g < groups; g++) {
+            acc = _mm_add_epi32(acc, _mm_madd_epi16(coeff[g], hist[g]));
+        }
+        acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+        acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+        sum = (FLAC__uint32)_mm_cvtsi128_si32(acc) + c2 * (FLAC__uint32)x3 + c1 * (FLAC__uint32)x2 + c0 * (FLAC__uint32)x1;
+        x = residual[i] + ((FLAC__int32)sum >> lp_quantization);
+        data[i] = x;
+        for (g = 0; g + 1 < groups; g++) {
+            hist[g] = _mm_alignr_epi8(hist[g + 1], hist[g], 2);
+        }
+        hist[groups - 1] = _mm_alignr_epi8(_mm_cvtsi32_si128(x3), hist[groups - 1], 2);
+        x3 = x2;
+        x2 = x1;
+        x1 = x;
+    }
+}
+
+RESTORE_GROUPS_(16_, load_history_16_, 1)
+RESTORE_GROUPS_(16_, load_history_16_, 2)
+RESTORE_GROUPS_(16_, load_history_16_, 3)
+RESTORE_GROUPS_(16_, load_history_16_, 4)
+
+void FLAC__lpc_restore_signal_16_intrin_sse41(const FLAC__int32 residual[], uint32_t data_len, const FLAC__int32 qlp_coeff[], uint32_t order, int lp_quantization, FLAC__int32 data[]) {
+    FLAC__ASSERT(order > 0);
+    FLAC__ASSERT(order <= 32);
+
+    if (order < MIN_ORDER_16) {
+        FLAC__lpc_restore_signal(residual, data_len, qlp_coeff, order, lp_quantization, data);
+        return;
+    }
+
+    switch ((order - SCALAR_TAPS + 7) / 8) {
+    case 1: restore_signal_16_g1_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 2: restore_signal_16_g2_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 3: restore_signal_16_g3_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    default: restore_signal_16_g4_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    }
+}
+
+/*
+    PMULDQ only multiplies the even 32-bit lanes into 64 bits, so the odd lanes
+    are shifted down and multiplied by the shifted coefficient vector.
+*/
+FLAC__SSE_TARGET("sse4.1")
+static inline __attribute__((always_inline)) void restore_signal_wide_groups_(const FLAC__int32 residual[], uint32_t data_len, const FLAC__int32 qlp_coeff[], const __m128i coeff[], __m128i hist[], const uint32_t groups, int lp_quantization, FLAC__int32 data[]) {
+    const FLAC__int64 c0 = qlp_coeff[0], c1 = qlp_coeff[1], c2 = qlp_coeff[2];
+    FLAC__int32 x1 = data[-1], x2 = data[-2], x3 = data[-3];
+    uint32_t i, g;
+    for (i = 0; i < data_len; i++) {
+        __m128i acc = _mm_add_epi64(_mm_mul_epi32(coeff[0], hist[0]), _mm_mul_epi32(_mm_srli_epi64(coeff[0], 32), _mm_srli_epi64(hist[0], 32)));
+        FLAC__int64 sum;
+        FLAC__int32 x;
+        for (g = 1; g < groups; g++) {
+            /*
+                Reloaded each time rather than taken from coeff[].  The store to
+                data[] may alias qlp_coeff[], so the compiler can't hoist these
+                and spill 2 coefficient vectors a group, as it does otherwise.
+            */
+            __m128i c = REVERSE_(_mm_loadu_si128((const __m128i *)(qlp_coeff + (groups - g) * 4 - 1)));
+            acc = _mm_add_epi64(acc, _mm_mul_epi32(c, hist[g]));
+            acc = _mm_add_epi64(acc, _mm_mul_epi32(_mm_srli_epi64(c, 32), _mm_srli_epi64(hist[g], 32)));
+        }
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi64(acc, acc));
+#if defined FLAC__CPU_X86_64
+        sum = _mm_cvtsi128_si64(acc);
+#else
+        _mm_storel_epi64((__m128i *)&sum, acc);
+#endif
+        sum += c2 * x3 + c1 * x2 + c0 * x1;
+        x = residual[i] + (FLAC__int32)(sum >> lp_quantization);
+        data[i] = x;
+        for (g = 0; g + 1 < groups; g++) {
+            hist[g] = _mm_alignr_epi8(hist[g + 1], hist[g], 4);
+        }
+        hist[groups - 1] = _mm_alignr_epi8(_mm_cvtsi32_si128(x3), hist[groups - 1], 4);
+        x3 = x2;
+        x2 = x1;
+        x1 = x;
+    }
+}
+
+RESTORE_GROUPS_(wide_, load_history_, 1)
+RESTORE_GROUPS_(wide_, load_history_, 2)
+RESTORE_GROUPS_(wide_, load_history_, 3)
+RESTORE_GROUPS_(wide_, load_history_, 4)
+RESTORE_GROUPS_(wide_, load_history_, 5)
+RESTORE_GROUPS_(wide_, load_history_, 6)
+RESTORE_GROUPS_(wide_, load_history_, 7)
+RESTORE_GROUPS_(wide_, load_history_, 8)
+
+void FLAC__lpc_restore_signal_wide_intrin_sse41(const FLAC__int32 residual[], uint32_t data_len, const FLAC__int32 qlp_coeff[], uint32_t order, int lp_quantization, FLAC__int32 data[]) {
+    FLAC__ASSERT(order > 0);
+    FLAC__ASSERT(order <= 32);
+
+    if (order < MIN_ORDER_WIDE) {
+        FLAC__lpc_restore_signal_wide(residual, data_len, qlp_coeff, order, lp_quantization, data);
+        return;
+    }
+
+    switch ((order - SCALAR_TAPS + 3) / 4) {
+    case 1: restore_signal_wide_g1_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 2: restore_signal_wide_g2_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 3: restore_signal_wide_g3_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 4: restore_signal_wide_g4_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 5: restore_signal_wide_g5_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 6: restore_signal_wide_g6_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    case 7: restore_signal_wide_g7_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    default: restore_signal_wide_g8_(residual, data_len, qlp_coeff, order, lp_quantization, data); break;
+    }
+}
+
+#endif /* FLAC__SSE4_1_SUPPORTED */
+#endif /* (FLAC__CPU_IA32 || FLAC__CPU_X86_64) && FLAC__HAS_X86INTRIN */
+#endif /* FLAC__NO_ASM */
+#endif /* FLAC__INTEGER_ONLY_LIBRARY */
@@ -174,7 +174,7 @@ static void byteSwapX16(FLAC__uint32 *buf) {
     Update context to reflect the concatenation of another buffer full
     of bytes.
 */
-static void FLAC__MD5Update(FLAC__MD5Context *ctx, FLAC__byte const *buf, uint32_t len) {
+void FLAC__MD5Update(FLAC__MD5Context *ctx, FLAC__byte const *buf, uint32_t len) {
     FLAC__uint32 t;
 
     /* Update byte count */
@@ -488,24 +488,26 @@ static void format_input_(FLAC__multibyte *mbuf, const FLAC__int32 * const signa
 }
 
 /*
-    Convert the incoming audio signal to a byte stream and FLAC__MD5Update it.
+    Convert the incoming audio signal to a byte stream in ctx->internal_buf
+    without hashing it, so the caller can FLAC__MD5Update it in pieces later.
+    Returns the number of bytes, or 0 on error.
 */
-FLAC__bool FLAC__MD5Accumulate(FLAC__MD5Context *ctx, const FLAC__int32 * const signal[], uint32_t channels, uint32_t samples, uint32_t bytes_per_sample) {
+size_t FLAC__MD5Format(FLAC__MD5Context *ctx, const FLAC__int32 * const signal[], uint32_t channels, uint32_t samples, uint32_t bytes_per_sample) {
     const size_t bytes_needed = (size_t)channels * (size_t)samples * (size_t)bytes_per_sample;
 
     /* overflow check */
     if ((size_t)channels > SIZE_MAX / (size_t)bytes_per_sample) {
-        return false;
+        return 0;
     }
     if ((size_t)channels * (size_t)bytes_per_sample > SIZE_MAX / (size_t)samples) {
-        return false;
+        return 0;
     }
 
     if (ctx->capacity < bytes_needed) {
         if (0 == (ctx->internal_buf.p8 = safe_realloc_(ctx->internal_buf.p8, bytes_needed))) {
             if (0 == (ctx->internal_buf.p8 = safe_malloc_(bytes_needed))) {
                 ctx->capacity = 0;
-                return false;
+                return 0;
             }
         }
         ctx->capacity = bytes_needed;
@@ -513,6 +515,19 @@ FLAC__bool FLAC__MD5Accumulate(FLAC__MD5Context *ctx, const FLAC__int32 * const
 
     format_input_(&ctx->internal_buf, signal, channels, samples, bytes_per_sample);
 
+    return bytes_needed;
+}
+
+/*
+    Convert the incoming audio signal to a byte stream and FLAC__MD5Update it.
+*/
+FLAC__bool FLAC__MD5Accumulate(FLAC__MD5Context *ctx, const FLAC__int32 * const signal[], uint32_t channels, uint32_t samples, uint32_t bytes_per_sample) {
+    const size_t bytes_needed = FLAC__MD5Format(ctx, signal, channels, samples, bytes_per_sample);
+
+    if (0 == bytes_needed) {
+        return false;
+    }
+
     FLAC__MD5Update(ctx, ctx->internal_buf.p8, bytes_needed);
 
     return true;
@@ -84,6 +84,7 @@ static FLAC__bool find_metadata_(FLAC__StreamDecoder *decoder);
 static FLAC__bool read_metadata_(FLAC__StreamDecoder *decoder);
 static FLAC__bool read_metadata_streaminfo_(FLAC__StreamDecoder *decoder, FLAC__bool is_last, uint32_t length);
 static FLAC__bool read_metadata_seektable_(FLAC__StreamDecoder *decoder, FLAC__bool is_last, uint32_t length);
+static FLAC__bool skip_metadata_block_(FLAC__StreamDecoder *decoder, uint32_t length);
 static FLAC__bool read_metadata_vorbiscomment_(FLAC__StreamDecoder *decoder, FLAC__StreamMetadata_VorbisComment *obj, uint32_t length);
 static FLAC__bool read_metadata_cuesheet_(FLAC__StreamDecoder *decoder, FLAC__StreamMetadata_CueSheet *obj);
 static FLAC__bool read_metadata_picture_(FLAC__StreamDecoder *decoder, FLAC__StreamMetadata_Picture *obj);
@@ -149,6 +150,7 @@ typedef struct FLAC__StreamDecoderPrivate {
     FLAC__bool has_stream_info, has_seek_table;
     FLAC__StreamMetadata stream_info;
     FLAC__StreamMetadata seek_table;
+    FLAC__StreamMetadata metadata_block; /* other metadata being read, kept out of read_metadata_()'s stack frame */
     FLAC__bool metadata_filter[128]; /* MAGIC number 128 == total number of metadata block types == 1 << 7 */
     FLAC__byte *metadata_filter_ids;
     size_t metadata_filter_ids_count, metadata_filter_ids_capacity; /* units for both are IDs, not bytes */
@@ -411,10 +413,32 @@ static FLAC__StreamDecoderInitStatus init_stream_internal_(
             decoder->private_->local_lpc_restore_signal_64bit = FLAC__lpc_restore_signal_wide_intrin_sse41;
         }
 # endif
+# if defined FLAC__AVX2_SUPPORTED && !defined FLAC__HAS_NASM
+        if (decoder->private_->cpuinfo.x86.avx2) {
+            decoder->private_->local_lpc_restore_signal = FLAC__lpc_restore_signal_intrin_avx2;
+            decoder->private_->local_lpc_restore_signal_16bit = FLAC__lpc_restore_signal_16_intrin_avx2;
+            decoder->private_->local_lpc_restore_signal_64bit = FLAC__lpc_restore_signal_wide_intrin_avx2;
+        }
+# endif
 #endif
 #elif defined FLAC__CPU_X86_64
         FLAC__ASSERT(decoder->private_->cpuinfo.type == FLAC__CPUINFO_TYPE_X86_64);
-        /* No useful SSE optimizations yet */
+#if FLAC__HAS_X86INTRIN && ! defined FLAC__INTEGER_ONLY_LIBRARY
+# if defined FLAC__SSE4_1_SUPPORTED
+        if (decoder->private_->cpuinfo.x86.sse41) {
+            decoder->private_->local_lpc_restore_signal = FLAC__lpc_restore_signal_intrin_sse41;
+            decoder->private_->local_lpc_restore_signal_16bit = FLAC__lpc_restore_signal_16_intrin_sse41;
+            decoder->private_->local_lpc_restore_signal_64bit = FLAC__lpc_restore_signal_wide_intrin_sse41;
+        }
+# endif
+# if defined FLAC__AVX2_SUPPORTED
+        if (decoder->private_->cpuinfo.x86.avx2) {
+            decoder->private_->local_lpc_restore_signal = FLAC__lpc_restore_signal_intrin_avx2;
+            decoder->private_->local_lpc_restore_signal_16bit = FLAC__lpc_restore_signal_16_intrin_avx2;
+            decoder->private_->local_lpc_restore_signal_64bit = FLAC__lpc_restore_signal_wide_intrin_avx2;
+        }
+# endif
+#endif
 #endif
     }
 #endif
@@ -1459,15 +1483,15 @@ FLAC__bool read_metadata_(FLAC__StreamDecoder *decoder) {
     } else {
         FLAC__bool skip_it = !decoder->private_->metadata_filter[type];
         uint32_t real_length = length;
-        FLAC__StreamMetadata block;
+        FLAC__StreamMetadata *block = &decoder->private_->metadata_block;
 
-        memset(&block, 0, sizeof(block));
-        block.is_last = is_last;
-        block.type = (FLAC__MetadataType)type;
-        block.length = length;
+        memset(block, 0, sizeof(*block));
+        block->is_last = is_last;
+        block->type = (FLAC__MetadataType)type;
+        block->length = length;
 
         if (type == FLAC__METADATA_TYPE_APPLICATION) {
-            if (!FLAC__bitreader_read_byte_block_aligned_no_crc(decoder->private_->input, block.data.application.id, FLAC__STREAM_METADATA_APPLICATION_ID_LEN / 8)) {
+            if (!FLAC__bitreader_read_byte_block_aligned_no_crc(decoder->private_->input, block->data.application.id, FLAC__STREAM_METADATA_APPLICATION_ID_LEN / 8)) {
                 return false;    /* read_callback_ sets the state for us */
             }
 
@@ -1478,13 +1502,13 @@ FLAC__bool read_metadata_(FLAC__StreamDecoder *decoder) {
 
             real_length -= FLAC__STREAM_METADATA_APPLICATION_ID_LEN / 8;
 
-            if (decoder->private_->metadata_filter_ids_count > 0 && has_id_filtered_(decoder, block.data.application.id)) {
+            if (decoder->private_->metadata_filter_ids_count > 0 && has_id_filtered_(decoder, block->data.application.id)) {
                 skip_it = !skip_it;
             }
         }
 
         if (skip_it) {
-            if (!FLAC__bitreader_skip_byte_block_aligned_no_crc(decoder->private_->input, real_length)) {
+            if (!skip_metadata_block_(decoder, real_length)) {
                 return false;    /* read_callback_ sets the state for us */
             }
         } else {
@@ -1499,28 +1523,28 @@ FLAC__bool read_metadata_(FLAC__StreamDecoder *decoder) {
             case FLAC__METADATA_TYPE_APPLICATION:
                 /* remember, we read the ID already */
                 if (real_length > 0) {
-                    if (0 == (block.data.application.data = malloc(real_length))) {
+                    if (0 == (block->data.application.data = malloc(real_length))) {
                         decoder->protected_->state = FLAC__STREAM_DECODER_MEMORY_ALLOCATION_ERROR;
                         ok = false;
-                    } else if (!FLAC__bitreader_read_byte_block_aligned_no_crc(decoder->private_->input, block.data.application.data, real_length)) {
+                    } else if (!FLAC__bitreader_read_byte_block_aligned_no_crc(decoder->private_->input, block->data.application.data, real_length)) {
                         ok = false;    /* read_callback_ sets the state for us */
                     }
                 } else {
-                    block.data.application.data = 0;
+                    block->data.application.data = 0;
                 }
                 break;
             case FLAC__METADATA_TYPE_VORBIS_COMMENT:
-                if (!read_metadata_vorbiscomment_(decoder, &block.data.vorbis_comment, real_length)) {
+                if (!read_metadata_vorbiscomment_(decoder, &block->data.vorbis_comment, real_length)) {
                     ok = false;
                 }
                 break;
             case FLAC__METADATA_TYPE_CUESHEET:
-                if (!read_metadata_cuesheet_(decoder, &block.data.cue_sheet)) {
+                if (!read_metadata_cuesheet_(decoder, &block->data.cue_sheet)) {
                     ok = false;
                 }
                 break;
             case FLAC__METADATA_TYPE_PICTURE:
-                if (!read_metadata_picture_(decoder, &block.data.picture)) {
+                if (!read_metadata_picture_(decoder, &block->data.picture)) {
                     ok = false;
                 }
                 break;
@@ -1530,19 +1554,19 @@ FLAC__bool read_metadata_(FLAC__StreamDecoder *decoder) {
                 break;
             default:
                 if (real_length > 0) {
-                    if (0 == (block.data.unknown.data = malloc(real_length))) {
+                    if (0 == (block->data.unknown.data = malloc(real_length))) {
                         decoder->protected_->state = FLAC__STREAM_DECODER_MEMORY_ALLOCATION_ERROR;
                         ok = false;
-                    } else if (!FLAC__bitreader_read_byte_block_aligned_no_crc(decoder->private_->input, block.data.unknown.data, real_length)) {
+                    } else if (!FLAC__bitreader_read_byte_block_aligned_no_crc(decoder->private_->input, block->data.unknown.data, real_length)) {
                         ok = false;    /* read_callback_ sets the state for us */
                     }
                 } else {
-                    block.data.unknown.data = 0;
+                    block->data.unknown.data = 0;
                 }
                 break;
             }
             if (ok && !decoder->private_->is_seeking && decoder->private_->metadata_callback) {
-                decoder->private_->metadata_callback(decoder, &block, decoder->private_->client_data);
+                decoder->private_->metadata_callback(decoder, block, decoder->private_->client_data);
             }
 
             /* now we have to free any malloc()ed data in the block */
@@ -1550,50 +1574,50 @@ FLAC__bool read_metadata_(FLAC__StreamDecoder *decoder) {
             case FLAC__METADATA_TYPE_PADDING:
                 break;
             case FLAC__METADATA_TYPE_APPLICATION:
-                if (0 != block.data.application.data) {
-                    free(block.data.application.data);
+                if (0 != block->data.application.data) {
+                    free(block->data.application.data);
                 }
                 break;
             case FLAC__METADATA_TYPE_VORBIS_COMMENT:
-                if (0 != block.data.vorbis_comment.vendor_string.entry) {
-                    free(block.data.vorbis_comment.vendor_string.entry);
+                if (0 != block->data.vorbis_comment.vendor_string.entry) {
+                    free(block->data.vorbis_comment.vendor_string.entry);
                 }
-                if (block.data.vorbis_comment.num_comments > 0)
-                    for (i = 0; i < block.data.vorbis_comment.num_comments; i++)
-                        if (0 != block.data.vorbis_comment.comments[i].entry) {
-                            free(block.data.vorbis_comment.comments[i].entry);
+                if (block->data.vorbis_comment.num_comments > 0)
+                    for (i = 0; i < block->data.vorbis_comment.num_comments; i++)
+                        if (0 != block->data.vorbis_comment.comments[i].entry) {
+                            free(block->data.vorbis_comment.comments[i].entry);
                         }
-                if (0 != block.data.vorbis_comment.comments) {
-                    free(block.data.vorbis_comment.comments);
+                if (0 != block->data.vorbis_comment.comments) {
+                    free(block->data.vorbis_comment.comments);
                 }
                 break;
             case FLAC__METADATA_TYPE_CUESHEET:
-                if (block.data.cue_sheet.num_tracks > 0)
-                    for (i = 0; i < block.data.cue_sheet.num_tracks; i++)
-                        if (0 != block.data.cue_sheet.tracks[i].indices) {
-                            free(block.data.cue_sheet.tracks[i].indices);
+                if (block->data.cue_sheet.num_tracks > 0)
+                    for (i = 0; i < block->data.cue_sheet.num_tracks; i++)
+                        if (0 != block->data.cue_sheet.tracks[i].indices) {
+                            free(block->data.cue_sheet.tracks[i].indices);
                         }
-                if (0 != block.data.cue_sheet.tracks) {
-                    free(block.data.cue_sheet.tracks);
+                if (0 != block->data.cue_sheet.tracks) {
+                    free(block->data.cue_sheet.tracks);
                 }
                 break;
             case FLAC__METADATA_TYPE_PICTURE:
-                if (0 != block.data.picture.mime_type) {
-                    free(block.data.picture.mime_type);
+                if (0 != block->data.picture.mime_type) {
+                    free(block->data.picture.mime_type);
                 }
-                if (0 != block.data.picture.description) {
-                    free(block.data.picture.description);
+                if (0 != block->data.picture.description) {
+                    free(block->data.picture.description);
                 }
-                if (0 != block.data.picture.data) {
-                    free(block.data.picture.data);
+                if (0 != block->data.picture.data) {
+                    free(block->data.picture.data);
                 }
                 break;
             case FLAC__METADATA_TYPE_STREAMINFO:
             case FLAC__METADATA_TYPE_SEEKTABLE:
                 FLAC__ASSERT(0);
             default:
-                if (0 != block.data.unknown.data) {
-                    free(block.data.unknown.data);
+                if (0 != block->data.unknown.data) {
+                    free(block->data.unknown.data);
                 }
                 break;
             }
@@ -1699,7 +1723,7 @@ FLAC__bool read_metadata_streaminfo_(FLAC__StreamDecoder *decoder, FLAC__bool is
 }
 
 FLAC__bool read_metadata_seektable_(FLAC__StreamDecoder *decoder, FLAC__bool is_last, uint32_t length) {
-    FLAC__uint32 i, x;
+    FLAC__uint32 i, n, x;
     FLAC__uint64 xx;
 
     FLAC__ASSERT(FLAC__bitreader_is_consumed_byte_aligned(decoder->private_->input));
@@ -1715,23 +1739,37 @@ FLAC__bool read_metadata_seektable_(FLAC__StreamDecoder *decoder, FLAC__bool is_
         decoder->protected_->state = FLAC__STREAM_DECODER_MEMORY_ALLOCATION_ERROR;
         return false;
     }
-    for (i = 0; i < decoder->private_->seek_table.data.seek_table.num_points; i++) {
+    /* placeholder points are dropped as they're read, seeking never uses them */
+    for (i = 0, n = 0; i < decoder->private_->seek_table.data.seek_table.num_points; i++) {
         if (!FLAC__bitreader_read_raw_uint64(decoder->private_->input, &xx, FLAC__STREAM_METADATA_SEEKPOINT_SAMPLE_NUMBER_LEN)) {
             return false;    /* read_callback_ sets the state for us */
         }
-        decoder->private_->seek_table.data.seek_table.points[i].sample_number = xx;
+        decoder->private_->seek_table.data.seek_table.points[n].sample_number = xx;
 
         if (!FLAC__bitreader_read_raw_uint64(decoder->private_->input, &xx, FLAC__STREAM_METADATA_SEEKPOINT_STREAM_OFFSET_LEN)) {
             return false;    /* read_callback_ sets the state for us */
         }
-        decoder->private_->seek_table.data.seek_table.points[i].stream_offset = xx;
+        decoder->private_->seek_table.data.seek_table.points[n].stream_offset = xx;
 
         if (!FLAC__bitreader_read_raw_uint32(decoder->private_->input, &x, FLAC__STREAM_METADATA_SEEKPOINT_FRAME_SAMPLES_LEN)) {
             return false;    /* read_callback_ sets the state for us */
         }
-        decoder->private_->seek_table.data.seek_table.points[i].frame_samples = x;
+        decoder->private_->seek_table.data.seek_table.points[n].frame_samples = x;
+
+        if (decoder->private_->seek_table.data.seek_table.points[n].sample_number != FLAC__STREAM_METADATA_SEEKPOINT_PLACEHOLDER) {
+            n++;
+        }
     }
     length -= (decoder->private_->seek_table.data.seek_table.num_points * FLAC__STREAM_METADATA_SEEKPOINT_LENGTH);
+    if (n < decoder->private_->seek_table.data.seek_table.num_points) {
+        decoder->private_->seek_table.data.seek_table.num_points = n;
+        if (n > 0) {
+            void *points = realloc(decoder->private_->seek_table.data.seek_table.points, n * sizeof(FLAC__StreamMetadata_SeekPoint));
+            if (points) {
+                decoder->private_->seek_table.data.seek_table.points = points;
+            }
+        }
+    }
     /* if there is a partial point left, skip over it */
     if (length > 0) {
         /*@@@ do a send_error_to_client_() here?  there's an argument for either way */
@@ -1743,6 +1781,29 @@ FLAC__bool read_metadata_seektable_(FLAC__StreamDecoder *decoder, FLAC__bool is_
     return true;
 }
 
+/*
+    Skip an unwanted metadata block (e.g. a multi-MB PICTURE).  Whatever is
+    already buffered is consumed normally, and the rest is skipped with the
+    seek callback instead of reading it all in.  Falls back to reading when
+    the stream can't seek.
+*/
+FLAC__bool skip_metadata_block_(FLAC__StreamDecoder *decoder, uint32_t length) {
+    FLAC__uint64 pos;
+    uint32_t buffered = FLAC__bitreader_get_input_bits_unconsumed(decoder->private_->input) / 8;
+
+    FLAC__ASSERT(FLAC__bitreader_is_consumed_byte_aligned(decoder->private_->input));
+
+    if (length <= buffered || decoder->private_->is_ogg || 0 == decoder->private_->seek_callback || 0 == decoder->private_->tell_callback) {
+        return FLAC__bitreader_skip_byte_block_aligned_no_crc(decoder->private_->input, length);
+    }
+    if (decoder->private_->tell_callback(decoder, &pos, decoder->private_->client_data) != FLAC__STREAM_DECODER_TELL_STATUS_OK ||
+            decoder->private_->seek_callback(decoder, pos + length - buffered, decoder->private_->client_data) != FLAC__STREAM_DECODER_SEEK_STATUS_OK) {
+        return FLAC__bitreader_skip_byte_block_aligned_no_crc(decoder->private_->input, length);
+    }
+    /* everything buffered belonged to this block, so start the reader over from the new position */
+    return FLAC__bitreader_clear(decoder->private_->input);
+}
+
 FLAC__bool read_metadata_vorbiscomment_(FLAC__StreamDecoder *decoder, FLAC__StreamMetadata_VorbisComment *obj, uint32_t length) {
     FLAC__uint32 i;
 
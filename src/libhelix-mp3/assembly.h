@@ -302,7 +302,7 @@ static __inline Word64 xSAR64(Word64 x, int n) {
 }
 //mw
 
-#elif defined(ARDUINO)
+#elif defined(ARDUINO) || (defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__)))
 
 static __inline int FASTABS(int x) {
     int sign;
@@ -0,0 +1,190 @@
+/* Copyright (c) 2011 Xiph.Org Foundation
+   Written by Jean-Marc Valin */
+/*
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions
+   are met:
+
+   - Redistributions of source code must retain the above copyright
+   notice, this list of conditions and the following disclaimer.
+
+   - Redistributions in binary form must reproduce the above copyright
+   notice, this list of conditions and the following disclaimer in the
+   documentation and/or other materials provided with the distribution.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER
+   OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+   LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+   NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+   SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* ESP8266Audio: not part of upstream Opus.  opus_multistream_decode_native() from
+   opus_multistream_decoder.c, with the per-stream buffer given by the caller instead of
+   ALLOC()ed on the stack.  Kept in its own file so install-opus.sh can copy the upstream
+   sources over unchanged. */
+
+#ifdef __STDC__
+#include "config.h"
+#endif
+
+#include "opus_multistream_scratch.h"
+#include "opus.h"
+#include "opus_private.h"
+#include "os_support.h"
+
+#ifndef FIXED_POINT
+#error "opus_multistream_decode_scratch() only handles fixed point output"
+#endif
+
+/* Static in opus_multistream_decoder.c */
+static int packet_validate(const unsigned char *data,
+      opus_int32 len, int nb_streams, opus_int32 Fs)
+{
+   int s;
+   int count;
+   unsigned char toc;
+   opus_int16 size[48];
+   int samples=0;
+   opus_int32 packet_offset;
+
+   for (s=0;s<nb_streams;s++)
+   {
+      int tmp_samples;
+      if (len<=0)
+         return OPUS_INVALID_PACKET;
+      count = opus_packet_parse_impl(data, len, s!=nb_streams-1, &toc, NULL,
+                                     size, NULL, &packet_offset, NULL, NULL);
+      if (count<0)
+         return count;
+      tmp_samples = opus_packet_get_nb_samples(data, packet_offset, Fs);
+      if (s!=0 && samples != tmp_samples)
+         return OPUS_INVALID_PACKET;
+      samples = tmp_samples;
+      data += packet_offset;
+      len -= packet_offset;
+   }
+   return samples;
+}
+
+static void copy_channel_out(opus_int16 *dst, int dst_stride, int dst_channel,
+      const opus_val16 *src, int src_stride, int frame_size)
+{
+   opus_int32 i;
+   if (src != NULL)
+   {
+      for (i=0;i<frame_size;i++)
+         dst[i*dst_stride+dst_channel] = src[i*src_stride];
+   }
+   else
+   {
+      for (i=0;i<frame_size;i++)
+         dst[i*dst_stride+dst_channel] = 0;
+   }
+}
+
+int opus_multistream_decode_scratch(
+      OpusMSDecoder *st,
+      const unsigned char *data,
+      opus_int32 len,
+      opus_int16 *pcm,
+      int frame_size,
+      int decode_fec,
+      opus_int16 *scratch
+)
+{
+   opus_int32 Fs;
+   int coupled_size;
+   int mono_size;
+   int s, c;
+   char *ptr;
+   int do_plc=0;
+   opus_val16 *buf = (opus_val16*)scratch;
+
+   if (frame_size <= 0)
+      return OPUS_BAD_ARG;
+   /* Not MUST_SUCCEED(), nothing is ALLOC()ed here for it to release */
+   if (opus_multistream_decoder_ctl(st, OPUS_GET_SAMPLE_RATE(&Fs)) != OPUS_OK)
+      return OPUS_INTERNAL_ERROR;
+   frame_size = IMIN(frame_size, Fs/25*3);
+   ptr = (char*)st + align(sizeof(OpusMSDecoder));
+   coupled_size = opus_decoder_get_size(2);
+   mono_size = opus_decoder_get_size(1);
+
+   if (len==0)
+      do_plc = 1;
+   if (len < 0)
+      return OPUS_BAD_ARG;
+   if (!do_plc && len < 2*st->layout.nb_streams-1)
+      return OPUS_INVALID_PACKET;
+   if (!do_plc)
+   {
+      int ret = packet_validate(data, len, st->layout.nb_streams, Fs);
+      if (ret < 0)
+         return ret;
+      else if (ret > frame_size)
+         return OPUS_BUFFER_TOO_SMALL;
+   }
+   for (s=0;s<st->layout.nb_streams;s++)
+   {
+      OpusDecoder *dec;
+      opus_int32 packet_offset;
+      int ret;
+
+      dec = (OpusDecoder*)ptr;
+      ptr += (s < st->layout.nb_coupled_streams) ? align(coupled_size) : align(mono_size);
+
+      if (!do_plc && len<=0)
+         return OPUS_INTERNAL_ERROR;
+      packet_offset = 0;
+      ret = opus_decode_native(dec, data, len, buf, frame_size, decode_fec, s!=st->layout.nb_streams-1, &packet_offset, 0, NULL, 0);
+      if (!do_plc)
+      {
+         data += packet_offset;
+         len -= packet_offset;
+      }
+      if (ret <= 0)
+         return ret;
+      frame_size = ret;
+      if (s < st->layout.nb_coupled_streams)
+      {
+         int chan, prev;
+         prev = -1;
+         /* Copy "left" audio to the channel(s) where it belongs */
+         while ( (chan = get_left_channel(&st->layout, s, prev)) != -1)
+         {
+            copy_channel_out(pcm, st->layout.nb_channels, chan, buf, 2, frame_size);
+            prev = chan;
+         }
+         prev = -1;
+         /* Copy "right" audio to the channel(s) where it belongs */
+         while ( (chan = get_right_channel(&st->layout, s, prev)) != -1)
+         {
+            copy_channel_out(pcm, st->layout.nb_channels, chan, buf+1, 2, frame_size);
+            prev = chan;
+         }
+      } else {
+         int chan, prev;
+         prev = -1;
+         /* Copy audio to the channel(s) where it belongs */
+         while ( (chan = get_mono_channel(&st->layout, s, prev)) != -1)
+         {
+            copy_channel_out(pcm, st->layout.nb_channels, chan, buf, 1, frame_size);
+            prev = chan;
+         }
+      }
+   }
+   /* Handle muted channels */
+   for (c=0;c<st->layout.nb_channels;c++)
+   {
+      if (st->layout.mapping[c] == 255)
+         copy_channel_out(pcm, st->layout.nb_channels, c, NULL, 0, frame_size);
+   }
+   return frame_size;
+}
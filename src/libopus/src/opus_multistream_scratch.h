@@ -0,0 +1 @@
+#include "../include/opus_multistream_scratch.h"
@@ -10519,780 +10519,2199 @@ static const struct tsf_region preset_128_regions[] PROGMEM = {
 }
 ,
 };
+static const tsf_u32 preset_0_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x02010100, 0x02010201, 0x02010201, 0x02010201, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x04030302, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x05040403, 0x05040504,
+ 0x05040504, 0x06050605, 0x06050605, 0x06050605, 0x07060605, 0x07060706, 0x08070807, 0x08070807,
+ 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807,
+ 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807,
+};
+static const tsf_u32 preset_1_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x02010100, 0x02010201, 0x02010201, 0x02010201, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x04030302, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x05040403, 0x05040504,
+ 0x05040504, 0x06050605, 0x06050605, 0x06050605, 0x07060605, 0x07060706, 0x08070807, 0x08070807,
+ 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807,
+ 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807,
+};
+static const tsf_u32 preset_2_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010100, 0x02010201, 0x02010201, 0x02010201,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x04030302, 0x04030403, 0x04030403, 0x04030403,
+ 0x04030403, 0x05040403, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x06050504,
+ 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x06050605,
+ 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x06050605,
+};
+static const tsf_u32 preset_3_keyspans[64] PROGMEM = {
+ 0x09000900, 0x09000900, 0x09000900, 0x09000900, 0x09000900, 0x09000900, 0x09000900, 0x09000900,
+ 0x09000900, 0x09000900, 0x09000900, 0x09000900, 0x09000900, 0x09000900, 0x09000900, 0x09000900,
+ 0x09000900, 0x09000900, 0x09000900, 0x09000900, 0x09000900, 0x09000900, 0x09000900, 0x09000900,
+ 0x09000900, 0x0a010900, 0x0a010a01, 0x0a010a01, 0x0a010a01, 0x0b020b02, 0x0b020b02, 0x0b020b02,
+ 0x0b020b02, 0x0b030b02, 0x0c030b03, 0x0c030c03, 0x0c030c03, 0x0c030c03, 0x0d040c03, 0x0d040d04,
+ 0x0d040d04, 0x0e050e05, 0x0e050e05, 0x0e050e05, 0x0f060e05, 0x0f060f06, 0x10071007, 0x10071007,
+ 0x10071007, 0x10071007, 0x10071007, 0x10071007, 0x10071007, 0x10071007, 0x10071007, 0x10071007,
+ 0x10071007, 0x10071007, 0x10071007, 0x10071007, 0x10071007, 0x10071007, 0x10071007, 0x10071007,
+};
+static const tsf_u32 preset_4_keyspans[64] PROGMEM = {
+ 0x06000600, 0x06000600, 0x06000600, 0x06000600, 0x06000600, 0x06000600, 0x06000600, 0x06000600,
+ 0x06000600, 0x06000600, 0x06000600, 0x06000600, 0x06000600, 0x06000600, 0x06000600, 0x06000600,
+ 0x06000600, 0x06000600, 0x06000600, 0x06000600, 0x06000600, 0x06000600, 0x06000600, 0x06000600,
+ 0x06010600, 0x06010601, 0x06010601, 0x06010601, 0x06010601, 0x06010601, 0x07020601, 0x07020702,
+ 0x07020702, 0x07020702, 0x07020702, 0x07020702, 0x07020702, 0x07020702, 0x07020702, 0x07020702,
+ 0x07030702, 0x07030703, 0x07030703, 0x07030703, 0x07030703, 0x07030703, 0x07030703, 0x07030703,
+ 0x07030703, 0x08030703, 0x08030803, 0x08030803, 0x08040804, 0x08040804, 0x08040804, 0x08040804,
+ 0x08040804, 0x08040804, 0x08040804, 0x08040804, 0x08040804, 0x08040804, 0x08040804, 0x08040804,
+};
+static const tsf_u32 preset_5_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_6_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x04000300, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04010400, 0x04010401, 0x05010501, 0x05010501,
+ 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501,
+};
+static const tsf_u32 preset_7_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_8_keyspans[64] PROGMEM = {
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200,
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200,
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200,
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200,
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200,
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02010200,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x03020201, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_9_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03010301, 0x03010301,
+ 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x04030403,
+ 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403,
+};
+static const tsf_u32 preset_10_keyspans[64] PROGMEM = {
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x05010400, 0x05010501,
+ 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501,
+ 0x05010501, 0x05010501, 0x05010501, 0x06010501, 0x06010601, 0x06010601, 0x06010601, 0x06010601,
+ 0x06010601, 0x06020601, 0x06020602, 0x06020602, 0x06020602, 0x06020602, 0x06020602, 0x06020602,
+ 0x06020602, 0x06020602, 0x06020602, 0x06020602, 0x06020602, 0x06020602, 0x06020602, 0x06020602,
+};
+static const tsf_u32 preset_11_keyspans[64] PROGMEM = {
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200,
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200,
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200,
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200,
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200,
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x03020200,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_12_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_13_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02000100, 0x02000200, 0x02000200, 0x02000200,
+};
+static const tsf_u32 preset_14_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+};
+static const tsf_u32 preset_15_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x02010100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_16_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03010300, 0x03010301, 0x03010301, 0x03010301, 0x03010301,
+ 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x04010301,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_17_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_18_keyspans[64] PROGMEM = {
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x05010401, 0x05010501, 0x05010501, 0x05010501, 0x05020502, 0x05020502, 0x05020502,
+};
+static const tsf_u32 preset_19_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x04000300, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x05000500, 0x05000500, 0x05000500, 0x05000500,
+ 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05010500,
+ 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501,
+};
+static const tsf_u32 preset_20_keyspans[64] PROGMEM = {
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04010400, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04020401, 0x04020402, 0x04020402, 0x04020402, 0x04020402, 0x04020402, 0x05020402,
+ 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502,
+};
+static const tsf_u32 preset_21_keyspans[64] PROGMEM = {
+ 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500,
+ 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500,
+ 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500,
+ 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05010501, 0x05010501, 0x05010501, 0x05010501,
+ 0x05010501, 0x05020501, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502,
+ 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502,
+ 0x05020502, 0x06020502, 0x06020602, 0x06020602, 0x06020602, 0x06020602, 0x06020602, 0x06020602,
+ 0x06030603, 0x06030603, 0x06030603, 0x06030603, 0x06030603, 0x06030603, 0x06030603, 0x06030603,
+};
+static const tsf_u32 preset_22_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_23_keyspans[64] PROGMEM = {
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x05010401, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501,
+ 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502,
+};
+static const tsf_u32 preset_24_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010100, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403,
+ 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403,
+};
+static const tsf_u32 preset_25_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010100, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_26_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03010300, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_27_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_28_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x02010100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_29_keyspans[64] PROGMEM = {
+ 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500,
+ 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500,
+ 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500,
+ 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05010500,
+ 0x05010501, 0x05020501, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502,
+ 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502,
+ 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05030503, 0x05030503, 0x06030603,
+ 0x06030603, 0x06030603, 0x06030603, 0x06030603, 0x06030603, 0x06030603, 0x06030603, 0x06030603,
+};
+static const tsf_u32 preset_30_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010100,
+ 0x02010201, 0x03020201, 0x03020302, 0x03020302, 0x04030302, 0x04030403, 0x04030403, 0x04030403,
+ 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403,
+ 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403,
+ 0x04030403, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504,
+};
+static const tsf_u32 preset_31_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x02010100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_32_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x03020201,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_33_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x02010100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x03020201,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_34_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x03020201,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_35_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x03020201,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_36_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010100, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x03020201,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_37_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010100, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x03020201,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_38_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x05010401, 0x05010501, 0x05010501, 0x05010501, 0x05020502,
+ 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502,
+};
+static const tsf_u32 preset_39_keyspans[64] PROGMEM = {
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x05010501, 0x05010501, 0x05010501,
+ 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x06020501,
+ 0x06020602, 0x06020602, 0x06020602, 0x06020602, 0x06020602, 0x06020602, 0x06020602, 0x06020602,
+};
+static const tsf_u32 preset_40_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x02010100, 0x02010201, 0x03020201, 0x03020302, 0x04030302,
+ 0x04030403, 0x05040403, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504,
+ 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504,
+ 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x06050605, 0x06050605,
+};
+static const tsf_u32 preset_41_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x02010201, 0x02010201, 0x03020302, 0x03020302, 0x04030403, 0x04030403, 0x05040504,
+ 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504,
+ 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504,
+ 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x06050605, 0x06050605,
+};
+static const tsf_u32 preset_42_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_43_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_44_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x03020201, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403,
+};
+static const tsf_u32 preset_45_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_46_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010100,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_47_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x03020201, 0x03020302, 0x04030403, 0x04030403, 0x05040504, 0x05040504, 0x06050605, 0x06050605,
+ 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x07060706, 0x07060706, 0x07060706, 0x07060706,
+ 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706,
+ 0x07060706, 0x07060706, 0x07060706, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807,
+ 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807,
+};
+static const tsf_u32 preset_48_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x03020201, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403,
+};
+static const tsf_u32 preset_49_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x03020201, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403,
+};
+static const tsf_u32 preset_50_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_51_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x04010301, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_52_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_53_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03010300, 0x03010301,
+ 0x03010301, 0x03010301, 0x03010301, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_54_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_55_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_56_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x02010100, 0x02010201, 0x02010201, 0x03020302, 0x03020302, 0x04030302, 0x04030403, 0x04030403,
+ 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504,
+ 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504,
+ 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x06050605,
+};
+static const tsf_u32 preset_57_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x02010100, 0x02010201, 0x02010201, 0x02010201, 0x03020302, 0x03020302,
+ 0x04030302, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403,
+ 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403,
+ 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403,
+ 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504,
+};
+static const tsf_u32 preset_58_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x02010100, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_59_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x03020201, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_60_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_61_keyspans[64] PROGMEM = {
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x05010501, 0x05010501, 0x05010501, 0x05010501,
+ 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501,
+ 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501,
+ 0x05010501, 0x05010501, 0x06020501, 0x06020602, 0x06020602, 0x06020602, 0x06020602, 0x06020602,
+};
+static const tsf_u32 preset_62_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_63_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010100, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_64_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010100, 0x03020201, 0x03020302, 0x03020302,
+ 0x03020302, 0x04030403, 0x04030403, 0x04030403, 0x05040403, 0x05040504, 0x06050504, 0x06050605,
+ 0x06050605, 0x06050605, 0x06050605, 0x07060605, 0x07060706, 0x07060706, 0x07060706, 0x07060706,
+ 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706,
+ 0x07060706, 0x07060706, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807,
+};
+static const tsf_u32 preset_65_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x03020302, 0x03020302, 0x04030302,
+ 0x04030403, 0x04030403, 0x04030403, 0x05040504, 0x05040504, 0x06050605, 0x06050605, 0x06050605,
+ 0x06050605, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706,
+ 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706,
+ 0x07060706, 0x07060706, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807,
+};
+static const tsf_u32 preset_66_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x02010201, 0x03020201, 0x03020302, 0x04030302, 0x04030403, 0x04030403,
+ 0x05040403, 0x05040504, 0x06050504, 0x06050605, 0x06050605, 0x07060605, 0x07060706, 0x07060706,
+ 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706,
+ 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706,
+ 0x07060706, 0x07060706, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807, 0x08070807,
+};
+static const tsf_u32 preset_67_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x03020201, 0x03020302, 0x04030403, 0x04030403,
+ 0x05040403, 0x05040504, 0x06050504, 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x06050605,
+ 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x06050605,
+ 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x06050605, 0x06050605,
+ 0x06050605, 0x06050605, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706, 0x07060706,
+};
+static const tsf_u32 preset_68_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x02010201, 0x02010201, 0x03020201, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x04030403,
+ 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403, 0x04030403,
+};
+static const tsf_u32 preset_69_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_70_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010100, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_71_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_72_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03010301, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_73_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_74_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_75_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03010301, 0x03010301, 0x03010301, 0x03010301,
+ 0x03010301, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_76_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03010301, 0x03010301,
+ 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_77_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_78_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_79_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_80_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_81_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x04000300, 0x04000400, 0x04000400, 0x04000400, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_82_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03010301, 0x03010301,
+ 0x03010301, 0x03010301, 0x03010301, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_83_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03010301, 0x03010301,
+ 0x03010301, 0x03010301, 0x03010301, 0x04010301, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_84_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x04000300, 0x04000400, 0x04000400, 0x04010400, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_85_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03010301, 0x03010301, 0x03010301, 0x03010301,
+ 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_86_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x04000400, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_87_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x05010401, 0x05010501, 0x05010501, 0x05010501, 0x05020502,
+ 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502,
+};
+static const tsf_u32 preset_88_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_89_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_90_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x04000300, 0x04000400, 0x04000400, 0x04010400, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_91_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03010300, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301,
+ 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_92_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x04010301, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_93_keyspans[64] PROGMEM = {
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x05000400, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x05000500, 0x06000500, 0x06000600,
+ 0x06000600, 0x06000600, 0x06000600, 0x07010701, 0x07010701, 0x07010701, 0x07010701, 0x07010701,
+ 0x07010701, 0x08020702, 0x08020802, 0x08020802, 0x08020802, 0x08020802, 0x08020802, 0x08020802,
+ 0x08020802, 0x08020802, 0x08020802, 0x08020802, 0x08020802, 0x08020802, 0x08020802, 0x08020802,
+};
+static const tsf_u32 preset_94_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_95_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010100, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_96_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03010301,
+ 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301,
+};
+static const tsf_u32 preset_97_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x04000400, 0x04000400, 0x04000400,
+ 0x04010400, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_98_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03010300,
+ 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301,
+ 0x03010301, 0x03010301, 0x03010301, 0x04010301, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_99_keyspans[64] PROGMEM = {
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04010400, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04020402, 0x04020402, 0x04020402, 0x04020402, 0x04020402, 0x04020402, 0x04020402,
+ 0x04020402, 0x04020402, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502, 0x05020502,
+};
+static const tsf_u32 preset_100_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03010301, 0x03010301,
+ 0x03010301, 0x03010301, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_101_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_102_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_103_keyspans[64] PROGMEM = {
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200,
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200,
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200,
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200,
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200,
+ 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200, 0x02000200,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_104_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010100, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_105_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x02010100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_106_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x05000500, 0x05000500,
+ 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501,
+};
+static const tsf_u32 preset_107_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_108_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03010300, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301,
+ 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x04010301, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_109_keyspans[64] PROGMEM = {
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+};
+static const tsf_u32 preset_110_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x02010100, 0x02010201, 0x03020201, 0x03020302, 0x04030302,
+ 0x04030403, 0x05040403, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504,
+ 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504,
+ 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x05040504, 0x06050605, 0x06050605,
+};
+static const tsf_u32 preset_111_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_112_keyspans[64] PROGMEM = {
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04010400, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04020401,
+ 0x04020402, 0x04020402, 0x04020402, 0x04020402, 0x04020402, 0x04020402, 0x04020402, 0x04020402,
+};
+static const tsf_u32 preset_113_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x04000300, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04010400, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_114_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_115_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010100, 0x02010201,
+};
+static const tsf_u32 preset_116_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301,
+};
+static const tsf_u32 preset_117_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010100, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_118_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03010301, 0x03010301, 0x03010301, 0x03010301,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_119_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x02010100, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_120_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_121_keyspans[64] PROGMEM = {
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100,
+ 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x01000100, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+};
+static const tsf_u32 preset_122_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03010301,
+ 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x04010301, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_123_keyspans[64] PROGMEM = {
+ 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501,
+ 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501,
+ 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501,
+ 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501,
+ 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501, 0x05010501,
+ 0x05010501, 0x05010501, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201, 0x02010201,
+ 0x02010201, 0x02010201, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302,
+ 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x03020302, 0x04000302,
+};
+static const tsf_u32 preset_124_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_125_keyspans[64] PROGMEM = {
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400,
+ 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04000400, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+ 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04020401, 0x04020402, 0x04020402,
+ 0x04020402, 0x04020402, 0x04020402, 0x04020402, 0x04020402, 0x04020402, 0x04020402, 0x04020402,
+};
+static const tsf_u32 preset_126_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x03010301, 0x04010301, 0x04010401,
+};
+static const tsf_u32 preset_127_keyspans[64] PROGMEM = {
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300, 0x03000300,
+ 0x03000300, 0x03010300, 0x03010301, 0x04010401, 0x04010401, 0x04010401, 0x04010401, 0x04010401,
+};
+static const tsf_u32 preset_128_keyspans[64] PROGMEM = {
+ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01000000, 0x04030301, 0x06050504,
+ 0x08070706, 0x0b0a0a08, 0x0d0c0c0b, 0x100e0e0d, 0x13121210, 0x15141413, 0x17161615, 0x19181817,
+ 0x1b1a1a19, 0x1d1c1c1b, 0x1f1e1e1d, 0x2120201f, 0x23222221, 0x25242423, 0x27262625, 0x29282827,
+ 0x2b2a2a29, 0x2d2c2c2b, 0x2f2e2e2d, 0x3130302f, 0x33323231, 0x35343433, 0x37363635, 0x39383837,
+ 0x3b3a3a39, 0x3e3c3c3b, 0x413f3f3e, 0x44424241, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+ 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+};
 static const struct tsf_preset presets[] PROGMEM = {
 {
  .presetName={80,105,97,110,111,32,49,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=0, .bank=0,
  .regions=preset_0_regions,
- .regionNum=8
+ .regionNum=8,
+ .keySpans=preset_0_keyspans
 },
 {
  .presetName={80,105,97,110,111,32,50,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=1, .bank=0,
  .regions=preset_1_regions,
- .regionNum=8
+ .regionNum=8,
+ .keySpans=preset_1_keyspans
 },
 {
  .presetName={80,105,97,110,111,32,51,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=2, .bank=0,
  .regions=preset_2_regions,
- .regionNum=6
+ .regionNum=6,
+ .keySpans=preset_2_keyspans
 },
 {
  .presetName={72,111,110,107,121,45,84,111,110,107,32,32,0,0,0,0,0,0,0,0},
  .preset=3, .bank=0,
  .regions=preset_3_regions,
- .regionNum=16
+ .regionNum=16,
+ .keySpans=preset_3_keyspans
 },
 {
  .presetName={69,32,80,105,97,110,111,32,49,32,32,32,0,0,0,0,0,0,0,0},
  .preset=4, .bank=0,
  .regions=preset_4_regions,
- .regionNum=8
+ .regionNum=8,
+ .keySpans=preset_4_keyspans
 },
 {
  .presetName={69,32,80,105,97,110,111,32,50,32,32,32,0,0,0,0,0,0,0,0},
  .preset=5, .bank=0,
  .regions=preset_5_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_5_keyspans
 },
 {
  .presetName={72,97,114,112,115,105,99,104,111,114,100,32,0,0,0,0,0,0,0,0},
  .preset=6, .bank=0,
  .regions=preset_6_regions,
- .regionNum=5
+ .regionNum=5,
+ .keySpans=preset_6_keyspans
 },
 {
  .presetName={67,108,97,118,105,110,101,116,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=7, .bank=0,
  .regions=preset_7_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_7_keyspans
 },
 {
  .presetName={67,101,108,101,115,116,97,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=8, .bank=0,
  .regions=preset_8_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_8_keyspans
 },
 {
  .presetName={71,108,111,99,107,101,110,115,112,105,101,108,0,0,0,0,0,0,0,0},
  .preset=9, .bank=0,
  .regions=preset_9_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_9_keyspans
 },
 {
  .presetName={77,117,115,105,99,32,66,111,120,32,32,32,0,0,0,0,0,0,0,0},
  .preset=10, .bank=0,
  .regions=preset_10_regions,
- .regionNum=6
+ .regionNum=6,
+ .keySpans=preset_10_keyspans
 },
 {
  .presetName={86,105,98,114,97,112,104,111,110,101,32,32,0,0,0,0,0,0,0,0},
  .preset=11, .bank=0,
  .regions=preset_11_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_11_keyspans
 },
 {
  .presetName={77,97,114,105,109,98,97,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=12, .bank=0,
  .regions=preset_12_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_12_keyspans
 },
 {
  .presetName={88,121,108,111,112,104,111,110,101,32,32,32,0,0,0,0,0,0,0,0},
  .preset=13, .bank=0,
  .regions=preset_13_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_13_keyspans
 },
 {
  .presetName={84,117,98,117,108,97,114,32,66,101,108,108,0,0,0,0,0,0,0,0},
  .preset=14, .bank=0,
  .regions=preset_14_regions,
- .regionNum=1
+ .regionNum=1,
+ .keySpans=preset_14_keyspans
 },
 {
  .presetName={83,97,110,116,117,114,32,32,32,32,0,0,0,0,0,0,0,0,0,0},
  .preset=15, .bank=0,
  .regions=preset_15_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_15_keyspans
 },
 {
  .presetName={79,114,103,97,110,32,49,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=16, .bank=0,
  .regions=preset_16_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_16_keyspans
 },
 {
  .presetName={79,114,103,97,110,32,50,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=17, .bank=0,
  .regions=preset_17_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_17_keyspans
 },
 {
  .presetName={79,114,103,97,110,32,51,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=18, .bank=0,
  .regions=preset_18_regions,
- .regionNum=5
+ .regionNum=5,
+ .keySpans=preset_18_keyspans
 },
 {
  .presetName={67,104,117,114,99,104,32,79,114,103,32,49,0,0,0,0,0,0,0,0},
  .preset=19, .bank=0,
  .regions=preset_19_regions,
- .regionNum=5
+ .regionNum=5,
+ .keySpans=preset_19_keyspans
 },
 {
  .presetName={82,101,101,100,32,79,114,103,97,110,32,32,0,0,0,0,0,0,0,0},
  .preset=20, .bank=0,
  .regions=preset_20_regions,
- .regionNum=5
+ .regionNum=5,
+ .keySpans=preset_20_keyspans
 },
 {
  .presetName={65,99,99,111,114,100,105,97,110,32,0,0,0,0,0,0,0,0,0,0},
  .preset=21, .bank=0,
  .regions=preset_21_regions,
- .regionNum=6
+ .regionNum=6,
+ .keySpans=preset_21_keyspans
 },
 {
  .presetName={72,97,114,109,111,110,105,99,97,32,32,32,0,0,0,0,0,0,0,0},
  .preset=22, .bank=0,
  .regions=preset_22_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_22_keyspans
 },
 {
  .presetName={66,97,110,100,110,101,111,110,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=23, .bank=0,
  .regions=preset_23_regions,
- .regionNum=5
+ .regionNum=5,
+ .keySpans=preset_23_keyspans
 },
 {
  .presetName={78,121,108,111,110,32,115,116,114,46,71,116,0,0,0,0,0,0,0,0},
  .preset=24, .bank=0,
  .regions=preset_24_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_24_keyspans
 },
 {
  .presetName={83,116,101,101,108,45,115,116,114,46,71,116,0,0,0,0,0,0,0,0},
  .preset=25, .bank=0,
  .regions=preset_25_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_25_keyspans
 },
 {
  .presetName={74,97,122,122,32,71,116,46,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=26, .bank=0,
  .regions=preset_26_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_26_keyspans
 },
 {
  .presetName={67,108,101,97,110,32,71,116,46,32,32,32,0,0,0,0,0,0,0,0},
  .preset=27, .bank=0,
  .regions=preset_27_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_27_keyspans
 },
 {
  .presetName={77,117,116,101,100,32,71,116,46,32,32,32,0,0,0,0,0,0,0,0},
  .preset=28, .bank=0,
  .regions=preset_28_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_28_keyspans
 },
 {
  .presetName={79,118,101,114,100,114,105,118,101,32,71,116,0,0,0,0,0,0,0,0},
  .preset=29, .bank=0,
  .regions=preset_29_regions,
- .regionNum=6
+ .regionNum=6,
+ .keySpans=preset_29_keyspans
 },
 {
  .presetName={68,105,115,116,111,114,116,105,111,110,32,71,0,0,0,0,0,0,0,0},
  .preset=30, .bank=0,
  .regions=preset_30_regions,
- .regionNum=5
+ .regionNum=5,
+ .keySpans=preset_30_keyspans
 },
 {
  .presetName={71,116,46,72,97,114,109,111,110,105,99,115,0,0,0,0,0,0,0,0},
  .preset=31, .bank=0,
  .regions=preset_31_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_31_keyspans
 },
 {
  .presetName={65,99,99,111,117,115,116,105,99,32,66,115,0,0,0,0,0,0,0,0},
  .preset=32, .bank=0,
  .regions=preset_32_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_32_keyspans
 },
 {
  .presetName={70,105,110,103,101,114,101,100,32,66,115,46,0,0,0,0,0,0,0,0},
  .preset=33, .bank=0,
  .regions=preset_33_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_33_keyspans
 },
 {
  .presetName={80,105,99,107,101,100,32,66,115,46,32,32,0,0,0,0,0,0,0,0},
  .preset=34, .bank=0,
  .regions=preset_34_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_34_keyspans
 },
 {
  .presetName={70,114,101,116,108,101,115,115,32,66,115,46,0,0,0,0,0,0,0,0},
  .preset=35, .bank=0,
  .regions=preset_35_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_35_keyspans
 },
 {
  .presetName={83,108,97,112,32,66,97,115,115,32,49,32,0,0,0,0,0,0,0,0},
  .preset=36, .bank=0,
  .regions=preset_36_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_36_keyspans
 },
 {
  .presetName={83,108,97,112,32,66,97,115,115,32,50,32,0,0,0,0,0,0,0,0},
  .preset=37, .bank=0,
  .regions=preset_37_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_37_keyspans
 },
 {
  .presetName={83,121,110,116,104,32,66,97,115,115,32,49,0,0,0,0,0,0,0,0},
  .preset=38, .bank=0,
  .regions=preset_38_regions,
- .regionNum=5
+ .regionNum=5,
+ .keySpans=preset_38_keyspans
 },
 {
  .presetName={83,121,110,116,104,32,66,97,115,115,32,50,0,0,0,0,0,0,0,0},
  .preset=39, .bank=0,
  .regions=preset_39_regions,
- .regionNum=6
+ .regionNum=6,
+ .keySpans=preset_39_keyspans
 },
 {
  .presetName={86,105,111,108,105,110,32,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=40, .bank=0,
  .regions=preset_40_regions,
- .regionNum=6
+ .regionNum=6,
+ .keySpans=preset_40_keyspans
 },
 {
  .presetName={86,105,111,108,97,32,32,32,32,32,32,32,32,0,0,0,0,0,0,0},
  .preset=41, .bank=0,
  .regions=preset_41_regions,
- .regionNum=6
+ .regionNum=6,
+ .keySpans=preset_41_keyspans
 },
 {
  .presetName={67,101,108,108,111,32,32,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=42, .bank=0,
  .regions=preset_42_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_42_keyspans
 },
 {
  .presetName={67,111,110,116,114,97,98,97,115,115,32,32,0,0,0,0,0,0,0,0},
  .preset=43, .bank=0,
  .regions=preset_43_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_43_keyspans
 },
 {
  .presetName={84,114,101,109,101,108,111,32,83,116,114,105,0,0,0,0,0,0,0,0},
  .preset=44, .bank=0,
  .regions=preset_44_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_44_keyspans
 },
 {
  .presetName={80,105,122,122,32,83,116,114,105,110,103,115,0,0,0,0,0,0,0,0},
  .preset=45, .bank=0,
  .regions=preset_45_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_45_keyspans
 },
 {
  .presetName={72,97,114,112,32,32,32,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=46, .bank=0,
  .regions=preset_46_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_46_keyspans
 },
 {
  .presetName={84,105,109,112,97,110,105,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=47, .bank=0,
  .regions=preset_47_regions,
- .regionNum=8
+ .regionNum=8,
+ .keySpans=preset_47_keyspans
 },
 {
  .presetName={83,116,114,105,110,103,115,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=48, .bank=0,
  .regions=preset_48_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_48_keyspans
 },
 {
  .presetName={83,108,111,119,32,83,116,114,105,110,103,115,0,0,0,0,0,0,0,0},
  .preset=49, .bank=0,
  .regions=preset_49_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_49_keyspans
 },
 {
  .presetName={83,121,110,116,104,32,83,116,114,105,110,103,0,0,0,0,0,0,0,0},
  .preset=50, .bank=0,
  .regions=preset_50_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_50_keyspans
 },
 {
  .presetName={83,121,110,116,104,32,83,116,114,32,50,32,0,0,0,0,0,0,0,0},
  .preset=51, .bank=0,
  .regions=preset_51_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_51_keyspans
 },
 {
  .presetName={67,104,111,105,114,32,65,97,104,115,32,32,0,0,0,0,0,0,0,0},
  .preset=52, .bank=0,
  .regions=preset_52_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_52_keyspans
 },
 {
  .presetName={86,111,105,99,101,32,79,111,104,115,32,32,0,0,0,0,0,0,0,0},
  .preset=53, .bank=0,
  .regions=preset_53_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_53_keyspans
 },
 {
  .presetName={83,121,110,116,104,32,86,111,105,99,101,32,0,0,0,0,0,0,0,0},
  .preset=54, .bank=0,
  .regions=preset_54_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_54_keyspans
 },
 {
  .presetName={79,114,99,104,101,115,116,114,97,32,72,116,0,0,0,0,0,0,0,0},
  .preset=55, .bank=0,
  .regions=preset_55_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_55_keyspans
 },
 {
  .presetName={84,114,117,109,112,101,116,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=56, .bank=0,
  .regions=preset_56_regions,
- .regionNum=6
+ .regionNum=6,
+ .keySpans=preset_56_keyspans
 },
 {
  .presetName={84,114,111,109,98,111,110,101,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=57, .bank=0,
  .regions=preset_57_regions,
- .regionNum=5
+ .regionNum=5,
+ .keySpans=preset_57_keyspans
 },
 {
  .presetName={84,117,98,97,32,32,32,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=58, .bank=0,
  .regions=preset_58_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_58_keyspans
 },
 {
  .presetName={77,117,116,101,100,32,84,114,117,109,112,32,0,0,0,0,0,0,0,0},
  .preset=59, .bank=0,
  .regions=preset_59_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_59_keyspans
 },
 {
  .presetName={70,114,101,110,99,104,32,72,111,114,110,32,0,0,0,0,0,0,0,0},
  .preset=60, .bank=0,
  .regions=preset_60_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_60_keyspans
 },
 {
  .presetName={66,114,97,115,115,32,49,0,0,0,0,0,0,0,0,0,0,0,0,0},
  .preset=61, .bank=0,
  .regions=preset_61_regions,
- .regionNum=6
+ .regionNum=6,
+ .keySpans=preset_61_keyspans
 },
 {
  .presetName={83,121,110,116,104,32,66,114,97,115,115,49,0,0,0,0,0,0,0,0},
  .preset=62, .bank=0,
  .regions=preset_62_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_62_keyspans
 },
 {
  .presetName={83,121,110,116,104,32,66,114,97,115,115,50,0,0,0,0,0,0,0,0},
  .preset=63, .bank=0,
  .regions=preset_63_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_63_keyspans
 },
 {
  .presetName={83,111,112,114,97,110,111,32,83,97,120,32,0,0,0,0,0,0,0,0},
  .preset=64, .bank=0,
  .regions=preset_64_regions,
- .regionNum=8
+ .regionNum=8,
+ .keySpans=preset_64_keyspans
 },
 {
  .presetName={65,108,116,111,32,83,97,120,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=65, .bank=0,
  .regions=preset_65_regions,
- .regionNum=8
+ .regionNum=8,
+ .keySpans=preset_65_keyspans
 },
 {
  .presetName={84,101,110,111,114,32,83,97,120,32,32,32,0,0,0,0,0,0,0,0},
  .preset=66, .bank=0,
  .regions=preset_66_regions,
- .regionNum=8
+ .regionNum=8,
+ .keySpans=preset_66_keyspans
 },
 {
  .presetName={66,97,114,105,116,111,110,101,32,83,97,120,0,0,0,0,0,0,0,0},
  .preset=67, .bank=0,
  .regions=preset_67_regions,
- .regionNum=7
+ .regionNum=7,
+ .keySpans=preset_67_keyspans
 },
 {
  .presetName={79,98,111,101,32,32,32,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=68, .bank=0,
  .regions=preset_68_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_68_keyspans
 },
 {
  .presetName={69,110,103,108,105,115,104,32,72,111,114,110,0,0,0,0,0,0,0,0},
  .preset=69, .bank=0,
  .regions=preset_69_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_69_keyspans
 },
 {
  .presetName={66,97,115,115,111,111,110,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=70, .bank=0,
  .regions=preset_70_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_70_keyspans
 },
 {
  .presetName={67,108,97,114,105,110,101,116,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=71, .bank=0,
  .regions=preset_71_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_71_keyspans
 },
 {
  .presetName={80,105,99,99,111,108,111,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=72, .bank=0,
  .regions=preset_72_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_72_keyspans
 },
 {
  .presetName={70,108,117,116,101,32,32,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=73, .bank=0,
  .regions=preset_73_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_73_keyspans
 },
 {
  .presetName={82,101,99,111,114,100,101,114,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=74, .bank=0,
  .regions=preset_74_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_74_keyspans
 },
 {
  .presetName={80,97,110,32,70,108,117,116,101,32,32,32,0,0,0,0,0,0,0,0},
  .preset=75, .bank=0,
  .regions=preset_75_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_75_keyspans
 },
 {
  .presetName={66,108,111,119,110,32,66,111,116,116,108,101,0,0,0,0,0,0,0,0},
  .preset=76, .bank=0,
  .regions=preset_76_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_76_keyspans
 },
 {
  .presetName={83,104,97,107,117,104,97,99,104,105,32,32,0,0,0,0,0,0,0,0},
  .preset=77, .bank=0,
  .regions=preset_77_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_77_keyspans
 },
 {
  .presetName={87,104,105,115,116,108,101,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=78, .bank=0,
  .regions=preset_78_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_78_keyspans
 },
 {
  .presetName={79,99,97,114,105,110,97,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=79, .bank=0,
  .regions=preset_79_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_79_keyspans
 },
 {
  .presetName={83,113,117,97,114,101,32,87,97,118,101,32,0,0,0,0,0,0,0,0},
  .preset=80, .bank=0,
  .regions=preset_80_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_80_keyspans
 },
 {
  .presetName={83,97,119,32,87,97,118,101,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=81, .bank=0,
  .regions=preset_81_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_81_keyspans
 },
 {
  .presetName={83,121,110,32,67,97,108,108,105,111,112,101,0,0,0,0,0,0,0,0},
  .preset=82, .bank=0,
  .regions=preset_82_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_82_keyspans
 },
 {
  .presetName={67,104,105,102,102,101,114,32,76,101,97,100,0,0,0,0,0,0,0,0},
  .preset=83, .bank=0,
  .regions=preset_83_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_83_keyspans
 },
 {
  .presetName={67,104,97,114,97,110,103,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=84, .bank=0,
  .regions=preset_84_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_84_keyspans
 },
 {
  .presetName={83,111,108,111,32,86,111,120,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=85, .bank=0,
  .regions=preset_85_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_85_keyspans
 },
 {
  .presetName={53,116,104,32,83,97,119,32,87,97,118,101,0,0,0,0,0,0,0,0},
  .preset=86, .bank=0,
  .regions=preset_86_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_86_keyspans
 },
 {
  .presetName={66,97,115,115,32,38,32,76,101,97,100,32,0,0,0,0,0,0,0,0},
  .preset=87, .bank=0,
  .regions=preset_87_regions,
- .regionNum=5
+ .regionNum=5,
+ .keySpans=preset_87_keyspans
 },
 {
  .presetName={70,97,110,116,97,115,105,97,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=88, .bank=0,
  .regions=preset_88_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_88_keyspans
 },
 {
  .presetName={87,97,114,109,32,80,97,100,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=89, .bank=0,
  .regions=preset_89_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_89_keyspans
 },
 {
  .presetName={80,111,108,121,115,121,110,116,104,32,32,32,0,0,0,0,0,0,0,0},
  .preset=90, .bank=0,
  .regions=preset_90_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_90_keyspans
 },
 {
  .presetName={83,112,97,99,101,32,86,111,105,99,101,32,0,0,0,0,0,0,0,0},
  .preset=91, .bank=0,
  .regions=preset_91_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_91_keyspans
 },
 {
  .presetName={66,111,119,101,100,32,71,108,97,115,115,32,0,0,0,0,0,0,0,0},
  .preset=92, .bank=0,
  .regions=preset_92_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_92_keyspans
 },
 {
  .presetName={77,101,116,97,108,32,80,97,100,32,32,32,0,0,0,0,0,0,0,0},
  .preset=93, .bank=0,
  .regions=preset_93_regions,
- .regionNum=8
+ .regionNum=8,
+ .keySpans=preset_93_keyspans
 },
 {
  .presetName={72,97,108,111,32,80,97,100,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=94, .bank=0,
  .regions=preset_94_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_94_keyspans
 },
 {
  .presetName={83,119,101,101,112,32,80,97,100,32,32,32,0,0,0,0,0,0,0,0},
  .preset=95, .bank=0,
  .regions=preset_95_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_95_keyspans
 },
 {
  .presetName={73,99,101,32,82,97,105,110,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=96, .bank=0,
  .regions=preset_96_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_96_keyspans
 },
 {
  .presetName={83,111,117,110,100,116,114,97,99,107,32,32,0,0,0,0,0,0,0,0},
  .preset=97, .bank=0,
  .regions=preset_97_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_97_keyspans
 },
 {
  .presetName={67,114,121,115,116,97,108,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=98, .bank=0,
  .regions=preset_98_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_98_keyspans
 },
 {
  .presetName={65,116,109,111,115,112,104,101,114,101,32,32,0,0,0,0,0,0,0,0},
  .preset=99, .bank=0,
  .regions=preset_99_regions,
- .regionNum=5
+ .regionNum=5,
+ .keySpans=preset_99_keyspans
 },
 {
  .presetName={66,114,105,103,104,116,110,101,115,115,32,32,0,0,0,0,0,0,0,0},
  .preset=100, .bank=0,
  .regions=preset_100_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_100_keyspans
 },
 {
  .presetName={71,111,98,108,105,110,32,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=101, .bank=0,
  .regions=preset_101_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_101_keyspans
 },
 {
  .presetName={69,99,104,111,32,68,114,111,112,115,32,32,0,0,0,0,0,0,0,0},
  .preset=102, .bank=0,
  .regions=preset_102_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_102_keyspans
 },
 {
  .presetName={83,116,97,114,32,84,104,101,109,101,32,32,0,0,0,0,0,0,0,0},
  .preset=103, .bank=0,
  .regions=preset_103_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_103_keyspans
 },
 {
  .presetName={83,105,116,97,114,32,32,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=104, .bank=0,
  .regions=preset_104_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_104_keyspans
 },
 {
  .presetName={66,97,110,106,111,32,32,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=105, .bank=0,
  .regions=preset_105_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_105_keyspans
 },
 {
  .presetName={83,104,97,109,105,115,101,110,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=106, .bank=0,
  .regions=preset_106_regions,
- .regionNum=5
+ .regionNum=5,
+ .keySpans=preset_106_keyspans
 },
 {
  .presetName={75,111,116,111,32,32,32,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=107, .bank=0,
  .regions=preset_107_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_107_keyspans
 },
 {
  .presetName={75,97,108,105,109,98,97,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=108, .bank=0,
  .regions=preset_108_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_108_keyspans
 },
 {
  .presetName={66,97,103,32,80,105,112,101,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=109, .bank=0,
  .regions=preset_109_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_109_keyspans
 },
 {
  .presetName={70,105,100,100,108,101,32,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=110, .bank=0,
  .regions=preset_110_regions,
- .regionNum=6
+ .regionNum=6,
+ .keySpans=preset_110_keyspans
 },
 {
  .presetName={83,104,97,110,97,105,32,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=111, .bank=0,
  .regions=preset_111_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_111_keyspans
 },
 {
  .presetName={84,105,110,107,101,114,32,66,101,108,108,32,0,0,0,0,0,0,0,0},
  .preset=112, .bank=0,
  .regions=preset_112_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_112_keyspans
 },
 {
  .presetName={65,103,111,103,111,32,32,32,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=113, .bank=0,
  .regions=preset_113_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_113_keyspans
 },
 {
  .presetName={83,116,101,101,108,32,68,114,117,109,115,32,0,0,0,0,0,0,0,0},
  .preset=114, .bank=0,
  .regions=preset_114_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_114_keyspans
 },
 {
  .presetName={87,111,111,100,32,66,108,111,99,107,32,32,0,0,0,0,0,0,0,0},
  .preset=115, .bank=0,
  .regions=preset_115_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_115_keyspans
 },
 {
  .presetName={84,97,105,107,111,32,68,114,117,109,32,32,0,0,0,0,0,0,0,0},
  .preset=116, .bank=0,
  .regions=preset_116_regions,
- .regionNum=3
+ .regionNum=3,
+ .keySpans=preset_116_keyspans
 },
 {
  .presetName={77,101,108,111,32,84,111,109,32,49,32,32,0,0,0,0,0,0,0,0},
  .preset=117, .bank=0,
  .regions=preset_117_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_117_keyspans
 },
 {
  .presetName={83,121,110,116,104,32,68,114,117,109,32,32,32,0,0,0,0,0,0,0},
  .preset=118, .bank=0,
  .regions=preset_118_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_118_keyspans
 },
 {
  .presetName={82,101,118,101,114,115,101,32,67,121,109,98,0,0,0,0,0,0,0,0},
  .preset=119, .bank=0,
  .regions=preset_119_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_119_keyspans
 },
 {
  .presetName={71,116,32,70,114,101,116,78,111,105,115,101,0,0,0,0,0,0,0,0},
  .preset=120, .bank=0,
  .regions=preset_120_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_120_keyspans
 },
 {
  .presetName={66,114,101,97,116,104,32,78,111,0,0,0,0,0,0,0,0,0,0,0},
  .preset=121, .bank=0,
  .regions=preset_121_regions,
- .regionNum=2
+ .regionNum=2,
+ .keySpans=preset_121_keyspans
 },
 {
  .presetName={83,101,97,83,104,111,114,101,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=122, .bank=0,
  .regions=preset_122_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_122_keyspans
 },
 {
  .presetName={66,105,114,100,32,84,119,101,101,116,32,32,0,0,0,0,0,0,0,0},
  .preset=123, .bank=0,
  .regions=preset_123_regions,
- .regionNum=5
+ .regionNum=5,
+ .keySpans=preset_123_keyspans
 },
 {
  .presetName={84,101,108,101,112,104,111,110,101,32,32,32,0,0,0,0,0,0,0,0},
  .preset=124, .bank=0,
  .regions=preset_124_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_124_keyspans
 },
 {
  .presetName={72,101,108,105,99,111,112,116,101,114,32,32,0,0,0,0,0,0,0,0},
  .preset=125, .bank=0,
  .regions=preset_125_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_125_keyspans
 },
 {
  .presetName={65,112,112,108,97,117,115,101,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=126, .bank=0,
  .regions=preset_126_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_126_keyspans
 },
 {
  .presetName={71,117,110,32,83,104,111,116,32,32,32,32,0,0,0,0,0,0,0,0},
  .preset=127, .bank=0,
  .regions=preset_127_regions,
- .regionNum=4
+ .regionNum=4,
+ .keySpans=preset_127_keyspans
 },
 {
  .presetName={83,116,97,110,100,97,114,100,32,32,0,0,0,0,0,0,0,0,0,0},
  .preset=0, .bank=128,
  .regions=preset_128_regions,
- .regionNum=68
+ .regionNum=68,
+ .keySpans=preset_128_keyspans
 },
 };
 static const short shortSamples[523794] PROGMEM = {
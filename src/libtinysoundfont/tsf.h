@@ -81,6 +81,16 @@ extern "C" {
 // Define this to use 16 fixed point samples instead of floating point
 //#define TSF_SAMPLES_SHORT
 
+// Define this (with TSF_SAMPLES_SHORT) for tsf_load_streamed, which keeps the SF2 parser even for a precompiled header
+//#define TSF_STREAMED
+#if defined(TSF_STREAMED) && !defined(TSF_SAMPLES_SHORT)
+#undef TSF_STREAMED
+#endif
+
+#if !defined(TSF_CONST_FILE) || defined(TSF_STREAMED)
+#define TSF_LOADER
+#endif
+
 // The load functions will return a pointer to a struct tsf which all functions
 // thereafter take as the first parameter.
 // On error the tsf_load* functions will return NULL most likely due to invalid
@@ -108,6 +118,10 @@ struct tsf_stream
 
 	// Function pointer will be called to skip ahead over 'count' bytes (returns 1 on success, 0 on error)
 	int (*skip)(void* data, unsigned int count);
+
+	// Function pointer will be called to move to the absolute offset 'pos' (returns 1 on success, 0 on error)
+	// Only needed by tsf_load_streamed
+	int (*seek)(void* data, unsigned int pos);
 };
 
 #ifndef TSF_CONST_FILE
@@ -115,6 +129,16 @@ struct tsf_stream
 TSFDEF tsf* tsf_load(struct tsf_stream* stream);
 #endif
 
+#ifdef TSF_STREAMED
+// Load only the presets and regions of a SoundFont, leaving its samples in the stream to be read as they
+// are played.  Up to cache_bytes of them are kept in RAM, in chunks of TSF_SAMPLE_CHUNK samples.
+// The stream is copied, but whatever it reads from has to stay open until tsf_close.
+TSFDEF tsf* tsf_load_streamed(struct tsf_stream* stream, int cache_bytes);
+
+// Returns the sample cache hit and miss counts of a streamed SoundFont, or 0 if it isn't one
+TSFDEF int tsf_sample_cache_stats(tsf* f, unsigned int* hits, unsigned int* misses);
+#endif
+
 // Copy a tsf instance from an existing one, use tsf_close to close it as well.
 // All copied tsf instances and their original instance are linked, and share the underlying soundfont.
 // This allows loading a soundfont only once, but using it for multiple independent playbacks.
@@ -190,6 +214,19 @@ TSFDEF void tsf_set_volume(tsf* f, float global_gain);
 //   (tsf_set_max_voices returns 0 if allocation failed, otherwise 1)
 TSFDEF int tsf_set_max_voices(tsf* f, int max_voices);
 
+// Limit how many voices may sound at once, which can be changed at any time (e.g. to follow CPU load)
+// When a new voice would go over the cap, the quietest one sounding (preferring voices already in their
+// release) is faded out quickly to make room instead of the new note being dropped.
+//   voice_cap: voices allowed to sound at once, or 0 for no cap
+TSFDEF void tsf_set_voice_cap(tsf* f, int voice_cap);
+
+// Returns the number of voices faded out early to stay under the voice cap
+TSFDEF int tsf_stolen_voice_count(tsf* f);
+
+// Fades out the quietest note still held, the same way the voice cap does, to make room for another.
+// Returns its key and sets *preset_index, or returns -1 when no note is held.
+TSFDEF int tsf_note_steal(tsf* f, int* preset_index);
+
 // Start playing a note
 //   preset_index: preset index >= 0 and < tsf_get_presetcount()
 //   key: note value between 0 and 127 (60 being middle C)
@@ -295,6 +332,13 @@ TSFDEF float tsf_channel_get_tuning(tsf* f, int channel);
 #endif
 #endif
 
+// With TSF_SAMPLES_SHORT the per-voice low-pass filter roughly triples the cost of a filtered voice, and most
+// GM instruments are filtered.  It's left out (instruments sound brighter) unless TSF_LOWPASS is defined, so
+// every target renders as many voices as it did before the filter.
+#if !defined(TSF_LOWPASS) && !defined(TSF_NO_LOWPASS)
+#define TSF_NO_LOWPASS
+#endif
+
 // The lower this block size is the more accurate the effects are.
 // Increasing the value significantly lowers the CPU usage of the voice rendering.
 // If LFO affects the low-pass filter it can be hearable even as low as 8.
@@ -302,6 +346,17 @@ TSFDEF float tsf_channel_get_tuning(tsf* f, int channel);
 #define TSF_RENDER_EFFECTSAMPLEBLOCK 64
 #endif
 
+// Attacks are ramped in steps of this many samples within an effect block.  Define TSF_NO_ATTACK_RAMP to
+// step them once a block as the original renderer did
+#ifndef TSF_ATTACK_STEP
+#define TSF_ATTACK_STEP 16
+#endif
+
+// Samples are read from a streamed SoundFont this many at a time (must be a power of two)
+#ifndef TSF_SAMPLE_CHUNK
+#define TSF_SAMPLE_CHUNK 1024
+#endif
+
 // When using tsf_render_short, to do the conversion a buffer of a fixed size is
 // allocated on the stack. On low memory platforms this could be made smaller.
 // Increasing this above 512 should not have a significant impact on performance.
@@ -377,11 +432,16 @@ typedef int32_t fixed30p2;
 typedef int32_t fixed24p8;
 typedef int32_t fixed16p16;
 typedef int32_t fixed8p24;
+typedef int32_t fixed2p30;
+typedef int32_t fixed28p4;
+typedef int32_t fixed17p15;
 #endif
 
 
 #define TSF_FourCCEquals(value1, value2) (value1[0] == value2[0] && value1[1] == value2[1] && value1[2] == value2[2] && value1[3] == value2[3])
 
+struct tsf_sample_cache;
+
 struct tsf
 {
 	TSF_CONST struct tsf_preset* presets;
@@ -407,7 +467,28 @@ struct tsf
 #endif
 	float globalGainDB;
 	int* refCount;
+	int voiceCap;
+	int voicesStolen;
+#ifdef TSF_STREAMED
+	struct tsf_sample_cache* sampleCache;
+#endif
+};
+
+#ifdef TSF_STREAMED
+// The samples of a streamed SoundFont, read in TSF_SAMPLE_CHUNK at a time.  A miss reloads the slot
+// used longest ago.
+struct tsf_sample_cache
+{
+	struct tsf_stream stream;
+	tsf_u32 pos;            // stream offset while loading
+	tsf_u32 smplOffset;     // stream offset of the first sample
+	tsf_u32 samplesNum, chunkNum, slotNum, useCount, hits, misses;
+	short* slots;           // slotNum chunks of samples
+	short* chunkSlot;       // for each chunk, the slot holding it or -1
+	int* slotChunk;         // for each slot, the chunk in it or -1
+	tsf_u32* slotUsed;      // for each slot, useCount when last used
 };
+#endif
 
 #ifndef TSF_CONST_FILE
 #ifndef TSF_NO_STDIO
@@ -471,7 +552,7 @@ struct tsf_hydra_imod { tsf_u16 modSrcOper, modDestOper; tsf_s16 modAmount; tsf_
 struct tsf_hydra_igen { tsf_u16 genOper; union tsf_hydra_genamount genAmount; };
 struct tsf_hydra_shdr { tsf_char20 sampleName; tsf_u32 start, end, startLoop, endLoop, sampleRate; tsf_u8 originalPitch; tsf_s8 pitchCorrection; tsf_u16 sampleLink, sampleType; };
 
-#ifndef TSF_CONST_FILE
+#if defined(TSF_LOADER) && defined(TSF_IMPLEMENTATION)
 #define TSFR(FIELD) stream->read(stream->data, &i->FIELD, sizeof(i->FIELD));
 static void tsf_hydra_read_phdr(struct tsf_hydra_phdr* i, struct tsf_stream* stream) { TSFR(presetName) TSFR(preset) TSFR(bank) TSFR(presetBagNdx) TSFR(library) TSFR(genre) TSFR(morphology) }
 static void tsf_hydra_read_pbag(struct tsf_hydra_pbag* i, struct tsf_stream* stream) { TSFR(genNdx) TSFR(modNdx) }
@@ -487,11 +568,15 @@ static void tsf_hydra_read_shdr(struct tsf_hydra_shdr* i, struct tsf_stream* str
 
 struct tsf_riffchunk { tsf_fourcc id; tsf_u32 size; };
 struct tsf_envelope { float delay, attack, hold, decay, sustain, release, keynumToHold, keynumToDecay; };
-struct tsf_voice_envelope { unsigned char segment, segmentIsExponential : 1, isAmpEnv : 1; short midiVelocity; float level, slope; int samplesUntilNextSegment; struct tsf_envelope parameters; };
 #ifndef TSF_SAMPLES_SHORT
+struct tsf_voice_envelope { unsigned char segment, segmentIsExponential : 1, isAmpEnv : 1; short midiVelocity; float level, slope; int samplesUntilNextSegment; struct tsf_envelope parameters; };
 struct tsf_voice_lowpass { double QInv, a0, a1, b1, b2, z1, z2; TSF_BOOL active; };
 struct tsf_voice_lfo { int samplesUntil; float level, delta; };
 #else
+// Linear segments add slope to the level every sample, exponential ones add log2slope to log2(level)
+struct tsf_voice_envelope { unsigned char segment, segmentIsExponential : 1, isAmpEnv : 1; short midiVelocity; fixed2p30 levelF2P30, slopeF2P30; fixed8p24 log2slopeF8P24; int samplesUntilNextSegment; struct tsf_envelope parameters; };
+// Trapezoidal state variable filter with 1.15 coefficients, so every product fits in 32 bits
+struct tsf_voice_lowpass { fixed2p30 QInvF2P30; fixed17p15 b1F17P15, a2F17P15, a3F17P15; fixed8p24 log2FcScaleF8P24; fixed28p4 ic1F28P4, ic2F28P4; TSF_BOOL active; };
 struct tsf_voice_lfo { int samplesUntil; fixed16p16 levelF16P16, deltaF16P16; };
 #endif
 
@@ -529,6 +614,9 @@ struct tsf_preset
 #endif
 	TSF_CONST struct tsf_region* regions;
 	int regionNum;
+	// Which regions to check for each key, or NULL to check them all.  Word key/2 holds keys key&~1 and key|1 in
+	// its low and high halves, each the first region's index in the low byte and one past the last in the high.
+	TSF_CONST tsf_u32* keySpans;
 };
 
 struct tsf_voice
@@ -540,6 +628,7 @@ struct tsf_voice
 	double sourceSamplePosition;
 #else
 	float pitchInputTimecents, pitchOutputFactor;
+        fixed16p16 pitchRatioF16P16;
         fixed24p8 sourceSamplePositionF24P8;
 #endif
 	float  noteGainDB;
@@ -550,9 +639,7 @@ struct tsf_voice
 #endif
 	unsigned int playIndex, loopStart, loopEnd;
 	struct tsf_voice_envelope ampenv, modenv;
-#ifndef TSF_SAMPLES_SHORT
         struct tsf_voice_lowpass lowpass;
-#endif
 	struct tsf_voice_lfo modlfo, viblfo;
 };
 
@@ -643,9 +730,48 @@ static inline fixed16p16 tsf_decibelsToGainF16P16(fixed16p16 db) { return tsf_in
 static inline fixed16p16 tsf_gainToDecibelsF16P16(fixed16p16 gain) { return tsf_interpolate_16p16(gain, tsf_gain2db_in, tsf_gain2db_out, tsf_gain2db_inv, tsf_gain2db_sz); }
 // Valid from 0...0.5 only since that's the max PAN will use it
 static inline fixed16p16 tsf_sqrtF16P16(fixed16p16 v) { return tsf_interpolate_16p16(v, tsf_sqrtf_in, tsf_sqrtf_out, tsf_sqrtf_inv, tsf_sqrtf_sz); }
+
+// 2^(-i/64) and tan(pi*i/256) for i = 0...64
+static const fixed2p30 tsf_exp2neg_tab[] PROGMEM = {1073741824, 1062175491, 1050733751, 1039415261, 1028218693, 1017142735, 1006186087, 995347464, 984625594, 974019220, 963527098, 953147997, 942880699, 932724001, 922676710, 912737649, 902905651, 893179563, 883558244, 874040567, 864625413, 855311680, 846098274, 836984114, 827968132, 819049271, 810226483, 801498734, 792865000, 784324269, 775875538, 767517817, 759250125, 751071493, 742980960, 734977579, 727060411, 719228525, 711481005, 703816941, 696235434, 688735596, 681316545, 673977412, 666717336, 659535466, 652430958, 645402981, 638450708, 631573326, 624770026, 618040012, 611382493, 604796689, 598281827, 591837143, 585461881, 579155293, 572916640, 566745190, 560640218, 554601009, 548626854, 542717053, 536870912, };
+#ifndef TSF_NO_LOWPASS
+static const fixed2p30 tsf_tanpi_tab[] PROGMEM = {0, 13177456, 26358882, 39548253, 52749553, 65966781, 79203955, 92465117, 105754339, 119075726, 132433423, 145831619, 159274554, 172766522, 186311880, 199915050, 213580528, 227312888, 241116790, 254996985, 268958326, 283005767, 297144381, 311379359, 325716021, 340159828, 354716385, 369391456, 384190968, 399121027, 414187927, 429398159, 444758426, 460275657, 475957016, 491809923, 507842061, 524061402, 540476215, 557095091, 573926962, 590981117, 608267230, 625795381, 643576082, 661620305, 679939511, 698545681, 717451349, 736669642, 756214313, 776099788, 796341210, 816954487, 837956344, 859364383, 881197142, 903474163, 926216067, 949444628, 973182862, 997455123, 1022287200, 1047706430, 1073741824, };
 #endif
+#define TSF_LOG2E_F8P24 24204406        // 1/ln(2), to turn natural logs into 8.24 log2s
+#define TSF_OCTAVES_PER_CENT_F16P16 3579139 // 2^32/1200, 24.8 cents * this >> 16 = 8.24 octaves
 
-#ifndef TSF_CONST_FILE
+// 2^x for x <= 0
+static fixed2p30 tsf_exp2F2P30(fixed8p24 x)
+{
+	if (x >= 0) return 1 << 30;
+	if (x <= -(30 << 24)) return 0;
+	unsigned int neg = -x, i = (neg >> 18) & 63, rem = neg & 0x3ffff;
+	fixed2p30 a = tsf_exp2neg_tab[i], b = tsf_exp2neg_tab[i + 1];
+	return (a - (fixed2p30)(((int64_t)(a - b) * rem) >> 18)) >> (neg >> 24);
+}
+
+#ifndef TSF_NO_LOWPASS
+// tan(pi * x) for x in 0...0.25
+static fixed2p30 tsf_tanpiF2P30(fixed2p30 x)
+{
+	unsigned int i = x >> 22, rem = x & 0x3fffff;
+	if (i >= 64) return tsf_tanpi_tab[64];
+	fixed2p30 a = tsf_tanpi_tab[i], b = tsf_tanpi_tab[i + 1];
+	return a + (fixed2p30)(((int64_t)(b - a) * rem) >> 22);
+}
+#endif
+
+// ratio * 2^(cents/1200)
+static fixed16p16 tsf_pitchshiftF16P16(fixed16p16 ratio, fixed24p8 cents)
+{
+	fixed8p24 octaves = (fixed8p24)(((int64_t)cents * TSF_OCTAVES_PER_CENT_F16P16) >> 16);
+	int whole = (octaves + (1 << 24) - 1) >> 24;
+	if (whole > 14) whole = 14;
+	else if (whole < -30) return 0;
+	return (fixed16p16)(((int64_t)ratio * tsf_exp2F2P30(octaves - whole * (1 << 24))) >> (30 - whole));
+}
+#endif
+
+#ifdef TSF_LOADER
 static TSF_BOOL tsf_riffchunk_read(struct tsf_riffchunk* parent, struct tsf_riffchunk* chunk, struct tsf_stream* stream)
 {
 	TSF_BOOL IsRiff, IsList;
@@ -853,7 +979,7 @@ static void tsf_region_operator(struct tsf_region* region, tsf_u16 genOper, unio
 }
 #endif
 
-#ifndef TSF_CONST_FILE
+#ifdef TSF_LOADER
 static void tsf_region_envtosecs(struct tsf_envelope* p, TSF_BOOL sustainIsGain)
 {
 	// EG times need to be converted from timecents to seconds.
@@ -873,22 +999,45 @@ static void tsf_region_envtosecs(struct tsf_envelope* p, TSF_BOOL sustainIsGain)
 	else p->sustain = 1.0f - (p->sustain / 1000.0f);
 }
 
+// Without one, every note-on tests every region of the preset.  A failed allocation just leaves it that way.
+static tsf_u32* tsf_preset_key_spans(const struct tsf_region* regions, int regionNum)
+{
+	tsf_u32* spans;
+	int key, i;
+	if (regionNum > 255) return TSF_NULL;
+	spans = (tsf_u32*)TSF_MALLOC(64 * sizeof(tsf_u32));
+	if (!spans) return TSF_NULL;
+	for (key = 0; key != 128; key++)
+	{
+		tsf_u32 first = 0, end = 0;
+		for (i = 0; i != regionNum; i++)
+			if (key >= (int)regions[i].lokey && key <= (int)regions[i].hikey) { if (!end) first = i; end = i + 1; }
+		if (key & 1) spans[key >> 1] |= (first | (end << 8)) << 16;
+		else spans[key >> 1] = first | (end << 8);
+	}
+	return spans;
+}
+
 static int tsf_load_presets(tsf* res, struct tsf_hydra *hydra, unsigned int fontSampleCount)
 {
 	enum { GenInstrument = 41, GenKeyRange = 43, GenVelRange = 44, GenSampleID = 53 };
 	// Read each preset.
 	struct tsf_hydra_phdr *pphdr, *pphdrMax;
+	struct tsf_preset* presets; // filled in here, even when res->presets is const
+	// The global, preset, instrument and zone regions being merged, off the stack as they're large
+	struct tsf_region* work = (struct tsf_region*)TSF_MALLOC(4 * sizeof(struct tsf_region));
+	struct tsf_region *globalRegion = work, *presetRegion = work + 1, *instRegion = work + 2, *zoneRegion = work + 3;
 	res->presetNum = hydra->phdrNum - 1;
-	res->presets = (struct tsf_preset*)TSF_MALLOC(res->presetNum * sizeof(struct tsf_preset));
-	if (!res->presets) return 0;
-	else { int i; for (i = 0; i != res->presetNum; i++) res->presets[i].regions = TSF_NULL; }
+	res->presets = presets = (struct tsf_preset*)TSF_MALLOC(res->presetNum * sizeof(struct tsf_preset));
+	if (!presets || !work) { TSF_FREE(presets); TSF_FREE(work); res->presets = TSF_NULL; return 0; }
+	else { int i; for (i = 0; i != res->presetNum; i++) { presets[i].regions = TSF_NULL; presets[i].keySpans = TSF_NULL; } }
 	for (pphdr = hydra->phdrs, pphdrMax = pphdr + hydra->phdrNum - 1; pphdr != pphdrMax; pphdr++)
 	{
 		int sortedIndex = 0, region_index = 0;
 		struct tsf_hydra_phdr *otherphdr;
 		struct tsf_preset* preset;
+		struct tsf_region* regions;
 		struct tsf_hydra_pbag *ppbag, *ppbagEnd;
-		struct tsf_region globalRegion;
 		for (otherphdr = hydra->phdrs; otherphdr != pphdrMax; otherphdr++)
 		{
 			if (otherphdr == pphdr || otherphdr->bank > pphdr->bank) continue;
@@ -898,7 +1047,7 @@ static int tsf_load_presets(tsf* res, struct tsf_hydra *hydra, unsigned int font
 			else if (otherphdr < pphdr) sortedIndex++;
 		}
 
-		preset = &res->presets[sortedIndex];
+		preset = &presets[sortedIndex];
 		TSF_MEMCPY(preset->presetName, pphdr->presetName, sizeof(preset->presetName));
 		preset->presetName[sizeof(preset->presetName)-1] = '\0'; //should be zero terminated in source file but make sure
 		preset->bank = pphdr->bank;
@@ -930,20 +1079,21 @@ static int tsf_load_presets(tsf* res, struct tsf_hydra *hydra, unsigned int font
 			}
 		}
 
-		preset->regions = (struct tsf_region*)TSF_MALLOC(preset->regionNum * sizeof(struct tsf_region));
-		if (!preset->regions)
+		preset->regions = regions = (struct tsf_region*)TSF_MALLOC(preset->regionNum * sizeof(struct tsf_region));
+		if (!regions)
 		{
-			int i; for (i = 0; i != res->presetNum; i++) TSF_FREE(res->presets[i].regions);
-			TSF_FREE(res->presets);
+			int i; for (i = 0; i != res->presetNum; i++) { TSF_FREE((void*)presets[i].regions); TSF_FREE((void*)presets[i].keySpans); }
+			TSF_FREE(presets);
+			TSF_FREE(work);
 			return 0;
 		}
-		tsf_region_clear(&globalRegion, TSF_TRUE);
+		tsf_region_clear(globalRegion, TSF_TRUE);
 
 		// Zones.
 		for (ppbag = hydra->pbags + pphdr->presetBagNdx, ppbagEnd = hydra->pbags + pphdr[1].presetBagNdx; ppbag != ppbagEnd; ppbag++)
 		{
 			struct tsf_hydra_pgen *ppgen, *ppgenEnd; struct tsf_hydra_inst *pinst; struct tsf_hydra_ibag *pibag, *pibagEnd; struct tsf_hydra_igen *pigen, *pigenEnd;
-			struct tsf_region presetRegion = globalRegion;
+			*presetRegion = *globalRegion;
 			int hadGenInstrument = 0;
 
 			// Generators.
@@ -952,16 +1102,15 @@ static int tsf_load_presets(tsf* res, struct tsf_hydra *hydra, unsigned int font
 				// Instrument.
 				if (ppgen->genOper == GenInstrument)
 				{
-					struct tsf_region instRegion;
 					tsf_u16 whichInst = ppgen->genAmount.wordAmount;
 					if (whichInst >= hydra->instNum) continue;
 
-					tsf_region_clear(&instRegion, TSF_FALSE);
+					tsf_region_clear(instRegion, TSF_FALSE);
 					pinst = &hydra->insts[whichInst];
 					for (pibag = hydra->ibags + pinst->instBagNdx, pibagEnd = hydra->ibags + pinst[1].instBagNdx; pibag != pibagEnd; pibag++)
 					{
 						// Generators.
-						struct tsf_region zoneRegion = instRegion;
+						*zoneRegion = *instRegion;
 						int hadSampleID = 0;
 						for (pigen = hydra->igens + pibag->instGenNdx, pigenEnd = hydra->igens + pibag[1].instGenNdx; pigen != pigenEnd; pigen++)
 						{
@@ -970,55 +1119,59 @@ static int tsf_load_presets(tsf* res, struct tsf_hydra *hydra, unsigned int font
 								struct tsf_hydra_shdr* pshdr;
 
 								//preset region key and vel ranges are a filter for the zone regions
-								if (zoneRegion.hikey < presetRegion.lokey || zoneRegion.lokey > presetRegion.hikey) continue;
-								if (zoneRegion.hivel < presetRegion.lovel || zoneRegion.lovel > presetRegion.hivel) continue;
-								if (presetRegion.lokey > zoneRegion.lokey) zoneRegion.lokey = presetRegion.lokey;
-								if (presetRegion.hikey < zoneRegion.hikey) zoneRegion.hikey = presetRegion.hikey;
-								if (presetRegion.lovel > zoneRegion.lovel) zoneRegion.lovel = presetRegion.lovel;
-								if (presetRegion.hivel < zoneRegion.hivel) zoneRegion.hivel = presetRegion.hivel;
+								if (zoneRegion->hikey < presetRegion->lokey || zoneRegion->lokey > presetRegion->hikey) continue;
+								if (zoneRegion->hivel < presetRegion->lovel || zoneRegion->lovel > presetRegion->hivel) continue;
+								if (presetRegion->lokey > zoneRegion->lokey) zoneRegion->lokey = presetRegion->lokey;
+								if (presetRegion->hikey < zoneRegion->hikey) zoneRegion->hikey = presetRegion->hikey;
+								if (presetRegion->lovel > zoneRegion->lovel) zoneRegion->lovel = presetRegion->lovel;
+								if (presetRegion->hivel < zoneRegion->hivel) zoneRegion->hivel = presetRegion->hivel;
 
 								//sum regions
-								tsf_region_operator(&zoneRegion, 0, TSF_NULL, &presetRegion);
+								tsf_region_operator(zoneRegion, 0, TSF_NULL, presetRegion);
 
 								// EG times need to be converted from timecents to seconds.
-								tsf_region_envtosecs(&zoneRegion.ampenv, TSF_TRUE);
-								tsf_region_envtosecs(&zoneRegion.modenv, TSF_FALSE);
+								tsf_region_envtosecs(&zoneRegion->ampenv, TSF_TRUE);
+								tsf_region_envtosecs(&zoneRegion->modenv, TSF_FALSE);
 
 								// LFO times need to be converted from timecents to seconds.
-								zoneRegion.delayModLFO = (zoneRegion.delayModLFO < -11950.0f ? 0.0f : tsf_timecents2Secsf(zoneRegion.delayModLFO));
-								zoneRegion.delayVibLFO = (zoneRegion.delayVibLFO < -11950.0f ? 0.0f : tsf_timecents2Secsf(zoneRegion.delayVibLFO));
+								zoneRegion->delayModLFO = (zoneRegion->delayModLFO < -11950.0f ? 0.0f : tsf_timecents2Secsf(zoneRegion->delayModLFO));
+								zoneRegion->delayVibLFO = (zoneRegion->delayVibLFO < -11950.0f ? 0.0f : tsf_timecents2Secsf(zoneRegion->delayVibLFO));
 
 								// Fixup sample positions
 								pshdr = &hydra->shdrs[pigen->genAmount.wordAmount];
-								zoneRegion.offset += pshdr->start;
-								zoneRegion.end += pshdr->end;
-								zoneRegion.loop_start += pshdr->startLoop;
-								zoneRegion.loop_end += pshdr->endLoop;
-								if (pshdr->endLoop > 0) zoneRegion.loop_end -= 1;
-								if (zoneRegion.loop_end > fontSampleCount) zoneRegion.loop_end = fontSampleCount;
-								if (zoneRegion.pitch_keycenter == -1) zoneRegion.pitch_keycenter = pshdr->originalPitch;
-								zoneRegion.tune += pshdr->pitchCorrection;
-								zoneRegion.sample_rate = pshdr->sampleRate;
-								if (zoneRegion.end && zoneRegion.end < fontSampleCount) zoneRegion.end++;
-								else zoneRegion.end = fontSampleCount;
-
-								preset->regions[region_index] = zoneRegion;
+								zoneRegion->offset += pshdr->start;
+								zoneRegion->end += pshdr->end;
+								zoneRegion->loop_start += pshdr->startLoop;
+								zoneRegion->loop_end += pshdr->endLoop;
+								if (pshdr->endLoop > 0) zoneRegion->loop_end -= 1;
+								if (zoneRegion->loop_end > fontSampleCount) zoneRegion->loop_end = fontSampleCount;
+								if (zoneRegion->pitch_keycenter == -1) zoneRegion->pitch_keycenter = pshdr->originalPitch;
+								zoneRegion->tune += pshdr->pitchCorrection;
+								zoneRegion->sample_rate = pshdr->sampleRate;
+								if (zoneRegion->end && zoneRegion->end < fontSampleCount) zoneRegion->end++;
+								else zoneRegion->end = fontSampleCount;
+
+#ifdef TSF_SAMPLES_SHORT
+								zoneRegion->attenuationF16P16 = (fixed16p16)(zoneRegion->attenuation * 65536.0f);
+								zoneRegion->panF16P16 = (fixed16p16)(zoneRegion->pan * 65536.0f);
+#endif
+								regions[region_index] = *zoneRegion;
 								region_index++;
 								hadSampleID = 1;
 							}
-							else tsf_region_operator(&zoneRegion, pigen->genOper, &pigen->genAmount, TSF_NULL);
+							else tsf_region_operator(zoneRegion, pigen->genOper, &pigen->genAmount, TSF_NULL);
 						}
 
 						// Handle instrument's global zone.
 						if (pibag == hydra->ibags + pinst->instBagNdx && !hadSampleID)
-							instRegion = zoneRegion;
+							*instRegion = *zoneRegion;
 
 						// Modulators (TODO)
 						//if (ibag->instModNdx < ibag[1].instModNdx) addUnsupportedOpcode("any modulator");
 					}
 					hadGenInstrument = 1;
 				}
-				else tsf_region_operator(&presetRegion, ppgen->genOper, &ppgen->genAmount, TSF_NULL);
+				else tsf_region_operator(presetRegion, ppgen->genOper, &ppgen->genAmount, TSF_NULL);
 			}
 
 			// Modulators (TODO)
@@ -1026,9 +1179,11 @@ static int tsf_load_presets(tsf* res, struct tsf_hydra *hydra, unsigned int font
 
 			// Handle preset's global zone.
 			if (ppbag == hydra->pbags + pphdr->presetBagNdx && !hadGenInstrument)
-				globalRegion = presetRegion;
+				*globalRegion = *presetRegion;
 		}
+		preset->keySpans = tsf_preset_key_spans(regions, region_index);
 	}
+	TSF_FREE(work);
 	return 1;
 }
 #endif
@@ -1180,6 +1335,19 @@ static int tsf_voice_envelope_release_samples(struct tsf_voice_envelope* e, floa
 	return (int)((e->parameters.release <= 0 ? TSF_FASTRELEASETIME : e->parameters.release) * outSampleRate);
 }
 
+#ifndef TSF_SAMPLES_SHORT
+static void tsf_voice_envelope_set(struct tsf_voice_envelope* e, float level, float slope) { e->level = level; e->slope = slope; }
+static float tsf_voice_envelope_level(const struct tsf_voice_envelope* e) { return e->level; }
+#else
+static void tsf_voice_envelope_set(struct tsf_voice_envelope* e, float level, float slope)
+{
+	e->levelF2P30 = (fixed2p30)(level * 1073741824.0f);
+	e->slopeF2P30 = (e->segmentIsExponential ? 0 : (fixed2p30)(slope * 1073741824.0f));
+	e->log2slopeF8P24 = (e->segmentIsExponential ? (fixed8p24)(TSF_LOG(slope) * TSF_LOG2E_F8P24) : 0);
+}
+static float tsf_voice_envelope_level(const struct tsf_voice_envelope* e) { return e->levelF2P30 * (1.0f / 1073741824.0f); }
+#endif
+
 static void tsf_voice_envelope_nextsegment(struct tsf_voice_envelope* e, short active_segment, float outSampleRate)
 {
 	switch (active_segment)
@@ -1190,8 +1358,7 @@ static void tsf_voice_envelope_nextsegment(struct tsf_voice_envelope* e, short a
 			{
 				e->segment = TSF_SEGMENT_DELAY;
 				e->segmentIsExponential = TSF_FALSE;
-				e->level = 0.0f;
-				e->slope = 0.0f;
+				tsf_voice_envelope_set(e, 0.0f, 0.0f);
 				return;
 			}
 			/* fall through */
@@ -1206,8 +1373,7 @@ static void tsf_voice_envelope_nextsegment(struct tsf_voice_envelope* e, short a
 				}
 				e->segment = TSF_SEGMENT_ATTACK;
 				e->segmentIsExponential = TSF_FALSE;
-				e->level = 0.0f;
-				e->slope = 1.0f / e->samplesUntilNextSegment;
+				tsf_voice_envelope_set(e, 0.0f, 1.0f / e->samplesUntilNextSegment);
 				return;
 			}
 			/* fall through */
@@ -1217,8 +1383,7 @@ static void tsf_voice_envelope_nextsegment(struct tsf_voice_envelope* e, short a
 			{
 				e->segment = TSF_SEGMENT_HOLD;
 				e->segmentIsExponential = TSF_FALSE;
-				e->level = 1.0f;
-				e->slope = 0.0f;
+				tsf_voice_envelope_set(e, 1.0f, 0.0f);
 				return;
 			}
 			/* fall through */
@@ -1227,13 +1392,12 @@ static void tsf_voice_envelope_nextsegment(struct tsf_voice_envelope* e, short a
 			if (e->samplesUntilNextSegment > 0)
 			{
 				e->segment = TSF_SEGMENT_DECAY;
-				e->level = 1.0f;
 				if (e->isAmpEnv)
 				{
 					// I don't truly understand this; just following what LinuxSampler does.
 					float mysterySlope = -9.226f / e->samplesUntilNextSegment;
-					e->slope = TSF_EXPF(mysterySlope);
 					e->segmentIsExponential = TSF_TRUE;
+					tsf_voice_envelope_set(e, 1.0f, TSF_EXPF(mysterySlope));
 					if (e->parameters.sustain > 0.0f)
 					{
 						// Again, this is following LinuxSampler's example, which is similar to
@@ -1246,19 +1410,18 @@ static void tsf_voice_envelope_nextsegment(struct tsf_voice_envelope* e, short a
 				}
 				else
 				{
-					e->slope = -1.0f / e->samplesUntilNextSegment;
-					e->samplesUntilNextSegment = (int)(e->parameters.decay * (1.0f - e->parameters.sustain) * outSampleRate);
 					e->segmentIsExponential = TSF_FALSE;
+					tsf_voice_envelope_set(e, 1.0f, -1.0f / e->samplesUntilNextSegment);
+					e->samplesUntilNextSegment = (int)(e->parameters.decay * (1.0f - e->parameters.sustain) * outSampleRate);
 				}
 				return;
 			}
 			/* fall through */
 		case TSF_SEGMENT_DECAY:
 			e->segment = TSF_SEGMENT_SUSTAIN;
-			e->level = e->parameters.sustain;
-			e->slope = 0.0f;
 			e->samplesUntilNextSegment = 0x7FFFFFFF;
 			e->segmentIsExponential = TSF_FALSE;
+			tsf_voice_envelope_set(e, e->parameters.sustain, 0.0f);
 			return;
 		case TSF_SEGMENT_SUSTAIN:
 			e->segment = TSF_SEGMENT_RELEASE;
@@ -1267,20 +1430,20 @@ static void tsf_voice_envelope_nextsegment(struct tsf_voice_envelope* e, short a
 			{
 				// I don't truly understand this; just following what LinuxSampler does.
 				float mysterySlope = -9.226f / e->samplesUntilNextSegment;
-				e->slope = TSF_EXPF(mysterySlope);
 				e->segmentIsExponential = TSF_TRUE;
+				tsf_voice_envelope_set(e, tsf_voice_envelope_level(e), TSF_EXPF(mysterySlope));
 			}
 			else
 			{
-				e->slope = -e->level / e->samplesUntilNextSegment;
 				e->segmentIsExponential = TSF_FALSE;
+				tsf_voice_envelope_set(e, tsf_voice_envelope_level(e), -tsf_voice_envelope_level(e) / e->samplesUntilNextSegment);
 			}
 			return;
 		case TSF_SEGMENT_RELEASE:
 		default:
 			e->segment = TSF_SEGMENT_DONE;
 			e->segmentIsExponential = TSF_FALSE;
-			e->level = e->slope = 0.0f;
+			tsf_voice_envelope_set(e, 0.0f, 0.0f);
 			e->samplesUntilNextSegment = 0x7FFFFFF;
 	}
 }
@@ -1305,11 +1468,25 @@ static void tsf_voice_envelope_setup(struct tsf_voice_envelope* e, const struct
 
 static void tsf_voice_envelope_process(struct tsf_voice_envelope* e, int numSamples, float outSampleRate)
 {
+#ifndef TSF_SAMPLES_SHORT
 	if (e->slope)
 	{
 		if (e->segmentIsExponential) e->level *= TSF_POWF(e->slope, (float)numSamples);
 		else e->level += (e->slope * numSamples);
 	}
+#else
+	if (e->log2slopeF8P24)
+	{
+		int64_t log2gain = (int64_t)e->log2slopeF8P24 * numSamples;
+		e->levelF2P30 = (log2gain <= -(30 << 24) ? 0 : (fixed2p30)(((int64_t)e->levelF2P30 * tsf_exp2F2P30((fixed8p24)log2gain)) >> 30));
+	}
+	else if (e->slopeF2P30)
+	{
+		// Can overshoot within the last block of a segment, but the next segment sets its own level
+		int64_t level = e->levelF2P30 + (int64_t)e->slopeF2P30 * numSamples;
+		e->levelF2P30 = (level < 0 ? 0 : (level > 0x7fffffff ? 0x7fffffff : (fixed2p30)level));
+	}
+#endif
 	if ((e->samplesUntilNextSegment -= numSamples) <= 0)
 		tsf_voice_envelope_nextsegment(e, e->segment, outSampleRate);
 }
@@ -1329,6 +1506,40 @@ static float tsf_voice_lowpass_process(struct tsf_voice_lowpass* e, double In)
 {
 	double Out = In * e->a0 + e->z1; e->z1 = In * e->a1 + e->z2 - e->b1 * Out; e->z2 = In * e->a0 - e->b2 * Out; return (float)Out;
 }
+#else
+#ifndef TSF_NO_LOWPASS
+static void tsf_voice_lowpass_setup(struct tsf_voice_lowpass* e, fixed2p30 Fc)
+{
+	// The same response as the float biquad.  With g = tan(pi * Fc) and k = 1 / Q, a1 = 1 / (1 + g * (g + k)),
+	// a2 = g * a1 and a3 = g * a2.  g is kept as n / d so that n and d stay within 0...1, and every term is
+	// scaled by d^2.  b1 = 1 - a1 is stored in place of a1, so a1's rounding isn't multiplied by the whole state.
+	fixed2p30 n = 1 << 30, d = 1 << 30, nn, dd, nd, ndk;
+	int64_t den;
+	if (Fc <= (1 << 28)) n = tsf_tanpiF2P30(Fc);
+	else d = tsf_tanpiF2P30((1 << 29) - Fc);
+	nn = (fixed2p30)(((int64_t)n * n) >> 30);
+	dd = (fixed2p30)(((int64_t)d * d) >> 30);
+	nd = (fixed2p30)(((int64_t)n * d) >> 30);
+	ndk = (fixed2p30)(((int64_t)nd * e->QInvF2P30) >> 30);
+	den = (int64_t)dd + ndk + nn;
+	e->b1F17P15 = (fixed17p15)((((int64_t)ndk + nn) << 15) / den);
+	e->a2F17P15 = (fixed17p15)(((int64_t)nd << 15) / den);
+	e->a3F17P15 = (fixed17p15)(((int64_t)nn << 15) / den);
+}
+#endif
+
+// Cutoff in cents, with the same limits as the float version
+static void tsf_voice_lowpass_cutoff(struct tsf_voice_lowpass* e, fixed24p8 cents)
+{
+#ifdef TSF_NO_LOWPASS
+	(void)cents;
+	e->active = TSF_FALSE;
+#else
+	fixed8p24 log2Fc = e->log2FcScaleF8P24 + (fixed8p24)(((int64_t)cents * TSF_OCTAVES_PER_CENT_F16P16) >> 16);
+	e->active = (cents <= (13500 << 8) && log2Fc < -16825673 /* log2(0.499) */);
+	if (e->active) tsf_voice_lowpass_setup(e, tsf_exp2F2P30(log2Fc));
+#endif
+}
 #endif
 static void tsf_voice_lfo_setup(struct tsf_voice_lfo* e, float delay, int freqCents, float outSampleRate)
 {
@@ -1410,6 +1621,7 @@ static void tsf_voice_calcpitchratio(struct tsf_voice* v, float pitchShift, floa
 	if (pitchShift) adjustedPitch += pitchShift;
 	v->pitchInputTimecents = adjustedPitch * 100.0f;
 	v->pitchOutputFactor = v->region->sample_rate / (tsf_timecents2Secsd(v->region->pitch_keycenter * 100.0f) * outSampleRate);
+	v->pitchRatioF16P16 = (fixed16p16)(65536.0f * tsf_timecents2Secsd(v->pitchInputTimecents) * v->pitchOutputFactor);
 #endif
 }
 
@@ -1555,7 +1767,111 @@ static void tsf_voice_render(tsf* f, struct tsf_voice* v, float* outputBuffer, i
 	if (tmpLowpass.active || dynamicLowpass) v->lowpass = tmpLowpass;
 }
 #else
-static void tsf_voice_render_short(tsf* f, struct tsf_voice* v, int32_t* outputBuffer, int numSamples)
+#ifdef TSF_STREAMED
+// Returns the samples of one chunk, reading it into the least recently used slot if it isn't cached
+static TSF_CONST short* tsf_sample_cache_get(struct tsf_sample_cache* c, tsf_u32 chunk)
+{
+	int slot = c->chunkSlot[chunk];
+	if (slot >= 0) c->hits++;
+	else
+	{
+		tsf_u32 i, want, got = 0;
+		short* data;
+		int r;
+		for (slot = 0, i = 1; i < c->slotNum; i++) if (c->slotUsed[i] < c->slotUsed[slot]) slot = (int)i;
+		if (c->slotChunk[slot] >= 0) c->chunkSlot[c->slotChunk[slot]] = -1;
+		c->slotChunk[slot] = (int)chunk;
+		c->chunkSlot[chunk] = (short)slot;
+		data = c->slots + slot * TSF_SAMPLE_CHUNK;
+		want = c->samplesNum - chunk * TSF_SAMPLE_CHUNK;
+		if (want > TSF_SAMPLE_CHUNK) want = TSF_SAMPLE_CHUNK;
+		want *= sizeof(short);
+		if (c->stream.seek(c->stream.data, c->smplOffset + chunk * TSF_SAMPLE_CHUNK * sizeof(short)))
+			while (got < want && (r = c->stream.read(c->stream.data, (char*)data + got, want - got)) > 0) got += r;
+		// A short read plays as silence rather than stale data
+		TSF_MEMSET((char*)data + got, 0, TSF_SAMPLE_CHUNK * sizeof(short) - got);
+		c->misses++;
+	}
+	c->slotUsed[slot] = ++c->useCount;
+	return c->slots + slot * TSF_SAMPLE_CHUNK;
+}
+#endif
+
+// Saturates the 32-bit mix down to samples.  May be done in place, as each short only overwrites a long already read.
+static void tsf_pack_short(short* pack, const int32_t* mix, int count)
+{
+	for (int i = 0; i < count; i++)
+	{
+		int32_t t = mix[i];
+		t = (t < -32768 ? -32768 : t);
+		t = (t > 32767 ? 32767 : t);
+		pack[i] = (short)t;
+	}
+}
+
+// Adds one straight run of a voice (no loop or end crossing) to the mix.  Without the filter the loops are
+// branch free so the compiler can vectorize them, and the last voice of a block saturates straight into pack.
+static void tsf_voice_mix_short(TSF_CONST short* input, fixed24p8 pos, fixed24p8 step, int run, fixed16p16 gainLeftF16P16, fixed16p16 gainRightF16P16,
+                                int32_t* outL, short* pack, struct tsf_voice_lowpass* lowpass)
+{
+#ifdef ESP8266
+#define TSF_INPUT(p) ((int32_t)(short)pgm_read_word(&input[(p) >> 8]))
+#else
+#define TSF_INPUT(p) ((int32_t)input[(p) >> 8])
+#endif
+	int i;
+	if (lowpass)
+	{
+		// The filter's recursion keeps this one sample at a time anyway.  The states are narrowed to 15 bits
+		// before they meet a coefficient, and held within twice the sample range so resonance can't wrap around.
+		fixed17p15 b1 = lowpass->b1F17P15, a2 = lowpass->a2F17P15, a3 = lowpass->a3F17P15;
+		fixed28p4 ic1 = lowpass->ic1F28P4, ic2 = lowpass->ic2F28P4, v1, v2, v3;
+		for (i = 0; i < run; i++)
+		{
+			int32_t val;
+			v3 = TSF_INPUT(pos + i * step) * 16 - ic2;
+			v1 = ic1 + ((a2 * (v3 >> 6) - b1 * (ic1 >> 6)) >> 9);
+			v2 = ic2 + ((a2 * (ic1 >> 6) + a3 * (v3 >> 6)) >> 9);
+			ic1 = 2 * v1 - ic1; ic1 = (ic1 < -(65536 << 4) ? -(65536 << 4) : ic1); ic1 = (ic1 > (65535 << 4) ? (65535 << 4) : ic1);
+			ic2 = 2 * v2 - ic2; ic2 = (ic2 < -(65536 << 4) ? -(65536 << 4) : ic2); ic2 = (ic2 > (65535 << 4) ? (65535 << 4) : ic2);
+			val = v2 >> 4; val = (val < -32768 ? -32768 : val); val = (val > 32767 ? 32767 : val);
+			int32_t l = outL[i * 2] + ((val * gainLeftF16P16) >> 16), r = outL[i * 2 + 1] + ((val * gainRightF16P16) >> 16);
+			if (pack)
+			{
+				l = (l < -32768 ? -32768 : l); l = (l > 32767 ? 32767 : l);
+				r = (r < -32768 ? -32768 : r); r = (r > 32767 ? 32767 : r);
+				pack[i * 2] = (short)l; pack[i * 2 + 1] = (short)r;
+			}
+			else { outL[i * 2] = l; outL[i * 2 + 1] = r; }
+		}
+		lowpass->ic1F28P4 = ic1; lowpass->ic2F28P4 = ic2;
+	}
+	else if (pack)
+	{
+		for (i = 0; i < run; i++)
+		{
+			int32_t val = TSF_INPUT(pos + i * step);
+			int32_t l = outL[i * 2] + ((val * gainLeftF16P16) >> 16), r = outL[i * 2 + 1] + ((val * gainRightF16P16) >> 16);
+			l = (l < -32768 ? -32768 : l); l = (l > 32767 ? 32767 : l);
+			r = (r < -32768 ? -32768 : r); r = (r > 32767 ? 32767 : r);
+			pack[i * 2] = (short)l; pack[i * 2 + 1] = (short)r;
+		}
+	}
+	else
+	{
+		// No clipping here because it eats 20% of the performance on the M0+ Pico!
+		for (i = 0; i < run; i++)
+		{
+			int32_t val = TSF_INPUT(pos + i * step);
+			outL[i * 2] += (val * gainLeftF16P16) >> 16;
+			outL[i * 2 + 1] += (val * gainRightF16P16) >> 16;
+		}
+	}
+#undef TSF_INPUT
+}
+
+// When pack is set this is the last voice of the block, and it leaves the block as saturated shorts in pack
+static void tsf_voice_render_short(tsf* f, struct tsf_voice* v, int32_t* outputBuffer, int numSamples, short* pack)
 {
 #ifdef ESP8266
     static unsigned int smps = 0;
@@ -1567,7 +1883,7 @@ static void tsf_voice_render_short(tsf* f, struct tsf_voice* v, int32_t* outputB
 	TSF_CONST struct tsf_region* region = v->region;
         TSF_CONST short* input = f->shortSamples;
 	int32_t* outL = outputBuffer;
-	//short* outR = (f->outputmode == TSF_STEREO_UNWEAVED ? outL + numSamples : TSF_NULL);
+	int32_t* outEnd = outputBuffer + numSamples * 2;
 
 	// Cache some values, to give them at least some chance of ending up in registers.
 	TSF_BOOL updateModEnv = (region->modEnvToPitch || region->modEnvToFilterFc);
@@ -1575,62 +1891,56 @@ static void tsf_voice_render_short(tsf* f, struct tsf_voice* v, int32_t* outputB
 	TSF_BOOL updateVibLFO = (v->viblfo.deltaF16P16 && (region->vibLfoToPitch));
 	TSF_BOOL isLooping    = (v->loopStart < v->loopEnd);
         fixed24p8 tmpLoopStartF24P8 = v->loopStart << 8;
-//        fixed24p8 tmpLoopEndF24P8 = v->loopEnd << 8;
-//	unsigned int tmpLoopStart = v->loopStart, tmpLoopEnd = v->loopEnd;
         fixed24p8 tmpSampleEndF24P8 = region->end << 8;
         fixed24p8 tmpLoopEndF24P8 = (v->loopEnd + 1) << 8;
-//	double tmpSampleEndDbl = (double)region->end, tmpLoopEndDbl = (double)tmpLoopEnd + 1.0;
         fixed24p8 tmpSourceSamplePositionF24P8 = v->sourceSamplePositionF24P8;
-//	double tmpSourceSamplePosition = v->sourceSamplePosition;
-	//struct tsf_voice_lowpass tmpLowpass = v->lowpass;
+	struct tsf_voice_lowpass tmpLowpass = v->lowpass;
 
-//	TSF_BOOL dynamicLowpass = (region->modLfoToFilterFc || region->modEnvToFilterFc);
-	float tmpSampleRate = f->outSampleRate; //, tmpInitialFilterFc, tmpModLfoToFilterFc, tmpModEnvToFilterFc;
+	TSF_BOOL dynamicLowpass = (region->modLfoToFilterFc || region->modEnvToFilterFc);
+	float tmpSampleRate = f->outSampleRate;
 
 	TSF_BOOL dynamicPitchRatio = (region->modLfoToPitch || region->modEnvToPitch || region->vibLfoToPitch);
-
-        fixed16p16 pitchRatioF16P16;
-//	double pitchRatio;
-	float tmpModLfoToPitchD16, tmpVibLfoToPitchD16, tmpModEnvToPitchD16;
+        fixed16p16 pitchRatioF16P16 = v->pitchRatioF16P16;
 
 	TSF_BOOL dynamicGain = (region->modLfoToVolume != 0);
-	float noteGain = 0, tmpModLfoToVolumeD16;
-
-//	if (dynamicLowpass) tmpInitialFilterFc = (float)region->initialFilterFc, tmpModLfoToFilterFc = (float)region->modLfoToFilterFc, tmpModEnvToFilterFc = (float)region->modEnvToFilterFc;
-//	else tmpInitialFilterFc = 0, tmpModLfoToFilterFc = 0, tmpModEnvToFilterFc = 0;
-
-	if (dynamicPitchRatio) pitchRatioF16P16 = 0, tmpModLfoToPitchD16 = (float)region->modLfoToPitch * (1.0f / 65536.0f), tmpVibLfoToPitchD16 = (float)region->vibLfoToPitch * (1.0f / 65536.0f), tmpModEnvToPitchD16 = (float)region->modEnvToPitch * (1.0f / 65536.0f);
-	else pitchRatioF16P16 = 65536.0f * tsf_timecents2Secsd(v->pitchInputTimecents) * v->pitchOutputFactor, tmpModLfoToPitchD16 = 0, tmpVibLfoToPitchD16 = 0, tmpModEnvToPitchD16 = 0;
-
-	if (dynamicGain) tmpModLfoToVolumeD16 = (float)region->modLfoToVolume * 0.1f * (1.0f / 65536.0f);
-	else noteGain = tsf_decibelsToGain(v->noteGainDB), tmpModLfoToVolumeD16 = 0;
+        fixed16p16 noteGainDBF16P16 = (fixed16p16)(v->noteGainDB * 65536.0f);
+        fixed16p16 noteGainF16P16 = tsf_decibelsToGainF16P16(noteGainDBF16P16);
 
+	// Everything below runs once per effect block in fixed point.  Modulator levels are 16.16 (LFOs)
+	// or 2.30 (envelopes) and the depths are whole cents, so each product lands in 24.8 cents.
 	while (numSamples)
 	{
-//		float gainMono, gainLeft, gainRight;
-                fixed16p16 gainMonoF16P16, gainLeftF16P16, gainRightF16P16;
+                fixed16p16 gainMonoF16P16, gainLeftF16P16, gainRightF16P16, gainRampF16P16 = 0;
 		int blockSamples = (numSamples > TSF_RENDER_EFFECTSAMPLEBLOCK ? TSF_RENDER_EFFECTSAMPLEBLOCK : numSamples);
+		int blockLength = blockSamples;
+		TSF_BOOL attacking = (v->ampenv.segment == TSF_SEGMENT_ATTACK);
 		numSamples -= blockSamples;
 
-//		if (dynamicLowpass)
-//		{
-//			float fres = tmpInitialFilterFc + v->modlfo.level * tmpModLfoToFilterFc + v->modenv.level * tmpModEnvToFilterFc;
-//			float lowpassFc = (fres <= 13500 ? tsf_cents2Hertz(fres) / tmpSampleRate : 1.0f);
-//			tmpLowpass.active = (lowpassFc < 0.499f);
-//			if (tmpLowpass.active) tsf_voice_lowpass_setup(&tmpLowpass, lowpassFc);
-//		}
+		if (dynamicLowpass)
+		{
+			fixed24p8 fres = region->initialFilterFc * 256 + ((v->modlfo.levelF16P16 * region->modLfoToFilterFc) >> 8) + (((v->modenv.levelF2P30 >> 14) * region->modEnvToFilterFc) >> 8);
+			tsf_voice_lowpass_cutoff(&tmpLowpass, fres);
+		}
 
 		if (dynamicPitchRatio)
-			pitchRatioF16P16 = 65536.0f * tsf_timecents2Secsd(v->pitchInputTimecents + (v->modlfo.levelF16P16 * tmpModLfoToPitchD16 + v->viblfo.levelF16P16 * tmpVibLfoToPitchD16 + v->modenv.level * tmpModEnvToPitchD16)) * v->pitchOutputFactor;
+		{
+			fixed24p8 cents = ((v->modlfo.levelF16P16 * region->modLfoToPitch) >> 8) + ((v->viblfo.levelF16P16 * region->vibLfoToPitch) >> 8) + (((v->modenv.levelF2P30 >> 14) * region->modEnvToPitch) >> 8);
+			pitchRatioF16P16 = tsf_pitchshiftF16P16(v->pitchRatioF16P16, cents);
+		}
 
 		if (dynamicGain)
-			noteGain = tsf_decibelsToGain(v->noteGainDB + (v->modlfo.levelF16P16 * tmpModLfoToVolumeD16));
+			noteGainF16P16 = tsf_decibelsToGainF16P16(noteGainDBF16P16 + v->modlfo.levelF16P16 * region->modLfoToVolume / 10);
 
-//		gainMono = noteGain * v->ampenv.level;
-                gainMonoF16P16 = (noteGain * v->ampenv.level) * 65536.0f;
+                gainMonoF16P16 = (fixed16p16)(((int64_t)noteGainF16P16 * v->ampenv.levelF2P30) >> 30);
 
-		// Update EG.
+		// Update EG.  An attack ramps up across the block rather than stepping at its end, so a note is
+		// heard from the sample it starts on instead of a block later.
 		tsf_voice_envelope_process(&v->ampenv, blockSamples, tmpSampleRate);
+#ifndef TSF_NO_ATTACK_RAMP
+		if (attacking) gainRampF16P16 = (fixed16p16)(((int64_t)noteGainF16P16 * v->ampenv.levelF2P30) >> 30) - gainMonoF16P16;
+#else
+		(void)attacking;
+#endif
 		if (updateModEnv) tsf_voice_envelope_process(&v->modenv, blockSamples, tmpSampleRate);
 
 		// Update LFOs.
@@ -1640,109 +1950,76 @@ static void tsf_voice_render_short(tsf* f, struct tsf_voice* v, int32_t* outputB
 		switch (f->outputmode)
 		{
 			case TSF_STEREO_INTERLEAVED:
-//				gainLeft = gainMono * v->panFactorLeft, gainRight = gainMono * v->panFactorRight;
                                 gainLeftF16P16 = (gainMonoF16P16 * v->panFactorLeftF16P16) >> 16;
                                 gainRightF16P16 = (gainMonoF16P16 * v->panFactorRightF16P16) >> 16;
-				while (blockSamples-- && tmpSourceSamplePositionF24P8 < tmpSampleEndF24P8)
+				while (blockSamples && tmpSourceSamplePositionF24P8 < tmpSampleEndF24P8)
 				{
-					fixed24p8 pos = (unsigned int)tmpSourceSamplePositionF24P8;
-//                                        fixed24p8 nextPos = (pos >= tmpLoopEndF24P8 && isLooping ? tmpLoopStartF24P8 : pos + (1 << 8));
-
-//					// Simple linear interpolation.
-//					float alpha = (float)(tmpSourceSamplePosition - pos), val = (input[pos] * (1.0f - alpha) + input[nextPos] * alpha);
-#ifdef ESP8266
-                                        fixed16p16 val = pgm_read_word(&input[pos >> 8]);
-#else
-                                        fixed16p16 val = input[pos >> 8];
+					// Mix as many samples as can be reached before the loop or sample end in one straight run
+					fixed24p8 step = pitchRatioF16P16 >> 8;
+					fixed24p8 limit = (isLooping && tmpLoopEndF24P8 < tmpSampleEndF24P8 ? tmpLoopEndF24P8 : tmpSampleEndF24P8);
+					fixed24p8 runPos = tmpSourceSamplePositionF24P8;
+					TSF_CONST short* runInput = input;
+					int run;
+#ifdef TSF_STREAMED
+					if (f->sampleCache)
+					{
+						// Streamed samples are only contiguous within a chunk, so stop the run at its end too
+						tsf_u32 chunk = (tsf_u32)(runPos >> 8) / TSF_SAMPLE_CHUNK;
+						fixed24p8 chunkStart = (fixed24p8)(chunk * TSF_SAMPLE_CHUNK) << 8;
+						runInput = tsf_sample_cache_get(f->sampleCache, chunk);
+						runPos -= chunkStart;
+						if (limit - chunkStart > (TSF_SAMPLE_CHUNK << 8)) limit = chunkStart + (TSF_SAMPLE_CHUNK << 8);
+					}
 #endif
+					run = (step > 0 ? (limit - tmpSourceSamplePositionF24P8 + step - 1) / step : blockSamples);
+					if (run < 1) run = 1;
+					if (run > blockSamples) run = blockSamples;
+					if (gainRampF16P16)
+					{
+						// In steps of TSF_ATTACK_STEP samples, each at the gain of its middle sample
+						fixed16p16 gainStepF16P16;
+						if (run > TSF_ATTACK_STEP) run = TSF_ATTACK_STEP;
+						gainStepF16P16 = gainMonoF16P16 + (fixed16p16)((int64_t)gainRampF16P16 * (2 * (blockLength - blockSamples) + run) / (2 * blockLength));
+						gainLeftF16P16 = (gainStepF16P16 * v->panFactorLeftF16P16) >> 16;
+						gainRightF16P16 = (gainStepF16P16 * v->panFactorRightF16P16) >> 16;
+					}
+					blockSamples -= run;
 
-					// Low-pass filter.
-					//if (tmpLowpass.active) val = tsf_voice_lowpass_process(&tmpLowpass, val);
-
-                                        // Do saturating adds for each channel
-                                        fixed16p16 smp;
-
-                                        // No clipping because it eats 20% of the performance on the M0+ Pico!
-
-                                        smp = *outL;
-                                        smp += (val * gainLeftF16P16) >> 16;
-//                                        if (smp > 32767) smp = 32767;
-//                                        else if (smp < -32768) smp = -32768;
-                                        *outL++ = smp;
-
-                                        smp = *outL;
-                                        smp += (val * gainRightF16P16) >> 16;
-//                                        if (smp > 32767) smp = 32767;
-//                                        else if (smp < -32768) smp = -32768;
-                                        *outL++ = smp;
-
-//					*outL++ += val * gainLeft;
-//					*outL++ += val * gainRight;
+					tsf_voice_mix_short(runInput, runPos, step, run, gainLeftF16P16, gainRightF16P16,
+					                    outL, (pack ? pack + (outL - outputBuffer) : TSF_NULL), (tmpLowpass.active ? &tmpLowpass : TSF_NULL));
+					outL += run * 2;
 
 					// Next sample.
-					tmpSourceSamplePositionF24P8 += pitchRatioF16P16 >> 8;
+					tmpSourceSamplePositionF24P8 += run * step;
 					if (tmpSourceSamplePositionF24P8 >= tmpLoopEndF24P8 && isLooping) tmpSourceSamplePositionF24P8 -= (tmpLoopEndF24P8 - tmpLoopStartF24P8 + 1);
 				}
 				break;
 
 			case TSF_STEREO_UNWEAVED:
-#if 0
-				gainLeft = gainMono * v->panFactorLeft, gainRight = gainMono * v->panFactorRight;
-				while (blockSamples-- && tmpSourceSamplePosition < tmpSampleEndDbl)
-				{
-					unsigned int pos = (unsigned int)tmpSourceSamplePosition, nextPos = (pos >= tmpLoopEnd && isLooping ? tmpLoopStart : pos + 1);
-
-					// Simple linear interpolation.
-					float alpha = (float)(tmpSourceSamplePosition - pos), val = (input[pos] * (1.0f - alpha) + input[nextPos] * alpha);
-
-					// Low-pass filter.
-					if (tmpLowpass.active) val = tsf_voice_lowpass_process(&tmpLowpass, val);
-
-					*outL++ += val * gainLeft;
-					*outR++ += val * gainRight;
-
-					// Next sample.
-					tmpSourceSamplePosition += pitchRatio;
-					if (tmpSourceSamplePosition >= tmpLoopEndDbl && isLooping) tmpSourceSamplePosition -= (tmpLoopEnd - tmpLoopStart + 1.0);
-				}
-				break;
-#endif
 			case TSF_MONO:
-#if 0
-				while (blockSamples-- && tmpSourceSamplePosition < tmpSampleEndDbl)
-				{
-					unsigned int pos = (unsigned int)tmpSourceSamplePosition, nextPos = (pos >= tmpLoopEnd && isLooping ? tmpLoopStart : pos + 1);
-
-					// Simple linear interpolation.
-					float alpha = (float)(tmpSourceSamplePosition - pos), val = (input[pos] * (1.0f - alpha) + input[nextPos] * alpha);
-
-					// Low-pass filter.
-					if (tmpLowpass.active) val = tsf_voice_lowpass_process(&tmpLowpass, val);
-
-					*outL++ += val * gainMono;
-
-					// Next sample.
-					tmpSourceSamplePosition += pitchRatio;
-					if (tmpSourceSamplePosition >= tmpLoopEndDbl && isLooping) tmpSourceSamplePosition -= (tmpLoopEnd - tmpLoopStart + 1.0);
-				}
-#endif
+				// Not supported with TSF_SAMPLES_SHORT
 				break;
 		}
 
 		if (tmpSourceSamplePositionF24P8 >= tmpSampleEndF24P8 || v->ampenv.segment == TSF_SEGMENT_DONE)
 		{
 			tsf_voice_kill(v);
-			return;
+			break;
 		}
 	}
 
+	// Whatever this voice didn't reach still has to be packed
+	if (pack) tsf_pack_short(pack + (outL - outputBuffer), outL, (int)(outEnd - outL));
+	if (v->playingPreset == -1) return;
+
 	v->sourceSamplePositionF24P8 = tmpSourceSamplePositionF24P8;
-	//if (tmpLowpass.active || dynamicLowpass) v->lowpass = tmpLowpass;
+	if (tmpLowpass.active || dynamicLowpass) v->lowpass = tmpLowpass;
 }
 #endif
 
-#ifndef TSF_CONST_FILE
-TSFDEF tsf* tsf_load(struct tsf_stream* stream)
+#ifdef TSF_LOADER
+// Without a cache the samples are read into RAM, with one they're left in the stream and only located
+static tsf* tsf_load_internal(struct tsf_stream* stream, struct tsf_sample_cache* cache)
 {
 	tsf* res = TSF_NULL;
 	struct tsf_riffchunk chunkHead;
@@ -1793,7 +2070,17 @@ TSFDEF tsf* tsf_load(struct tsf_stream* stream)
 		{
 			while (tsf_riffchunk_read(&chunkList, &chunk, stream))
 			{
-				if ((TSF_FourCCEquals(chunk.id, "smpl")
+#ifdef TSF_STREAMED
+				if (cache && TSF_FourCCEquals(chunk.id, "smpl") && !cache->samplesNum && chunk.size >= sizeof(short))
+				{
+					cache->smplOffset = cache->pos;
+					cache->samplesNum = smplCount = chunk.size / (unsigned int)sizeof(short);
+					stream->skip(stream->data, chunk.size);
+				}
+				else
+#endif
+#ifndef TSF_CONST_FILE
+				if (!cache && (TSF_FourCCEquals(chunk.id, "smpl")
 						#ifdef STB_VORBIS_INCLUDE_STB_VORBIS_H
 						|| TSF_FourCCEquals(chunk.id, "smpo")
 						#endif
@@ -1801,7 +2088,9 @@ TSFDEF tsf* tsf_load(struct tsf_stream* stream)
 				{
 					if (!tsf_load_samples(&rawBuffer, &floatBuffer, &shortBuffer, &smplCount, &chunk, stream)) goto out_of_memory;
 				}
-				else stream->skip(stream->data, chunk.size);
+				else
+#endif
+				stream->skip(stream->data, chunk.size);
 			}
 		}
 		else stream->skip(stream->data, chunkList.size);
@@ -1810,7 +2099,7 @@ TSFDEF tsf* tsf_load(struct tsf_stream* stream)
 	{
 		//if (e) *e = TSF_INVALID_INCOMPLETE;
 	}
-	else if (!rawBuffer && !floatBuffer)
+	else if (!rawBuffer && !floatBuffer && !smplCount)
 	{
 		//if (e) *e = TSF_INVALID_NOSAMPLEDATA;
 	}
@@ -1827,6 +2116,9 @@ TSFDEF tsf* tsf_load(struct tsf_stream* stream)
                 res->fontSamples = floatBuffer;
 #else
                 res->shortSamples = shortBuffer;
+#endif
+#ifdef TSF_STREAMED
+                res->sampleCache = cache;
 #endif
                 res->samplesNum = smplCount;
 		floatBuffer = TSF_NULL; // don't free below
@@ -1841,9 +2133,63 @@ TSFDEF tsf* tsf_load(struct tsf_stream* stream)
 	TSF_FREE(hydra.phdrs); TSF_FREE(hydra.pbags); TSF_FREE(hydra.pmods);
 	TSF_FREE(hydra.pgens); TSF_FREE(hydra.insts); TSF_FREE(hydra.ibags);
 	TSF_FREE(hydra.imods); TSF_FREE(hydra.igens); TSF_FREE(hydra.shdrs);
-	TSF_FREE(rawBuffer);   TSF_FREE(floatBuffer);
+	TSF_FREE(rawBuffer);   TSF_FREE((void*)floatBuffer);
+	return res;
+}
+#endif
+
+#ifndef TSF_CONST_FILE
+TSFDEF tsf* tsf_load(struct tsf_stream* stream)
+{
+	return tsf_load_internal(stream, TSF_NULL);
+}
+#endif
+
+#ifdef TSF_STREAMED
+static int tsf_sample_cache_read(struct tsf_sample_cache* c, void* ptr, unsigned int size) { int r = c->stream.read(c->stream.data, ptr, size); if (r > 0) c->pos += r; return r; }
+static int tsf_sample_cache_skip(struct tsf_sample_cache* c, unsigned int count) { if (!c->stream.skip(c->stream.data, count)) return 0; c->pos += count; return 1; }
+
+static void tsf_sample_cache_free(struct tsf_sample_cache* c)
+{
+	TSF_FREE(c->slots); TSF_FREE(c->chunkSlot); TSF_FREE(c->slotChunk); TSF_FREE(c->slotUsed);
+	TSF_FREE(c);
+}
+
+TSFDEF tsf* tsf_load_streamed(struct tsf_stream* stream, int cache_bytes)
+{
+	tsf* res;
+	tsf_u32 i;
+	struct tsf_stream counted = { TSF_NULL, (int(*)(void*,void*,unsigned int))&tsf_sample_cache_read, (int(*)(void*,unsigned int))&tsf_sample_cache_skip, TSF_NULL };
+	struct tsf_sample_cache* c = (struct tsf_sample_cache*)TSF_MALLOC(sizeof(struct tsf_sample_cache));
+	if (!c || !stream->seek) { TSF_FREE(c); return TSF_NULL; }
+	TSF_MEMSET(c, 0, sizeof(struct tsf_sample_cache));
+	c->stream = *stream;
+	counted.data = c;
+	res = tsf_load_internal(&counted, c);
+	if (!res) { tsf_sample_cache_free(c); return TSF_NULL; }
+
+	// At least two slots, so one voice crossing into the next chunk doesn't reload the one it's leaving
+	c->chunkNum = (c->samplesNum + TSF_SAMPLE_CHUNK - 1) / TSF_SAMPLE_CHUNK;
+	c->slotNum = (tsf_u32)cache_bytes / (TSF_SAMPLE_CHUNK * sizeof(short));
+	if (c->slotNum < 2) c->slotNum = 2;
+	if (c->slotNum > c->chunkNum) c->slotNum = c->chunkNum;
+	c->slots = (short*)TSF_MALLOC(c->slotNum * TSF_SAMPLE_CHUNK * sizeof(short));
+	c->chunkSlot = (short*)TSF_MALLOC(c->chunkNum * sizeof(short));
+	c->slotChunk = (int*)TSF_MALLOC(c->slotNum * sizeof(int));
+	c->slotUsed = (tsf_u32*)TSF_MALLOC(c->slotNum * sizeof(tsf_u32));
+	if (!c->slots || !c->chunkSlot || !c->slotChunk || !c->slotUsed || c->slotNum > 32767) { tsf_close(res); return TSF_NULL; }
+	for (i = 0; i < c->chunkNum; i++) c->chunkSlot[i] = -1;
+	for (i = 0; i < c->slotNum; i++) { c->slotChunk[i] = -1; c->slotUsed[i] = 0; }
 	return res;
 }
+
+TSFDEF int tsf_sample_cache_stats(tsf* f, unsigned int* hits, unsigned int* misses)
+{
+	if (!f->sampleCache) return 0;
+	*hits = f->sampleCache->hits;
+	*misses = f->sampleCache->misses;
+	return 1;
+}
 #endif
 
 TSFDEF tsf* tsf_copy(tsf* f)
@@ -1868,25 +2214,56 @@ TSFDEF tsf* tsf_copy(tsf* f)
 
 TSFDEF void tsf_close(tsf* f)
 {
+#ifdef TSF_STREAMED
+	struct tsf_sample_cache* cache;
+#endif
 	if (!f) return;
+#ifdef TSF_STREAMED
+	cache = f->sampleCache;
+#endif
 	if (!f->refCount || !--(*f->refCount))
 	{
+#ifdef TSF_STREAMED
+		if (cache)
+		{
+			// A streamed SoundFont owns its presets, even next to a precompiled one
+			int i; for (i = 0; i != f->presetNum; i++) { TSF_FREE((void*)f->presets[i].regions); TSF_FREE((void*)f->presets[i].keySpans); }
+			TSF_FREE((void*)f->presets);
+			tsf_sample_cache_free(cache);
+		}
+		else
+#endif
+		{
 #ifndef TSF_CONST_FILE
-		struct tsf_preset *preset = f->presets, *presetEnd = preset + f->presetNum;
-		for (; preset != presetEnd; preset++) TSF_FREE(preset->regions);
-		TSF_FREE(f->presets);
+			struct tsf_preset *preset = f->presets, *presetEnd = preset + f->presetNum;
+			for (; preset != presetEnd; preset++) { TSF_FREE(preset->regions); TSF_FREE(preset->keySpans); }
+			TSF_FREE(f->presets);
 #ifndef TSF_SAMPLES_SHORT
-                TSF_FREE(f->fontSamples);
+			TSF_FREE(f->fontSamples);
 #else
-                TSF_FREE(f->shortSamples);
+			TSF_FREE(f->shortSamples);
 #endif
 #endif
+		}
 		TSF_FREE(f->refCount);
 	}
 	TSF_FREE(f->channels);
 	TSF_FREE(f->voices);
 #ifndef TSF_SAMPLES_SHORT
 	TSF_FREE(f);
+#else
+#ifdef TSF_STREAMED
+	if (cache)
+	{
+		TSF_FREE(f);
+		return;
+	}
+#endif
+	// The struct itself lives on (e.g. the const 1mgm.h bank), so leave it ready to play again
+	f->channels = TSF_NULL;
+	f->voices = TSF_NULL;
+	f->voiceNum = f->maxVoiceNum = 0;
+	f->voiceCap = f->voicesStolen = 0;
 #endif
 }
 
@@ -1949,18 +2326,107 @@ TSFDEF int tsf_set_max_voices(tsf* f, int max_voices)
 	return 1;
 }
 
+TSFDEF void tsf_set_voice_cap(tsf* f, int voice_cap)
+{
+	f->voiceCap = voice_cap;
+}
+
+TSFDEF int tsf_stolen_voice_count(tsf* f)
+{
+	return f->voicesStolen;
+}
+
+// How loud a voice is, to pick the one to steal.  Voices already on a fast release will be gone soon, so
+// they return -1 and aren't counted.
+#ifdef TSF_SAMPLES_SHORT
+typedef int64_t tsf_loudness;
+static tsf_loudness tsf_voice_loudness(struct tsf_voice* v)
+{
+	if (v->playingPreset == -1 || (v->ampenv.segment >= TSF_SEGMENT_RELEASE && !v->ampenv.parameters.release)) return -1;
+	return (int64_t)v->ampenv.levelF2P30 * tsf_decibelsToGainF16P16((fixed16p16)(v->noteGainDB * 65536.0f));
+}
+#else
+typedef float tsf_loudness;
+static tsf_loudness tsf_voice_loudness(struct tsf_voice* v)
+{
+	if (v->playingPreset == -1 || (v->ampenv.segment >= TSF_SEGMENT_RELEASE && !v->ampenv.parameters.release)) return -1;
+	return v->ampenv.level * tsf_decibelsToGain(v->noteGainDB);
+}
+#endif
+
+static void tsf_voice_steal(tsf* f)
+{
+	struct tsf_voice *v, *vEnd = f->voices + f->voiceNum;
+	int sounding = 0;
+
+	// Most note-ons find room, so only count until then
+	for (v = f->voices; v != vEnd; v++)
+		if (v->playingPreset != -1 && (v->ampenv.segment < TSF_SEGMENT_RELEASE || v->ampenv.parameters.release)) sounding++;
+
+	// Released voices go first, then the quietest
+	for (; sounding >= f->voiceCap; sounding--)
+	{
+		struct tsf_voice *quietest = TSF_NULL;
+		tsf_loudness level, quietestLevel = 0;
+		TSF_BOOL released, quietestReleased = TSF_FALSE;
+		for (v = f->voices; v != vEnd; v++)
+		{
+			if ((level = tsf_voice_loudness(v)) < 0) continue;
+			released = (v->ampenv.segment >= TSF_SEGMENT_RELEASE);
+			if (!quietest || (released && !quietestReleased) || (released == quietestReleased && level < quietestLevel))
+			{
+				quietest = v;
+				quietestLevel = level;
+				quietestReleased = released;
+			}
+		}
+		if (!quietest) return;
+		tsf_voice_endquick(f, quietest);
+		f->voicesStolen++;
+	}
+}
+
+TSFDEF int tsf_note_steal(tsf* f, int* preset_index)
+{
+	struct tsf_voice *v, *vEnd = f->voices + f->voiceNum, *quietest = TSF_NULL;
+	tsf_loudness level, quietestLevel = 0;
+	for (v = f->voices; v != vEnd; v++)
+	{
+		if (v->ampenv.segment >= TSF_SEGMENT_RELEASE || (level = tsf_voice_loudness(v)) < 0) continue;
+		if (!quietest || level < quietestLevel) { quietest = v; quietestLevel = level; }
+	}
+	if (!quietest) return -1;
+
+	// Every voice the note started shares its play index
+	*preset_index = quietest->playingPreset;
+	for (v = f->voices; v != vEnd; v++)
+		if (v != quietest && v->playingPreset != -1 && v->playIndex == quietest->playIndex && v->ampenv.segment < TSF_SEGMENT_RELEASE) tsf_voice_endquick(f, v);
+	tsf_voice_endquick(f, quietest);
+	return quietest->playingKey;
+}
+
 TSFDEF int tsf_note_on(tsf* f, int preset_index, int key, float vel)
 {
 	short midiVelocity = (short)(vel * 127);
 	unsigned int voicePlayIndex;
+	TSF_CONST struct tsf_preset* preset;
 	TSF_CONST struct tsf_region *region, *regionEnd;
 
 	if (preset_index < 0 || preset_index >= f->presetNum) return 1;
 	if (vel <= 0.0f) { tsf_note_off(f, preset_index, key); return 1; }
 
-	// Play all matching regions.
+	// Play all matching regions, only looking at the span that covers the key when the preset is indexed.
 	voicePlayIndex = f->voicePlayIndex++;
-	for (region = f->presets[preset_index].regions, regionEnd = region + f->presets[preset_index].regionNum; region != regionEnd; region++)
+	preset = &f->presets[preset_index];
+	region = preset->regions;
+	regionEnd = region + preset->regionNum;
+	if (preset->keySpans && key >= 0 && key < 128)
+	{
+		tsf_u32 span = preset->keySpans[key >> 1] >> ((key & 1) << 4);
+		regionEnd = region + ((span >> 8) & 0xff);
+		region += span & 0xff;
+	}
+	for (; region != regionEnd; region++)
 	{
 		struct tsf_voice *voice, *v, *vEnd; TSF_BOOL doLoop;
 #ifndef TSF_SAMPLES_SHORT
@@ -1968,6 +2434,8 @@ TSFDEF int tsf_note_on(tsf* f, int preset_index, int key, float vel)
 #endif
 		if (key < (int)region->lokey || key > (int)region->hikey || midiVelocity < (int)region->lovel || midiVelocity > (int)region->hivel) continue;
 
+		if (f->voiceCap) tsf_voice_steal(f);
+
 		voice = TSF_NULL, v = f->voices, vEnd = v + f->voiceNum;
 		if (region->group)
 		{
@@ -2061,10 +2529,25 @@ TSFDEF int tsf_note_on(tsf* f, int preset_index, int key, float vel)
 		voice->lowpass.z1 = voice->lowpass.z2 = 0;
 		voice->lowpass.active = (lowpassFc < 0.499f);
                 if (voice->lowpass.active) tsf_voice_lowpass_setup(&voice->lowpass, lowpassFc);
+#else
+		// Setup lowpass filter.
+		voice->lowpass.QInvF2P30 = (fixed2p30)(1073741824.0f / TSF_POWF(10.0f, region->initialFilterQ / 200.0f));
+		voice->lowpass.log2FcScaleF8P24 = (fixed8p24)(TSF_LOG(8.176f / f->outSampleRate) * TSF_LOG2E_F8P24);
+		voice->lowpass.ic1F28P4 = voice->lowpass.ic2F28P4 = 0;
+		tsf_voice_lowpass_cutoff(&voice->lowpass, region->initialFilterFc * 256);
 #endif
 		// Setup LFO filters.
 		tsf_voice_lfo_setup(&voice->modlfo, region->delayModLFO, region->freqModLFO, f->outSampleRate);
 		tsf_voice_lfo_setup(&voice->viblfo, region->delayVibLFO, region->freqVibLFO, f->outSampleRate);
+
+#ifdef TSF_STREAMED
+		// Read in the attack and the start of the loop now, rather than in the middle of a render
+		if (f->sampleCache && region->offset < f->sampleCache->samplesNum)
+		{
+			tsf_sample_cache_get(f->sampleCache, region->offset / TSF_SAMPLE_CHUNK);
+			if (doLoop && region->loop_start < f->sampleCache->samplesNum) tsf_sample_cache_get(f->sampleCache, region->loop_start / TSF_SAMPLE_CHUNK);
+		}
+#endif
 	}
 //#ifndef TSF_SAMPLES_SHORT
 	return 1;
@@ -2183,18 +2666,21 @@ TSFDEF void tsf_render_float(tsf* f, float* buffer, int samples, int flag_mixing
 #else
 TSFDEF void tsf_render_short_2x(tsf* f, short* buffer, int samples, int flag_mixing)
 {
-        struct tsf_voice *v = f->voices, *vEnd = v + f->voiceNum;
+        struct tsf_voice *v = f->voices, *vEnd = v + f->voiceNum, *vLast = TSF_NULL;
         int32_t *buffer32 = (int32_t *)buffer;
         if (!flag_mixing) TSF_MEMSET(buffer, 0, (f->outputmode == TSF_MONO ? 1 : 2) * sizeof(short) * samples * 2 /* We sum in 32bs then downsample here to 16b to minimized saturation calcs */);
         for (; v != vEnd; v++)
                 if (v->playingPreset != -1)
-                        tsf_voice_render_short(f, v, buffer32, samples);
-        for (int i = 0; i < samples * 2; i++) {
-            int32_t t = buffer32[i];
-            if (t > 32767) buffer[i] = 32767;
-            else if (t < -32768) buffer[i] = -32768;
-            else buffer[i] = t;
+                        vLast = v;
+        if (!vLast) {
+            tsf_pack_short(buffer, buffer32, samples * 2);
+            return;
         }
+        // The last voice saturates down to 16b as it mixes, saving another pass over the buffer
+        for (v = f->voices; v != vLast; v++)
+                if (v->playingPreset != -1)
+                        tsf_voice_render_short(f, v, buffer32, samples, TSF_NULL);
+        tsf_voice_render_short(f, vLast, buffer32, samples, buffer);
 }
 #endif
 
@@ -10,12 +10,14 @@
 #include <string.h>
 #include <stdint.h>
 #include <stdarg.h>
+#include <time.h>
 
 #define PROGMEM
 #define PSTR
 #define memcpy_P memcpy
 #define sprintf_P sprintf
-#define yield() do {} while(0)
+static inline void yield() { }
+static inline unsigned long micros() { struct timespec t; clock_gettime(CLOCK_MONOTONIC, &t); return t.tv_sec * 1000000UL + t.tv_nsec / 1000; }
 #define printf_P printf
 #define strcpy_P strcpy
 #define snprintf_P snprintf
@@ -0,0 +1,277 @@
+#include <Arduino.h>
+#include <time.h>
+#include <unistd.h>
+#include "AudioFileSourcePROGMEM.h"
+#include "AudioFileSourceSTDIO.h"
+#include "AudioFileSourceMMAP.h"
+#include "AudioGeneratorWAV.h"
+#include "AudioGeneratorMP3a.h"
+#include "AudioGeneratorAAC.h"
+#include "AudioGeneratorOpus.h"
+#include "AudioGeneratorFLAC.h"
+#include <thread>
+#include "fixtures.h"
+
+#define MP3 "../../examples/PlayMP3FromSPIFFS/data/pno-cs.mp3"
+#define AAC "../../examples/PlayAACFromPROGMEM/homer.aac"
+#define OPUS "../../examples/PlayOpusFromLittleFS/data/gs-16b-2c-44100hz.opus"
+#define FLAC "gs-16b-2c-44100hz.flac"
+
+static uint8_t *Load(const char *name, uint32_t *len)
+{
+  FILE *f = fopen(name, "rb");
+  if (!f) {
+    return NULL;
+  }
+  fseek(f, 0, SEEK_END);
+  *len = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  uint8_t *data = (uint8_t *)malloc(*len);
+  if (fread(data, 1, *len, f) != *len) {
+    free(data);
+    data = NULL;
+  }
+  fclose(f);
+  return data;
+}
+
+// One full decode, reopening the source since stop() closes it
+static double Decode(AudioGenerator *gen, AudioFileSourcePROGMEM *src, const uint8_t *data, uint32_t len, AudioOutputHash *out)
+{
+  struct timespec a, b;
+  out->Reset();
+  src->open(data, len);
+  clock_gettime(CLOCK_MONOTONIC, &a);
+  gen->begin(src, out);
+  while (gen->loop()) { /*noop*/ }
+  gen->stop();
+  clock_gettime(CLOCK_MONOTONIC, &b);
+  return (b.tv_sec - a.tv_sec) + (b.tv_nsec - a.tv_nsec) / 1e9;
+}
+
+// Decodes the data both in place and copied through read(), checking they sound the same
+static bool Compare(const char *name, AudioGenerator *gen, const uint8_t *data, uint32_t len, int loops)
+{
+  AudioFileSourcePROGMEM *mem = new AudioFileSourcePROGMEM();
+  AudioFileSourceCopy *copy = new AudioFileSourceCopy(data, len);
+  AudioOutputHash *a = new AudioOutputHash();
+  AudioOutputHash *b = new AudioOutputHash();
+  double inPlace = 0, copied = 0;
+  // The helix decoders carry state from one decode into the next, so start both ways from a used one
+  Decode(gen, mem, data, len, a);
+  for (int i = 0; i < loops; i++) {
+    inPlace += Decode(gen, mem, data, len, a);
+    copied += Decode(gen, copy, data, len, b);
+  }
+  bool ok = a->frames && (a->frames == b->frames) && (a->hash == b->hash);
+  Serial.printf("%-8s %8u frames: %7.2f ms in place, %7.2f ms copied (%6.1f vs %6.1f MB/s) %s\n", name, a->frames,
+                inPlace * 1000 / loops, copied * 1000 / loops, len * loops / inPlace / 1e6, len * loops / copied / 1e6, ok ? "OK" : "MISMATCH");
+  delete b;
+  delete a;
+  delete copy;
+  delete mem;
+  return ok;
+}
+
+// The same file through stdio and through a mapping, used in place by the decoder
+static bool CompareFiles(const char *name, AudioGenerator *gen, const char *file, int loops)
+{
+  AudioFileSourceSTDIO *stdio = new AudioFileSourceSTDIO();
+  AudioFileSourceMMAP *mmap = new AudioFileSourceMMAP();
+  AudioOutputHash *a = new AudioOutputHash();
+  AudioOutputHash *b = new AudioOutputHash();
+  double mapped = 0, buffered = 0;
+  struct timespec t0, t1;
+  stdio->open(file);
+  gen->begin(stdio, a);
+  while (gen->loop()) { /*noop*/ }
+  gen->stop();
+  for (int i = 0; i < loops; i++) {
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    a->Reset();
+    stdio->open(file);
+    gen->begin(stdio, a);
+    while (gen->loop()) { /*noop*/ }
+    gen->stop();
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    buffered += (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    b->Reset();
+    mmap->open(file);
+    gen->begin(mmap, b);
+    while (gen->loop()) { /*noop*/ }
+    gen->stop();
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    mapped += (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+  }
+  bool ok = a->frames && (a->frames == b->frames) && (a->hash == b->hash);
+  Serial.printf("%-8s %8u frames: %7.2f ms MMAP,     %7.2f ms STDIO  %s\n", name, a->frames,
+                mapped * 1000 / loops, buffered * 1000 / loops, ok ? "OK" : "MISMATCH");
+  delete b;
+  delete a;
+  delete mmap;
+  delete stdio;
+  return ok;
+}
+
+// FLAC through loop() against the threaded batch decoder at a few thread counts
+static bool CompareParallel(const char *file, int loops)
+{
+  AudioFileSourceSTDIO *stdio = new AudioFileSourceSTDIO();
+  AudioOutputHash *ref = new AudioOutputHash();
+  AudioOutputHash *out = new AudioOutputHash();
+  AudioGeneratorFLAC *flac = new AudioGeneratorFLAC();
+  struct timespec t0, t1;
+  double secs = 0;
+  for (int i = 0; i < loops; i++) {
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    ref->Reset();
+    stdio->open(file);
+    flac->begin(stdio, ref);
+    while (flac->loop()) { /*noop*/ }
+    flac->stop();
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    secs += (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+  }
+  double single = secs;
+  Serial.printf("FLAC     %8u frames: %7.2f ms loop()\n", ref->frames, single * 1000 / loops);
+  bool ok = ref->frames > 0;
+  const int threads[] = { 1, 2, 4, 0 };
+  for (auto t : threads) {
+    secs = 0;
+    for (int i = 0; i < loops; i++) {
+      clock_gettime(CLOCK_MONOTONIC, &t0);
+      out->Reset();
+      stdio->open(file);
+      flac->decodeParallel(stdio, out, t);
+      stdio->close();
+      clock_gettime(CLOCK_MONOTONIC, &t1);
+      secs += (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+    }
+    bool same = (out->frames == ref->frames) && (out->hash == ref->hash);
+    unsigned cores = std::thread::hardware_concurrency();
+    unsigned n = t ? t : cores; // 0 is one a core
+    Serial.printf("FLAC     %8u frames: %7.2f ms decodeParallel, %u thread%s (%.2fx, %u cores) %s\n", out->frames, secs * 1000 / loops,
+                  n, (n == 1) ? "" : "s", single / secs, cores, same ? "OK" : "MISMATCH");
+    ok &= same;
+  }
+  delete flac;
+  delete out;
+  delete ref;
+  delete stdio;
+  return ok;
+}
+
+// Opening and reading through many files, the way an ingest server would
+static void ReadFiles(const char *file, int loops)
+{
+  static uint8_t buff[4096];
+  AudioFileSourceSTDIO *stdio = new AudioFileSourceSTDIO();
+  AudioFileSourceMMAP *mmap = new AudioFileSourceMMAP();
+  struct timespec t0, t1;
+  uint64_t bytes = 0;
+  uint32_t sum = 0;
+  double secs[3];
+  for (int way = 0; way < 3; way++) {
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    bytes = 0;
+    for (int i = 0; i < loops; i++) {
+      if (way == 0) {
+        stdio->open(file);
+        uint32_t r;
+        while ((r = stdio->read(buff, sizeof(buff))) > 0) {
+          sum += buff[r - 1];
+          bytes += r;
+        }
+        stdio->close();
+      } else if (way == 1) {
+        mmap->open(file);
+        uint32_t r;
+        while ((r = mmap->read(buff, sizeof(buff))) > 0) {
+          sum += buff[r - 1];
+          bytes += r;
+        }
+        mmap->close();
+      } else {
+        // Walk the mapping in the same sized steps, but without copying
+        mmap->open(file);
+        uint32_t avail;
+        const uint8_t *p;
+        while ((p = mmap->peek(&avail)) && avail) {
+          uint32_t r = (avail > sizeof(buff)) ? sizeof(buff) : avail;
+          sum += p[r - 1];
+          bytes += r;
+          mmap->consume(r);
+        }
+        mmap->close();
+      }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    secs[way] = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+  }
+  Serial.printf("Reading %d files: STDIO %.0f MB/s, MMAP read %.0f MB/s, MMAP peek %.0f MB/s (%u)\n", loops,
+                bytes / secs[0] / 1e6, bytes / secs[1] / 1e6, bytes / secs[2] / 1e6, sum & 1);
+  delete mmap;
+  delete stdio;
+}
+
+int main(int argc, char **argv)
+{
+  // Decodes are repeated to average the timings, CI passes 1 to just check the results under valgrind
+  int loops = (argc > 1) ? atoi(argv[1]) : 5;
+  if (loops < 1) {
+    loops = 1;
+  }
+  bool ok = true;
+
+  // A minute of 24-bit stereo WAV, which always needs converting
+  const uint32_t frames = 44100 * 60;
+  uint32_t wavLen = 44 + frames * 6;
+  uint8_t *wav = (uint8_t *)malloc(wavLen);
+  memcpy(wav, "RIFF\0\0\0\0WAVEfmt \x10\0\0\0\x01\0\x02\0\x44\xac\0\0\x88\x58\x0f\0\x06\0\x18\0data", 40);
+  wav[40] = (frames * 6) & 0xff;
+  wav[41] = ((frames * 6) >> 8) & 0xff;
+  wav[42] = ((frames * 6) >> 16) & 0xff;
+  wav[43] = (frames * 6) >> 24;
+  for (uint32_t i = 44; i < wavLen; i++) {
+    wav[i] = rand();
+  }
+  AudioGeneratorWAV *w = new AudioGeneratorWAV();
+  ok &= Compare("WAV s24", w, wav, wavLen, loops * 2);
+  FILE *f = fopen("bench.wav", "wb");
+  fwrite(wav, 1, wavLen, f);
+  fclose(f);
+  ok &= CompareFiles("WAV s24", w, "bench.wav", loops * 2);
+  delete w;
+  free(wav);
+
+  uint32_t len;
+  uint8_t *data = Load(MP3, &len);
+  AudioGeneratorMP3a *mp3 = new AudioGeneratorMP3a();
+  ok &= data && Compare("MP3", mp3, data, len, loops);
+  ok &= CompareFiles("MP3", mp3, MP3, loops);
+  delete mp3;
+  free(data);
+
+  data = Load(AAC, &len);
+  AudioGeneratorAAC *aac = new AudioGeneratorAAC();
+  ok &= data && Compare("AAC", aac, data, len, loops);
+  ok &= CompareFiles("AAC", aac, AAC, loops);
+  delete aac;
+  free(data);
+
+  data = Load(OPUS, &len);
+  AudioGeneratorOpus *opus = new AudioGeneratorOpus();
+  ok &= data && Compare("Opus", opus, data, len, loops);
+  ok &= CompareFiles("Opus", opus, OPUS, loops);
+  delete opus;
+  free(data);
+
+  ok &= CompareParallel(FLAC, loops);
+
+  ReadFiles("bench.wav", loops * 4);
+  ReadFiles(MP3, loops * 400);
+  unlink("bench.wav");
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,145 @@
+/*
+    fixtures.h
+    Outputs and sources shared by the host test drivers
+
+    Copyright (C) 2017  Earle F. Philhower, III
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef _HOST_FIXTURES_H
+#define _HOST_FIXTURES_H
+
+#include "AudioOutput.h"
+#include "AudioFileSourcePROGMEM.h"
+
+// Keeps everything played in memory, up to an optional limit, to compare one decode against another
+class AudioOutputCapture : public AudioOutput {
+public:
+    AudioOutputCapture() {
+        pcm = NULL;
+        len = 0;
+        limit = 0xffffffff;
+    }
+    ~AudioOutputCapture() {
+        free(pcm);
+    }
+    virtual bool begin() override {
+        return true;
+    }
+    virtual bool ConsumeSample(int16_t sample[2]) override {
+        if (len >= limit) {
+            return false;
+        }
+        if (!(len & 0xffff)) {
+            pcm = (int16_t *)realloc(pcm, (len + 0x10000) * 2 * sizeof(int16_t));
+        }
+        pcm[len * 2] = sample[0];
+        pcm[len * 2 + 1] = sample[1];
+        len++;
+        return true;
+    }
+    virtual bool stop() override {
+        return true;
+    }
+    int16_t *pcm;
+    uint32_t len;
+    uint32_t limit;
+};
+
+// Just counts whole blocks, so only the generator shows up in the timing
+class AudioOutputNull : public AudioOutput {
+public:
+    AudioOutputNull() : frames(0) { }
+    virtual bool begin() override {
+        return true;
+    }
+    virtual bool ConsumeSample(int16_t sample[2]) override {
+        (void) sample;
+        frames++;
+        return true;
+    }
+    virtual uint16_t ConsumeSamples(int16_t *samples, uint16_t count) override {
+        (void) samples;
+        frames += count;
+        return count;
+    }
+    virtual bool stop() override {
+        return true;
+    }
+    uint32_t frames;
+};
+
+// Hashes whatever it's given so two ways of decoding can be checked against each other.
+// With a FIFO size it only takes that many frames per loop(), like real hardware would.
+class AudioOutputHash : public AudioOutput {
+public:
+    AudioOutputHash(uint32_t fifo = 0) : frames(0), hash(2166136261u), left(NULL), leftSize(0), fifo(fifo), room(fifo) { }
+    virtual bool begin() override {
+        return true;
+    }
+    virtual bool ConsumeSample(int16_t sample[2]) override {
+        return ConsumeSamples(sample, 1) == 1;
+    }
+    virtual uint16_t ConsumeSamples(int16_t *samples, uint16_t count) override {
+        if (fifo) {
+            if (count > room) {
+                count = room;
+            }
+            room -= count;
+        }
+        for (uint16_t i = 0; i < count; i++) {
+            if (frames < leftSize) {
+                left[frames] = samples[i * 2];
+            }
+            frames++;
+            hash = (hash ^ (uint16_t)samples[i * 2]) * 16777619u;
+            hash = (hash ^ (uint16_t)samples[i * 2 + 1]) * 16777619u;
+        }
+        return count;
+    }
+    virtual bool loop() override {
+        room = fifo;
+        return true;
+    }
+    virtual bool stop() override {
+        return true;
+    }
+    // Start over for another decode
+    void Reset() {
+        frames = 0;
+        hash = 2166136261u;
+        room = fifo;
+    }
+    uint32_t frames;
+    uint32_t hash;
+    int16_t *left;     // Left channel kept here, when given somewhere to put it
+    uint32_t leftSize;
+
+private:
+    uint32_t fifo;
+    uint32_t room;
+};
+
+// The same memory, but only reachable through read() like a file or network stream
+class AudioFileSourceCopy : public AudioFileSourcePROGMEM {
+public:
+    AudioFileSourceCopy(const void *data, uint32_t len) : AudioFileSourcePROGMEM(data, len) { }
+    virtual const uint8_t *peek(uint32_t *avail) override {
+        *avail = 0;
+        return NULL;
+    }
+};
+
+#endif
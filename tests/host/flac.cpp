@@ -2,9 +2,137 @@
 #include "AudioFileSourceSTDIO.h"
 #include "AudioOutputSTDIO.h"
 #include "AudioGeneratorFLAC.h"
+#include "fixtures.h"
 
 #define AAC "gs-16b-2c-44100hz.flac"
 
+// Frame start offsets of the test file, found by decoding it with libflac directly
+static FLAC__uint64 scanStart[4096];
+static FLAC__uint64 scanSample[4096];
+static uint32_t scanBlock[4096];
+static int scanFrames;
+static FLAC__uint64 scanPos;
+
+static const uint8_t *scanData;
+static size_t scanLen;
+static size_t scanRead;
+
+static FLAC__StreamDecoderReadStatus ScanReadCB(const FLAC__StreamDecoder *decoder, FLAC__byte buffer[], size_t *bytes, void *client_data)
+{
+  (void)decoder;
+  (void)client_data;
+  if (*bytes > scanLen - scanRead) {
+    *bytes = scanLen - scanRead;
+  }
+  memcpy(buffer, scanData + scanRead, *bytes);
+  scanRead += *bytes;
+  return *bytes ? FLAC__STREAM_DECODER_READ_STATUS_CONTINUE : FLAC__STREAM_DECODER_READ_STATUS_END_OF_STREAM;
+}
+
+static FLAC__StreamDecoderTellStatus ScanTell(const FLAC__StreamDecoder *decoder, FLAC__uint64 *absolute_byte_offset, void *client_data)
+{
+  (void)decoder;
+  (void)client_data;
+  *absolute_byte_offset = scanRead;
+  return FLAC__STREAM_DECODER_TELL_STATUS_OK;
+}
+
+static FLAC__StreamDecoderWriteStatus ScanWrite(const FLAC__StreamDecoder *decoder, const FLAC__Frame *frame, const FLAC__int32 *const buffer[], void *client_data)
+{
+  (void)buffer;
+  (void)client_data;
+  if (scanFrames < 4096) {
+    scanStart[scanFrames] = scanPos;
+    scanSample[scanFrames] = frame->header.number.sample_number;
+    scanBlock[scanFrames++] = frame->header.blocksize;
+  }
+  FLAC__stream_decoder_get_decode_position(decoder, &scanPos);
+  return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
+}
+
+static void ScanError(const FLAC__StreamDecoder *decoder, FLAC__StreamDecoderErrorStatus status, void *client_data)
+{
+  (void)decoder;
+  (void)status;
+  (void)client_data;
+}
+
+static void Put(uint8_t *p, uint64_t v, int bytes)
+{
+  for (int i = bytes - 1; i >= 0; i--, v >>= 8) {
+    p[i] = (uint8_t)v;
+  }
+}
+
+// Copy of the test file with a SEEKTABLE after the STREAMINFO, a point every 8 frames and two
+// placeholders at the end, so the seeks below go through the table libflac keeps
+static bool MakeSeekTableCopy(const char *name)
+{
+  FILE *f = fopen(AAC, "rb");
+  fseek(f, 0, SEEK_END);
+  long len = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  uint8_t *src = (uint8_t *)malloc(len);
+  fread(src, 1, len, f);
+  fclose(f);
+
+  FLAC__StreamDecoder *dec = FLAC__stream_decoder_new();
+  scanData = src;
+  scanLen = len;
+  scanRead = 0;
+  scanFrames = 0;
+  if (FLAC__stream_decoder_init_stream(dec, ScanReadCB, NULL, ScanTell, NULL, NULL, ScanWrite, NULL, ScanError, NULL) != FLAC__STREAM_DECODER_INIT_STATUS_OK) {
+    FLAC__stream_decoder_delete(dec);
+    free(src);
+    return false;
+  }
+  FLAC__uint64 audio = 0;
+  FLAC__stream_decoder_process_until_end_of_metadata(dec);
+  FLAC__stream_decoder_get_decode_position(dec, &audio);
+  scanPos = audio;
+  FLAC__stream_decoder_process_until_end_of_stream(dec);
+  FLAC__stream_decoder_delete(dec);
+
+  int points = (scanFrames + 7) / 8 + 2;
+  static uint8_t table[4 + 18 * 520];
+  table[0] = FLAC__METADATA_TYPE_SEEKTABLE;
+  Put(table + 1, 18 * points, 3);
+  for (int i = 0; i < points; i++) {
+    uint8_t *pt = table + 4 + 18 * i;
+    if (i < points - 2) {
+      Put(pt, scanSample[i * 8], 8);
+      Put(pt + 8, scanStart[i * 8] - audio, 8);
+      Put(pt + 16, scanBlock[i * 8], 2);
+    } else {
+      Put(pt, FLAC__STREAM_METADATA_SEEKPOINT_PLACEHOLDER, 8);
+      Put(pt + 8, 0, 8);
+      Put(pt + 16, 0, 2);
+    }
+  }
+  // "fLaC" and the 34 byte STREAMINFO, which is never the last block here, then the table
+  f = fopen(name, "wb");
+  fwrite(src, 1, 4 + 4 + 34, f);
+  fwrite(table, 1, 4 + 18 * points, f);
+  fwrite(src + 42, 1, len - 42, f);
+  fclose(f);
+  free(src);
+  printf("SEEKTABLE copy: %d frames, %d points\n", scanFrames, points);
+  return true;
+}
+
+void StatusCallback(void *cbData, int code, const char *string)
+{
+  (void)cbData;
+  Serial.printf("FLAC status: %d = '%s'\n", code, string);
+}
+
+void MDCallback(void *cbData, const char *type, bool isUnicode, const char *string)
+{
+  (void)cbData;
+  (void)isUnicode;
+  Serial.printf("FLAC comment: %s = '%s'\n", type, string);
+}
+
 int main(int argc, char **argv)
 {
     (void) argc;
@@ -13,6 +141,9 @@ int main(int argc, char **argv)
     AudioOutputSTDIO *out = new AudioOutputSTDIO();
     out->SetFilename("out.flac.wav");
     AudioGeneratorFLAC *flac = new AudioGeneratorFLAC();
+    flac->RegisterMetadataCB(MDCallback, NULL);
+    flac->RegisterStatusCB(StatusCallback, NULL);
+    flac->SetMD5Check(true);
 
     flac->begin(in, out);
     while (flac->loop()) { /*noop*/ }
@@ -21,4 +152,94 @@ int main(int argc, char **argv)
     delete flac;
     delete out;
     delete in;
+
+    // Same file through the threaded batch decoder, must match the above exactly
+    in = new AudioFileSourceSTDIO(AAC);
+    out = new AudioOutputSTDIO();
+    out->SetFilename("out.flac.par.wav");
+    flac = new AudioGeneratorFLAC();
+    flac->decodeParallel(in, out, 4);
+    delete flac;
+    delete out;
+    delete in;
+
+    // Ogg-FLAC, first 24 frames of the same file with the MD5 of just those
+    in = new AudioFileSourceSTDIO("gs-16b-2c-44100hz.oga");
+    out = new AudioOutputSTDIO();
+    out->SetFilename("out.oga.wav");
+    flac = new AudioGeneratorFLAC();
+    flac->RegisterStatusCB(StatusCallback, NULL);
+    flac->SetMD5Check(true);
+    flac->begin(in, out);
+    while (flac->loop()) { /*noop*/ }
+    flac->stop();
+    delete flac;
+    delete out;
+    delete in;
+
+    FILE *a = fopen("out.flac.wav", "rb");
+    FILE *b = fopen("out.flac.par.wav", "rb");
+    int ca, cb;
+    do {
+        ca = fgetc(a);
+        cb = fgetc(b);
+    } while ((ca == cb) && (ca != EOF));
+    fclose(a);
+    fclose(b);
+    printf("Parallel decode %s\n", (ca == cb) ? "matches" : "DIFFERS");
+    int fails = (ca == cb) ? 0 : 1;
+
+    // Seeking, checked sample for sample against the straight decode
+    if (!MakeSeekTableCopy("seek.flac")) {
+        printf("Can't build the SEEKTABLE copy\n");
+        return 1;
+    }
+    a = fopen("out.flac.wav", "rb");
+    fseek(a, 0, SEEK_END);
+    uint32_t fullLen = (ftell(a) - 44) / 4;
+    int16_t *full = (int16_t *)malloc(fullLen * 4);
+    fseek(a, 44, SEEK_SET);
+    fread(full, 4, fullLen, a);
+    fclose(a);
+    const uint32_t seeks[] = { 0, 1000, 2345, 7000, 15000 };
+    for (auto ms : seeks) {
+        in = new AudioFileSourceSTDIO("seek.flac");
+        AudioOutputCapture *part = new AudioOutputCapture();
+        flac = new AudioGeneratorFLAC();
+        flac->begin(in, part);
+        // Part way into a block for all but the first, which seeks before any audio is decoded
+        if (ms) {
+            part->limit = 1000;
+            for (int i = 0; i < 20; i++) {
+                flac->loop();
+            }
+        }
+        part->len = 0;
+        part->limit = 44100;
+        bool ok = flac->seek(ms);
+        while (ok && flac->loop() && (part->len < part->limit)) { /*noop*/ }
+        flac->stop();
+        uint32_t at = ms * 441 / 10;
+        bool same = ok && part->len && (at + part->len <= fullLen) && !memcmp(full + at * 2, part->pcm, part->len * 4);
+        printf("Seek to %u ms: %u samples %s\n", ms, part->len, same ? "match" : "DIFFER");
+        fails += same ? 0 : 1;
+        delete flac;
+        delete part;
+        delete in;
+    }
+    // Past the end has to fail, not play from somewhere else
+    in = new AudioFileSourceSTDIO("seek.flac");
+    AudioOutputCapture *part = new AudioOutputCapture();
+    flac = new AudioGeneratorFLAC();
+    flac->begin(in, part);
+    if (flac->seek(60000)) {
+        printf("Seek past the end succeeded\n");
+        fails++;
+    }
+    flac->stop();
+    delete flac;
+    delete part;
+    delete in;
+    free(full);
+    return fails ? 1 : 0;
 }
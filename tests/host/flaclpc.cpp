@@ -0,0 +1,77 @@
+#include <Arduino.h>
+extern "C" {
+#include "libflac/private/bitmath.h"
+#include "libflac/private/cpu.h"
+#include "libflac/private/lpc.h"
+}
+
+// Checks the SIMD LPC restore routines are bit exact with the C ones for every order
+
+typedef void (*restoreFn)(const FLAC__int32 residual[], uint32_t data_len, const FLAC__int32 qlp_coeff[], uint32_t order, int lp_quantization, FLAC__int32 data[]);
+
+#define LEN 1111
+static FLAC__int32 signal[LEN + 32];
+static FLAC__int32 residual[LEN];
+static FLAC__int32 ref[LEN + 32];
+static FLAC__int32 out[LEN + 32];
+
+static int check(const char *name, restoreFn ref_fn, restoreFn fn, int bps, bool wide) {
+    int fails = 0;
+    for (uint32_t order = 1; order <= 32; order++) {
+        FLAC__int32 coeff[32];
+        int precision = wide ? 15 : 31 - bps - FLAC__bitmath_ilog2(order);
+        int shift = precision - 1;
+        srand(order);
+        for (uint32_t j = 0; j < order; j++) {
+            coeff[j] = (rand() % (1 << precision)) - (1 << (precision - 1));
+        }
+        for (int i = 0; i < LEN + 32; i++) {
+            signal[i] = (rand() % (1 << bps)) - (1 << (bps - 1));
+        }
+        // Residuals which restore to signal[] with the C predictor
+        memcpy(ref, signal, sizeof(ref));
+        for (int i = 0; i < LEN; i++) {
+            int64_t sum = 0;
+            for (uint32_t j = 0; j < order; j++) {
+                sum += (int64_t)coeff[j] * signal[32 + i - j - 1];
+            }
+            residual[i] = signal[32 + i] - (wide ? (FLAC__int32)(sum >> shift) : ((FLAC__int32)(uint32_t)sum >> shift));
+        }
+        ref_fn(residual, LEN, coeff, order, shift, ref + 32);
+        memcpy(out, signal, sizeof(out));
+        fn(residual, LEN, coeff, order, shift, out + 32);
+        if (memcmp(ref, signal, sizeof(ref)) || memcmp(out, ref, sizeof(out))) {
+            printf("%s: MISMATCH at order %u\n", name, order);
+            fails++;
+        }
+    }
+    printf("%s: %s\n", name, fails ? "FAILED" : "bit exact, orders 1-32");
+    return fails;
+}
+
+int main(int argc, char **argv) {
+    (void) argc;
+    (void) argv;
+    FLAC__CPUInfo cpu;
+    int fails = 0;
+
+    FLAC__cpu_info(&cpu);
+    (void) cpu;
+#if (defined FLAC__CPU_IA32 || defined FLAC__CPU_X86_64) && FLAC__HAS_X86INTRIN
+#ifdef FLAC__SSE4_1_SUPPORTED
+    if (cpu.x86.sse41) {
+        fails += check("sse41", FLAC__lpc_restore_signal, FLAC__lpc_restore_signal_intrin_sse41, 17, false);
+        fails += check("sse41_16", FLAC__lpc_restore_signal, FLAC__lpc_restore_signal_16_intrin_sse41, 16, false);
+        fails += check("sse41_wide", FLAC__lpc_restore_signal_wide, FLAC__lpc_restore_signal_wide_intrin_sse41, 25, true);
+    }
+#endif
+#ifdef FLAC__AVX2_SUPPORTED
+    if (cpu.x86.avx2) {
+        fails += check("avx2", FLAC__lpc_restore_signal, FLAC__lpc_restore_signal_intrin_avx2, 17, false);
+        fails += check("avx2_16", FLAC__lpc_restore_signal, FLAC__lpc_restore_signal_16_intrin_avx2, 16, false);
+        fails += check("avx2_wide", FLAC__lpc_restore_signal_wide, FLAC__lpc_restore_signal_wide_intrin_avx2, 25, true);
+    }
+#endif
+#endif
+    return fails ? 1 : 0;
+}
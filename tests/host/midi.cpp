@@ -1,30 +1,335 @@
 #include <Arduino.h>
+#include <time.h>
 #include "AudioFileSourceSTDIO.h"
+#include "AudioFileSourcePROGMEM.h"
 #include "AudioOutputSTDIO.h"
 #include "AudioGeneratorMIDI.h"
+#include "fixtures.h"
 
 #define MIDI "../../lib/midi-sources/furelise.mid"
+#define SF2 "../../lib/midi-sources/1mgm.sf2"
 #include <libtinysoundfont/1mgm.h>
 
-int main(int argc, char **argv)
+// Counts how hard the generator works the file
+class AudioFileSourceCounter : public AudioFileSourceSTDIO {
+public:
+    AudioFileSourceCounter(const char *name) : AudioFileSourceSTDIO(name), reads(0), seeks(0) { }
+    virtual uint32_t read(void *data, uint32_t len) override {
+        reads++;
+        return AudioFileSourceSTDIO::read(data, len);
+    }
+    virtual bool seek(int32_t pos, int dir) override {
+        seeks++;
+        return AudioFileSourceSTDIO::seek(pos, dir);
+    }
+    int reads;
+    int seeks;
+};
+
+static void Play(AudioFileSource *src, const char *wav, uint32_t eventMemory, AudioFileSource *sf2 = nullptr, uint32_t cacheBytes = 0)
 {
-    (void) argc;
-    (void) argv;
-    AudioFileSourceSTDIO *midifile = new AudioFileSourceSTDIO(MIDI);
-//    AudioFileSourceSTDIO *sf2file = new AudioFileSourceSTDIO(SF2);
     AudioOutputSTDIO *out = new AudioOutputSTDIO();
-    out->SetFilename("midi.wav");
+    out->SetFilename(wav);
     AudioGeneratorMIDI *midi = new AudioGeneratorMIDI();
 
-    midi->SetSoundFont(&_tsf);
+    if (sf2) {
+        midi->SetSoundFont(sf2, cacheBytes);
+    } else {
+        midi->SetSoundFont(&_tsf);
+    }
     midi->SetSampleRate(22050);
+    midi->SetEventMemory(eventMemory);
+    midi->SetCPUBudget(0); // Output has to match between runs, however busy the host is
 
-    midi->begin(midifile, out);
+    midi->begin(src, out);
     while (midi->loop()) { /*noop*/ }
     midi->stop();
+    uint32_t hits, misses;
+    if (midi->SoundFontCacheStats(&hits, &misses)) {
+        printf("SF2 from file, %uKB cache: %u hits, %u misses\n", cacheBytes / 1024, hits, misses);
+    }
+
+    delete out;
+    delete midi;
+}
 
+// Renders the score from memory a few times and reports the best speed
+static void Bench(const uint8_t *data, uint32_t len, int loops)
+{
+    double best = 1e9;
+    uint32_t frames = 0;
+    for (int i = 0; i < loops; i++) {
+        struct timespec a, b;
+        AudioFileSourcePROGMEM *src = new AudioFileSourcePROGMEM(data, len);
+        AudioOutputNull *out = new AudioOutputNull();
+        AudioGeneratorMIDI *midi = new AudioGeneratorMIDI();
+        midi->SetSoundFont(&_tsf);
+        midi->SetSampleRate(22050);
+        clock_gettime(CLOCK_MONOTONIC, &a);
+        midi->begin(src, out);
+        while (midi->loop()) { /*noop*/ }
+        midi->stop();
+        clock_gettime(CLOCK_MONOTONIC, &b);
+        double secs = (b.tv_sec - a.tv_sec) + (b.tv_nsec - a.tv_nsec) / 1e9;
+        best = (secs < best) ? secs : best;
+        frames = out->frames;
+        delete midi;
+        delete out;
+        delete src;
+    }
+    printf("Rendered %.1f s of audio in %.1f ms, %.0fx real time\n", frames / 22050.0, best * 1000, frames / 22050.0 / best);
+}
+
+static void StatusCB(void *cbData, int code, const char *string)
+{
+    (void) code;
+    (void) string;
+    (*(int *)cbData)++;
+}
+
+// Only a few voices allowed, so new notes have to take over from the quietest ones
+static bool Squeeze(const uint8_t *data, uint32_t len, int voices)
+{
+    AudioFileSourcePROGMEM *src = new AudioFileSourcePROGMEM(data, len);
+    AudioOutputNull *out = new AudioOutputNull();
+    AudioGeneratorMIDI *midi = new AudioGeneratorMIDI();
+    int reports = 0;
+    midi->SetSoundFont(&_tsf);
+    midi->SetSampleRate(22050);
+    midi->SetCPUBudget(0);
+    midi->SetMaxVoices(voices);
+    midi->RegisterStatusCB(StatusCB, &reports);
+    midi->begin(src, out);
+    while (midi->loop()) { /*noop*/ }
+    midi->stop();
+    printf("%d voices: %u frames, %d notes skipped, %d voices stolen, %d reports\n", voices, out->frames, midi->NotesSkipped(), midi->VoicesStolen(), reports);
+    bool ok = out->frames && !midi->NotesSkipped() && midi->VoicesStolen() && reports;
+    delete midi;
     delete out;
+    delete src;
+    return ok;
+}
+
+// Remembers when the output first made a sound
+class AudioOutputOnset : public AudioOutputNull {
+public:
+    AudioOutputOnset() : onset(-1) { }
+    virtual uint16_t ConsumeSamples(int16_t *samples, uint16_t count) override {
+        for (int i = 0; (onset < 0) && (i < count); i++) {
+            if (samples[i * 2] || samples[i * 2 + 1]) {
+                onset = frames + i;
+            }
+        }
+        return AudioOutputNull::ConsumeSamples(samples, count);
+    }
+    int onset;
+};
+
+// Live events with sample times, which have to land on their sample whatever the block size.  The attack
+// ramps up from the note's first sample, whose quietest few samples may still round to silence
+static bool Live(int block)
+{
+    AudioOutputOnset *out = new AudioOutputOnset();
+    AudioGeneratorMIDI *midi = new AudioGeneratorMIDI();
+    midi->SetSoundFont(&_tsf);
+    midi->SetSampleRate(22050);
+    midi->SetCPUBudget(0);
+    midi->SetBlockSize(block);
+    midi->beginLive(out);
+    bool queued = midi->NoteOn(0, 60, 100, 1001);
+    queued &= midi->PitchBend(0, 12000, 5000);
+    queued &= midi->NoteOff(0, 60, 8000);
+    queued &= midi->ControlChange(1, 7, 100, 8000);
+    queued &= midi->ProgramChange(1, 40, 8000);
+    queued &= midi->NoteOn(1, 67, 90, 9001);
+    queued &= midi->NoteOn(9, 36, 127, 12000);
+    queued &= midi->NoteOff(1, 67, 15000);
+    int loops = 0;
+    while (midi->SampleTime() < 22050) {
+        midi->loop();
+        loops++;
+    }
+    midi->stop();
+
+    // The queue only holds so much
+    int sent = 0;
+    while (midi->NoteOn(0, 60, 100, 30000) && (sent < 1000)) {
+        sent++;
+    }
+    printf("Live, %3d sample blocks: %u frames in %d loops, first sound at %d, %d events queued\n", block, out->frames, loops, out->onset, sent);
+    bool ok = queued && (out->onset >= 1001) && (out->onset <= 1001 + 8) && (sent == 64) && !midi->NotesSkipped();
     delete midi;
+    delete out;
+    return ok;
+}
+
+// A note sent for later mustn't hold up one sent after it for sooner, or for right away
+static bool LiveOrder(uint32_t when)
+{
+    AudioOutputOnset *out = new AudioOutputOnset();
+    AudioGeneratorMIDI *midi = new AudioGeneratorMIDI();
+    midi->SetSoundFont(&_tsf);
+    midi->SetSampleRate(22050);
+    midi->SetCPUBudget(0);
+    midi->beginLive(out);
+    bool queued = midi->NoteOn(0, 60, 100, 15001);
+    queued &= midi->NoteOn(1, 64, 100, when);
+    while (midi->SampleTime() < 22050) {
+        midi->loop();
+    }
+    midi->stop();
+    printf("Live, note at %5u sent after one at 15001: first sound at %d\n", when, out->onset);
+    bool ok = queued && (out->onset >= (int)when) && (out->onset <= (int)when + 8);
+    delete midi;
+    delete out;
+    return ok;
+}
+
+// Every region that can sound a key has to lie inside that key's span of the index
+static bool KeySpans(const tsf *f)
+{
+    for (int p = 0; p < f->presetNum; p++) {
+        const struct tsf_preset *preset = &f->presets[p];
+        if (!preset->keySpans) {
+            return false;
+        }
+        for (int key = 0; key < 128; key++) {
+            uint32_t span = preset->keySpans[key >> 1] >> ((key & 1) * 16);
+            int first = span & 0xff, end = (span >> 8) & 0xff;
+            for (int r = 0; r < preset->regionNum; r++) {
+                bool covers = (key >= (int)preset->regions[r].lokey) && (key <= (int)preset->regions[r].hikey);
+                if (covers && ((r < first) || (r >= end))) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static int stdio_read(void *data, void *ptr, unsigned int size) {
+    return fread(ptr, 1, size, (FILE *)data);
+}
+static int stdio_skip(void *data, unsigned int count) {
+    return !fseek((FILE *)data, count, SEEK_CUR);
+}
+static int stdio_seek(void *data, unsigned int pos) {
+    return !fseek((FILE *)data, pos, SEEK_SET);
+}
+
+// Times note-ons across the drum kit, which has the most regions to look through
+static double NoteOns(const tsf *bank, bool indexed)
+{
+    tsf f = *bank;
+    struct tsf_preset *presets = (struct tsf_preset *)malloc(f.presetNum * sizeof(struct tsf_preset));
+    memcpy(presets, f.presets, f.presetNum * sizeof(struct tsf_preset));
+    for (int p = 0; !indexed && (p < f.presetNum); p++) {
+        presets[p].keySpans = nullptr;
+    }
+    f.presets = presets;
+    f.voices = nullptr;
+    f.voiceNum = 0;
+    tsf_set_output(&f, TSF_STEREO_INTERLEAVED, 22050, 0);
+    tsf_set_max_voices(&f, 16);
+    int drums = tsf_get_presetindex(&f, 128, 0);
+    struct timespec a, b;
+    clock_gettime(CLOCK_MONOTONIC, &a);
+    for (int i = 0; i < 2000; i++) {
+        for (int key = 27; key < 88; key++) {
+            tsf_note_on(&f, drums, key, 1.0f);
+            tsf_note_off(&f, drums, key);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &b);
+    tsf_close(&f);
+    free(presets);
+    return ((b.tv_sec - a.tv_sec) * 1e9 + (b.tv_nsec - a.tv_nsec)) / (2000 * 61);
+}
+
+// The index built when loading the SF2 has to match the one generated into 1mgm.h
+static bool KeyIndex()
+{
+    FILE *fp = fopen(SF2, "rb");
+    struct tsf_stream stream = { fp, stdio_read, stdio_skip, stdio_seek };
+    tsf *loaded = fp ? tsf_load_streamed(&stream, 0) : nullptr;
+    bool ok = loaded && KeySpans(&_tsf) && KeySpans(loaded) && (loaded->presetNum == _tsf.presetNum);
+    for (int p = 0; ok && (p < _tsf.presetNum); p++) {
+        ok = !memcmp(loaded->presets[p].keySpans, _tsf.presets[p].keySpans, 64 * sizeof(tsf_u32));
+    }
+    tsf_close(loaded);
+    if (fp) {
+        fclose(fp);
+    }
+    printf("Drum kit note-on: %.0f ns indexed, %.0f ns scanning all regions\n", NoteOns(&_tsf, true), NoteOns(&_tsf, false));
+    return ok;
+}
+
+static bool Same(const char *a, const char *b)
+{
+    FILE *fa = fopen(a, "rb");
+    FILE *fb = fopen(b, "rb");
+    bool same = fa && fb;
+    int ca, cb;
+    while (same && ((ca = fgetc(fa)) != EOF || !feof(fb))) {
+        cb = fgetc(fb);
+        same = (ca == cb);
+    }
+    if (fa) {
+        fclose(fa);
+    }
+    if (fb) {
+        fclose(fb);
+    }
+    return same;
+}
+
+int main(int argc, char **argv)
+{
+    (void) argc;
+    (void) argv;
+    bool ok = true;
+
+    // Pre-parsed event list
+    AudioFileSourceCounter *midifile = new AudioFileSourceCounter(MIDI);
+    Play(midifile, "midi.wav", 64 * 1024);
+    printf("Event list: %d reads, %d seeks\n", midifile->reads, midifile->seeks);
+    delete midifile;
+
+    // Not enough RAM for the list, so the tracks are merged while playing
+    midifile = new AudioFileSourceCounter(MIDI);
+    Play(midifile, "midi.stream.wav", 0);
+    printf("Streamed:   %d reads, %d seeks\n", midifile->reads, midifile->seeks);
     delete midifile;
-//    delete sf2file;
+    ok &= Same("midi.wav", "midi.stream.wav");
+
+    // Whole file in memory, parsed in place
+    FILE *f = fopen(MIDI, "rb");
+    static uint8_t data[65536];
+    uint32_t len = fread(data, 1, sizeof(data), f);
+    fclose(f);
+    AudioFileSourcePROGMEM *mem = new AudioFileSourcePROGMEM(data, len);
+    Play(mem, "midi.mem.wav", 0);
+    delete mem;
+    ok &= Same("midi.wav", "midi.mem.wav");
+
+    // SoundFont streamed from the file, through a cache of a few chunks
+    AudioFileSourceCounter *sf2 = new AudioFileSourceCounter(SF2);
+    mem = new AudioFileSourcePROGMEM(data, len);
+    Play(mem, "midi.sf2.wav", 0, sf2, 32 * 1024);
+    printf("SF2 file:   %d reads, %d seeks\n", sf2->reads, sf2->seeks);
+    delete mem;
+    delete sf2;
+    ok &= Same("midi.wav", "midi.sf2.wav");
+
+    ok &= KeyIndex();
+    ok &= Live(256);
+    ok &= Live(17);
+    ok &= LiveOrder(3001);
+    ok &= LiveOrder(0);
+
+    Bench(data, len, 5);
+    ok &= Squeeze(data, len, 4);
+
+    printf("%s\n", ok ? "Streamed and in-memory output match" : "MISMATCH");
+    return ok ? 0 : 1;
 }
@@ -0,0 +1,98 @@
+#include <Arduino.h>
+#include <math.h>
+
+// The SF2 voice filter as AudioGeneratorMIDI builds it, but with the filter in
+#define TSF_NO_STDIO
+#define TSF_CONST_FILE
+#define TSF_SAMPLES_SHORT
+#define TSF_LOWPASS
+#define TSF_IMPLEMENTATION
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#include "libtinysoundfont/tsf.h"
+#pragma GCC diagnostic pop
+
+// Checks the fixed-point filter's frequency response against the bilinear lowpass it's meant to be
+
+#define RATE 22050.0
+#define LEN 16384
+static short tone[LEN];
+static int32_t mix[LEN * 2];
+
+// Cutoff in SF2 cents, as in a region's initialFilterFc
+static double CentsToHz(int cents)
+{
+    return 8.176 * pow(2.0, cents / 1200.0);
+}
+
+// Gain in dB at hz of the float filter, Q given in centibels as in a region's initialFilterQ
+static double Expected(int cents, int q, double hz)
+{
+    double k = tan(M_PI * CentsToHz(cents) / RATE);
+    double qInv = 1.0 / pow(10.0, q / 200.0);
+    double w = 2.0 * M_PI * hz / RATE;
+    // H(z) = k^2 (1 + z^-1)^2 / (a0 + a1 z^-1 + a2 z^-2), evaluated at z = e^jw
+    double a0 = 1.0 + k * qInv + k * k, a1 = 2.0 * (k * k - 1.0), a2 = 1.0 - k * qInv + k * k;
+    double re = a0 + a1 * cos(w) + a2 * cos(2.0 * w);
+    double im = a1 * sin(w) + a2 * sin(2.0 * w);
+    return 10.0 * log10(k * k * k * k * (2.0 + 2.0 * cos(w)) * (2.0 + 2.0 * cos(w)) / (re * re + im * im));
+}
+
+// Gain in dB at hz of the voice filter, once it has settled.  The tone leaves room for 20 dB of resonance
+static double Measured(int cents, int q, double hz, bool *active)
+{
+    static struct tsf_voice_lowpass lowpass;
+    memset(&lowpass, 0, sizeof(lowpass));
+    lowpass.QInvF2P30 = (fixed2p30)(1073741824.0f / powf(10.0f, q / 200.0f));
+    lowpass.log2FcScaleF8P24 = (fixed8p24)(log(8.176f / RATE) * TSF_LOG2E_F8P24);
+    tsf_voice_lowpass_cutoff(&lowpass, cents * 256);
+    *active = lowpass.active;
+    for (int i = 0; i < LEN; i++) {
+        tone[i] = (short)lrint(2048.0 * sin(2.0 * M_PI * hz * i / RATE));
+    }
+    memset(mix, 0, sizeof(mix));
+    tsf_voice_mix_short(tone, 0, 1 << 8, LEN, 1 << 16, 1 << 16, mix, TSF_NULL, lowpass.active ? &lowpass : TSF_NULL);
+    double in = 0, out = 0;
+    for (int i = LEN / 2; i < LEN; i++) {
+        in += (double)tone[i] * tone[i];
+        out += (double)mix[i * 2] * mix[i * 2];
+    }
+    return 10.0 * log10(out / in);
+}
+
+int main(int argc, char **argv)
+{
+    (void) argc;
+    (void) argv;
+    int fails = 0;
+    static const int cutoffs[] = { 6000, 7200, 8400, 9600, 10800 }; // About 260 Hz to 4.2 kHz
+    static const int qs[] = { 0, 100, 200 };                         // Flat, +10 and +20 dB of resonance
+    static const double ratios[] = { 0.25, 0.5, 0.9, 1.0, 1.1, 2.0 };
+    for (auto cents : cutoffs) {
+        for (auto q : qs) {
+            double worst = 0;
+            for (auto ratio : ratios) {
+                double hz = ratio * CentsToHz(cents);
+                bool active;
+                double want = Expected(cents, q, hz);
+                double got = Measured(cents, q, hz, &active);
+                // Deep in the stopband the tone is only a few LSBs, so only hold it to the same floor
+                double err = (want < -40.0) ? ((got > -40.0) ? got + 40.0 : 0.0) : fabs(got - want);
+                worst = (err > worst) ? err : worst;
+                fails += active ? 0 : 1;
+            }
+            bool ok = worst < 0.5;
+            printf("Cutoff %5.0f Hz, Q %2d dB: worst %.2f dB from the float filter %s\n", CentsToHz(cents), q / 10, worst, ok ? "OK" : "FAIL");
+            fails += ok ? 0 : 1;
+        }
+    }
+
+    // Cutoffs at or above 13500 cents, or Nyquist, leave the voice unfiltered
+    bool active;
+    Measured(13500, 0, 1000.0, &active);
+    fails += active ? 1 : 0;
+    Measured(13400, 0, 1000.0, &active);
+    fails += active ? 1 : 0;
+    printf("Filter off above 13500 cents and near Nyquist: %s\n", active ? "FAIL" : "OK");
+    return fails;
+}
@@ -0,0 +1,46 @@
+#include <Arduino.h>
+#include "AudioFileSourceSTDIO.h"
+#include "AudioGeneratorMIDI.h"
+#include "fixtures.h"
+
+#define MIDI "../../lib/midi-sources/furelise.mid"
+#include <libtinysoundfont/1mgm.h>
+
+// furelise.mid through the event list.  That matched the original player's midi.wav sample for sample, and
+// this is the same render once the envelopes went fixed point.  The lowpass and attack ramp that came later
+// change every note, so this is only built without them
+#if !defined(TSF_NO_LOWPASS) || !defined(TSF_NO_ATTACK_RAMP)
+#error Build with -DTSF_NO_LOWPASS -DTSF_NO_ATTACK_RAMP
+#endif
+#define MIDI_HASH 0xd41154c9u
+#define MIDI_FRAMES 3690409u
+
+static bool Render(uint32_t eventMemory)
+{
+    AudioFileSourceSTDIO *file = new AudioFileSourceSTDIO(MIDI);
+    AudioOutputHash *out = new AudioOutputHash();
+    AudioGeneratorMIDI *midi = new AudioGeneratorMIDI();
+    midi->SetSoundFont(&_tsf);
+    midi->SetSampleRate(22050);
+    midi->SetEventMemory(eventMemory);
+    midi->SetCPUBudget(0);
+    midi->begin(file, out);
+    while (midi->loop()) { /*noop*/ }
+    midi->stop();
+    bool ok = (out->hash == MIDI_HASH) && (out->frames == MIDI_FRAMES);
+    printf("%s: %u frames, hash %08x %s\n", eventMemory ? "Event list" : "Streamed  ", out->frames, out->hash, ok ? "OK" : "MISMATCH");
+    delete midi;
+    delete out;
+    delete file;
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    (void) argc;
+    (void) argv;
+    // Both the pre-parsed list and the tracks merged while playing have to keep every event's timing
+    bool ok = Render(64 * 1024);
+    ok &= Render(0);
+    return ok ? 0 : 1;
+}
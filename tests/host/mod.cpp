@@ -1,26 +1,416 @@
 #include <Arduino.h>
+#include <math.h>
 #include "AudioFileSourcePROGMEM.h"
 #include "AudioOutputSTDIO.h"
 #include "AudioGeneratorMOD.h"
+#include "fixtures.h"
 
 #include "../../examples/PlayMODFromPROGMEMToDAC/enigma.h"
 
+// Plays the first ~30 seconds, or up to the end, returning the output's hash
+static uint32_t Play(const char *name, AudioFileSource *file, bool preload, int bufferSize, int16_t *left = NULL, uint32_t *frames = NULL)
+{
+  AudioOutputHash *out = new AudioOutputHash(512);
+  AudioGeneratorMOD *mod = new AudioGeneratorMOD();
+  uint32_t hits, misses;
+
+  out->left = left;
+  out->leftSize = left ? 44100 * 30 : 0;
+  mod->SetPreload(preload);
+  mod->SetBufferSize(bufferSize);
+  mod->begin(file, out);
+  bool inMemory = mod->Preloaded();
+  while ((out->frames < 44100 * 30) && mod->loop()) {
+    /* noop */
+  }
+  mod->SampleCacheStats(&hits, &misses);
+  mod->stop();
+  Serial.printf("%-24s %s, cache %u hits %u misses: %08x, %u frames\n", name, inMemory ? "in memory" : "streamed ", hits, misses, out->hash, out->frames);
+  if (frames) {
+    *frames = out->frames;
+  }
+  uint32_t hash = out->frames ? out->hash : 0;
+  delete mod;
+  delete out;
+  return hash;
+}
+
+// Every way of getting at a module has to sound the same
+static bool PlayAll(const char *name, const uint8_t *data, uint32_t len, int16_t *left, uint32_t *frames)
+{
+  char label[64];
+  snprintf(label, sizeof(label), "%s PROGMEM", name);
+  AudioFileSourcePROGMEM *progmem = new AudioFileSourcePROGMEM(data, len);
+  uint32_t hash = Play(label, progmem, false, 6 * 1024, left, frames);
+  AudioFileSourceCopy *copy = new AudioFileSourceCopy(data, len);
+  snprintf(label, sizeof(label), "%s streamed", name);
+  bool ok = hash && (hash == Play(label, copy, false, 6 * 1024));
+  copy->open(data, len);
+  snprintf(label, sizeof(label), "%s 512B slots", name);
+  ok &= hash == Play(label, copy, false, 512);
+  copy->open(data, len);
+  snprintf(label, sizeof(label), "%s preloaded", name);
+  ok &= hash == Play(label, copy, true, 6 * 1024);
+  delete copy;
+  delete progmem;
+  return ok;
+}
+
+// Little endian module building
+struct Writer {
+  uint8_t *data;
+  uint32_t len;
+};
+
+static void Put8(Writer *w, uint8_t v)
+{
+  w->data[w->len++] = v;
+}
+
+static void Put16(Writer *w, uint16_t v)
+{
+  Put8(w, v & 0xff);
+  Put8(w, v >> 8);
+}
+
+static void Put32(Writer *w, uint32_t v)
+{
+  Put16(w, v & 0xffff);
+  Put16(w, v >> 16);
+}
+
+static void PutBytes(Writer *w, const char *s, uint32_t len)
+{
+  for (uint32_t i = 0; i < len; i++) {
+    Put8(w, *s ? *s++ : 0);
+  }
+}
+
+static void Align16(Writer *w)
+{
+  while (w->len & 15) {
+    Put8(w, 0);
+  }
+}
+
+// An XM instrument with one sample, optionally with a sustained volume envelope which falls to 0 over 10 ticks
+static void PutXMInstrument(Writer *w, bool sixteen, uint8_t loopType, uint8_t volume, bool envelope, uint32_t frames, uint32_t cycle, int amplitude)
+{
+  uint32_t start = w->len;
+  Put32(w, 263);
+  PutBytes(w, "", 22);
+  Put8(w, 0);
+  Put16(w, 1);
+  Put32(w, 40);
+  PutBytes(w, "", 96);
+  Put16(w, 0); Put16(w, 64); Put16(w, 10); Put16(w, 0);  // Volume envelope
+  PutBytes(w, "", 40);
+  PutBytes(w, "", 48);                                    // Panning envelope
+  Put8(w, envelope ? 2 : 0);
+  Put8(w, 0);
+  Put8(w, 0);  // Sustain
+  Put8(w, 0);
+  Put8(w, 0);
+  Put8(w, 0);
+  Put8(w, 0);
+  Put8(w, 0);
+  Put8(w, envelope ? 3 : 0);
+  Put8(w, 0);
+  Put8(w, 0); Put8(w, 0); Put8(w, 0); Put8(w, 0);        // No auto-vibrato
+  Put16(w, 0x400);                                        // Fadeout
+  PutBytes(w, "", 22);
+  w->len = start + 263;
+
+  uint32_t bytes = sixteen ? 2 : 1;
+  Put32(w, frames * bytes);
+  Put32(w, 0);
+  Put32(w, frames * bytes);
+  Put8(w, volume);
+  Put8(w, 0);
+  Put8(w, loopType | (sixteen ? 0x10 : 0));
+  Put8(w, 128);
+  Put8(w, 0);
+  Put8(w, 0);
+  PutBytes(w, "", 22);
+
+  // Delta coded, a sine for forward loops and a ramp for ping-pong ones
+  int16_t last = 0;
+  for (uint32_t i = 0; i < frames; i++) {
+    int16_t v = (loopType == 2) ? -amplitude + 2 * amplitude * (int)i / (int)(frames - 1) : lrint(amplitude * sin(2 * M_PI * i / cycle));
+    if (sixteen) {
+      Put16(w, v - last);
+    } else {
+      Put8(w, (int8_t)(v - last));
+    }
+    last = v;
+  }
+}
+
+// A row of an XM pattern, with a note or just an effect on one of its channels
+static void PutXMRow(Writer *w, uint8_t channels, uint8_t channel, uint8_t note, uint8_t instrument, uint8_t volume, uint8_t effect, uint8_t parameter)
+{
+  for (uint8_t c = 0; c < channels; c++) {
+    if (c == channel && note) {
+      Put8(w, note);
+      Put8(w, instrument);
+      Put8(w, volume);
+      Put8(w, effect);
+      Put8(w, parameter);
+    } else if (c == channel && effect) {
+      Put8(w, 0x98);
+      Put8(w, effect);
+      Put8(w, parameter);
+    } else {
+      Put8(w, 0x80);
+    }
+  }
+}
+
+// 10 channels with 16 row patterns, a looped 16-bit sine with a volume envelope, then an 8-bit ping-pong ramp, both too big for a 512 byte slot
+static uint32_t MakeXM(uint8_t *data)
+{
+  Writer w = { data, 0 };
+  PutBytes(&w, "Extended Module: ", 17);
+  PutBytes(&w, "test", 20);
+  Put8(&w, 0x1a);
+  PutBytes(&w, "host test", 20);
+  Put16(&w, 0x0104);
+  Put32(&w, 276);
+  Put16(&w, 2);    // Song length
+  Put16(&w, 0);
+  Put16(&w, 10);   // Channels
+  Put16(&w, 2);    // Patterns
+  Put16(&w, 2);    // Instruments
+  Put16(&w, 1);    // Linear frequencies
+  Put16(&w, 6);
+  Put16(&w, 125);
+  Put8(&w, 0);
+  Put8(&w, 1);
+  PutBytes(&w, "", 254);
+
+  for (int p = 0; p < 2; p++) {
+    Put32(&w, 9);
+    Put8(&w, 0);
+    Put16(&w, 16);
+    uint32_t size = w.len;
+    Put16(&w, 0);
+    uint32_t start = w.len;
+    for (int r = 0; r < 16; r++) {
+      if (p == 0 && r == 0) {
+        PutXMRow(&w, 10, 0, 61, 1, 0, 0, 0);      // C-5
+      } else if (p == 0 && r == 4) {
+        PutXMRow(&w, 10, 0, 97, 0, 0, 0, 0);      // Key off, so the envelope falls
+      } else if (p == 0 && r == 8) {
+        PutXMRow(&w, 10, 9, 85, 2, 0x40, 0, 0);   // C-7, volume 48
+      } else if (p == 0 && r == 12) {
+        PutXMRow(&w, 10, 9, 97, 0, 0, 0, 0);      // Key off, without an envelope
+      } else if (p == 1 && r == 0) {
+        PutXMRow(&w, 10, 5, 0, 0, 0, 0xD, 0);     // Break, on the last order so the song ends
+      } else {
+        PutXMRow(&w, 10, 0, 0, 0, 0, 0, 0);
+      }
+    }
+    w.data[size] = (w.len - start) & 0xff;
+    w.data[size + 1] = (w.len - start) >> 8;
+  }
+
+  PutXMInstrument(&w, true, 1, 64, true, 32 * 125, 32, 12000);
+  PutXMInstrument(&w, false, 2, 64, false, 1024, 0, 100);
+  return w.len;
+}
+
+// An S3M sample header, for unsigned data at offset
+static void PutS3MSample(Writer *w, uint32_t offset, uint32_t frames, uint8_t volume, bool sixteen)
+{
+  Put8(w, 1);
+  PutBytes(w, "", 12);
+  Put8(w, offset >> 20);
+  Put16(w, (offset >> 4) & 0xffff);
+  Put32(w, frames);
+  Put32(w, 0);
+  Put32(w, frames);
+  Put8(w, volume);
+  Put8(w, 0);
+  Put8(w, 0);
+  Put8(w, 1 | (sixteen ? 4 : 0));
+  Put32(w, 8363);
+  PutBytes(w, "", 12);
+  PutBytes(w, "", 28);
+  PutBytes(w, "SCRS", 4);
+}
+
+// 4 channels, an 8-bit sine on the left and then a 16-bit one on the right, both unsigned and cut with ^^
+static uint32_t MakeS3M(uint8_t *data)
+{
+  Writer w = { data, 0 };
+  PutBytes(&w, "test", 28);
+  Put8(&w, 0x1a);
+  Put8(&w, 16);
+  Put16(&w, 0);
+  Put16(&w, 2);       // Orders
+  Put16(&w, 2);       // Instruments
+  Put16(&w, 1);       // Patterns
+  Put16(&w, 0);
+  Put16(&w, 0x1320);
+  Put16(&w, 2);       // Unsigned samples
+  PutBytes(&w, "SCRM", 4);
+  Put8(&w, 64);
+  Put8(&w, 6);
+  Put8(&w, 125);
+  Put8(&w, 0xb0);     // Stereo
+  Put8(&w, 0);
+  Put8(&w, 0);
+  PutBytes(&w, "", 10);
+  Put8(&w, 0);
+  Put8(&w, 8);
+  Put8(&w, 1);
+  Put8(&w, 9);
+  for (int i = 4; i < 32; i++) {
+    Put8(&w, 255);
+  }
+  Put8(&w, 0);
+  Put8(&w, 255);
+  Put16(&w, 0x70 >> 4);
+  Put16(&w, 0xc0 >> 4);
+  Put16(&w, 0x110 >> 4);
+  Align16(&w);
+
+  const uint32_t frames = 32 * 40;
+  uint32_t sample1 = 0x400;
+  uint32_t sample2 = sample1 + frames;
+  PutS3MSample(&w, sample1, frames, 64, false);
+  PutS3MSample(&w, sample2, frames, 64, true);
+
+  uint32_t size = w.len;
+  Put16(&w, 0);
+  for (int r = 0; r < 64; r++) {
+    if (r == 0) {
+      Put8(&w, 0xe0);   // C-5, volume 64, speed 6
+      Put8(&w, 0x50);
+      Put8(&w, 1);
+      Put8(&w, 64);
+      Put8(&w, 1);
+      Put8(&w, 6);
+    } else if (r == 16) {
+      Put8(&w, 0x61);   // C-4, volume 48
+      Put8(&w, 0x40);
+      Put8(&w, 2);
+      Put8(&w, 48);
+    } else if (r == 8 || r == 24) {
+      Put8(&w, 0x20 | (r == 24));
+      Put8(&w, 254);
+      Put8(&w, 0);
+    }
+    Put8(&w, 0);
+  }
+  w.data[size] = (w.len - size) & 0xff;
+  w.data[size + 1] = (w.len - size) >> 8;
+
+  while (w.len < sample1) {
+    Put8(&w, 0);
+  }
+  for (uint32_t i = 0; i < frames; i++) {
+    Put8(&w, 128 + lrint(100 * sin(2 * M_PI * i / 32)));
+  }
+  for (uint32_t i = 0; i < frames; i++) {
+    Put16(&w, 32768 + lrint(12000 * sin(2 * M_PI * i / 32)));
+  }
+  return w.len;
+}
+
+// Frequency of what's playing between two rows, from the time between its rising zero crossings
+static double Pitch(const int16_t *left, int fromRow, int toRow)
+{
+  const int row = 6 * 882;
+  int crossings = 0;
+  int first = 0;
+  int last = 0;
+  for (int i = fromRow * row + 1; i < toRow * row; i++) {
+    if ((left[i - 1] < 0) && (left[i] >= 0)) {
+      first = crossings++ ? first : i;
+      last = i;
+    }
+  }
+  return (crossings > 1) ? (crossings - 1) * 44100.0 / (last - first) : 0;
+}
+
+static bool Silent(const int16_t *left, int fromRow, int toRow)
+{
+  const int row = 6 * 882;
+  for (int i = fromRow * row; i < toRow * row; i++) {
+    if (left[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool Near(double hz, double expect)
+{
+  return fabs(hz - expect) < expect * 0.02;
+}
+
 int main(int argc, char **argv)
 {
-    (void) argc;
-    (void) argv;
+  (void) argc;
+  (void) argv;
+
+  AudioFileSourcePROGMEM *file = new AudioFileSourcePROGMEM(enigma_mod, sizeof(enigma_mod));
+  AudioOutputSTDIO *out = new AudioOutputSTDIO();
+  out->SetFilename("mod.wav");
+  AudioGeneratorMOD *mod = new AudioGeneratorMOD();
+
+  mod->begin(file, out);
+  // The MOD plays forever, so only run for ~30 seconds worth
+  for (int i=0; i<10000; i++) mod->loop();
+  mod->stop();
+
+  delete out;
+  delete mod;
+  delete file;
+
+  // Deleted mid-song without a stop(), which must still free the module and sample cache
+  file = new AudioFileSourcePROGMEM(enigma_mod, sizeof(enigma_mod));
+  AudioOutputHash *hash = new AudioOutputHash(512);
+  mod = new AudioGeneratorMOD();
+  mod->SetPreload(true);
+  mod->begin(file, hash);
+  for (int i = 0; i < 100; i++) {
+    mod->loop();
+  }
+  delete mod;
+  delete hash;
+  delete file;
+
+  int16_t *left = (int16_t *)calloc(44100 * 30, sizeof(int16_t));
+  uint8_t *data = (uint8_t *)calloc(64 * 1024, 1);
+  uint32_t frames;
+  bool ok = PlayAll("MOD", enigma_mod, sizeof(enigma_mod), NULL, &frames);
 
-    AudioFileSourcePROGMEM *file = new AudioFileSourcePROGMEM(enigma_mod, sizeof(enigma_mod));
-    AudioOutputSTDIO *out = new AudioOutputSTDIO();
-    out->SetFilename("mod.wav");
-    AudioGeneratorMOD *mod = new AudioGeneratorMOD();
+  // C-5 is 16726Hz, so the 32 frame sine plays at 523Hz, then is released.  C-7 on the 10th channel plays the
+  // 1024 frame ramp there and back, 2046 frames, at 33Hz until a key off without an envelope stops it.  The
+  // break ends the song.
+  uint32_t len = MakeXM(data);
+  bool xm = PlayAll("XM", data, len, left, &frames);
+  double sine = Pitch(left, 1, 4);
+  double pingPong = Pitch(left, 9, 12);
+  Serial.printf("XM: %.1f Hz, %.1f Hz\n", sine, pingPong);
+  xm &= Near(sine, 16726.0 / 32) && Near(pingPong, 66904.0 / 2046);
+  xm &= Silent(left, 6, 8) && Silent(left, 13, 16) && (frames == 17 * 6 * 882);
+  ok &= xm;
 
-    mod->begin(file, out);
-    // The MOD plays forever, so only run for ~30 seconds worth
-    for (int i=0; i<10000; i++) mod->loop();
-    mod->stop();
+  // S3M C-5 and C-4 of samples at 8363Hz, the first cut at row 8 and the second at row 24
+  len = MakeS3M(data);
+  bool s3m = PlayAll("S3M", data, len, left, &frames);
+  double eight = Pitch(left, 1, 7);
+  double sixteen = Pitch(left, 17, 23);
+  Serial.printf("S3M: %.1f Hz, %.1f Hz\n", eight, sixteen);
+  s3m &= Near(eight, 16726.0 / 32) && Near(sixteen, 8363.0 / 32);
+  s3m &= Silent(left, 9, 16) && Silent(left, 25, 64) && (frames == 64 * 6 * 882);
+  ok &= s3m;
 
-    delete out;
-    delete mod;
-    delete file;
+  free(data);
+  free(left);
+  Serial.printf("%s\n", ok ? "OK" : "MISMATCH");
+  return ok ? 0 : 1;
 }
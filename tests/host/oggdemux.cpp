@@ -0,0 +1,116 @@
+#include <Arduino.h>
+#include <time.h>
+#include "AudioFileSourcePROGMEM.h"
+#include "AudioOggDemux.h"
+
+#define OPUS "../../examples/PlayOpusFromLittleFS/data/gs-16b-2c-44100hz.opus"
+
+// Demuxes the whole file, returning the number of packets and their total size
+static uint32_t demux(const uint8_t *data, uint32_t len, uint32_t *bytes, uint32_t *crcErrors)
+{
+  AudioFileSourcePROGMEM src(data, len);
+  AudioOggDemux ogg;
+  const uint8_t *pkt;
+  uint32_t pktLen;
+  uint32_t cnt = 0;
+  ogg.begin(&src);
+  *bytes = 0;
+  while (ogg.nextPacket(&pkt, &pktLen)) {
+    cnt++;
+    *bytes += pktLen;
+  }
+  *crcErrors = ogg.crcErrors();
+  return cnt;
+}
+
+// One packet of the given size spread over as many continued pages as it needs
+static uint8_t *bigPacket(uint32_t size, uint32_t *len)
+{
+  uint32_t pages = size / (255 * 255) + 1;
+  uint8_t *data = (uint8_t *)malloc(pages * (27 + 255 + 255 * 255));
+  uint8_t *p = data;
+  for (uint32_t i = 0; i < pages; i++) {
+    uint32_t left = size - i * 255 * 255;
+    uint32_t segs = (left >= 255 * 255) ? 255 : left / 255 + 1;
+    uint32_t body = (left >= 255 * 255) ? 255 * 255 : left;
+    memset(p, 0, 27);
+    memcpy(p, "OggS", 4);
+    p[5] = (i ? 1 : 0) | (!i ? 2 : 0);
+    memset(p + 6, (i == pages - 1) ? 0 : 0xff, 8); // Only the last page ends the packet
+    p[14] = 1; // Serial
+    p[18] = i;
+    p[26] = segs;
+    for (uint32_t s = 0; s < segs; s++) {
+      p[27 + s] = (s < segs - 1 || body == 255 * 255) ? 255 : body % 255;
+    }
+    memset(p + 27 + segs, i, body);
+    uint32_t c = AudioOggDemux::crc(0, p, 27 + segs + body);
+    p[22] = c;
+    p[23] = c >> 8;
+    p[24] = c >> 16;
+    p[25] = c >> 24;
+    p += 27 + segs + body;
+  }
+  *len = p - data;
+  return data;
+}
+
+int main(int argc, char **argv)
+{
+  (void) argc;
+  (void) argv;
+
+  FILE *f = fopen(OPUS, "rb");
+  fseek(f, 0, SEEK_END);
+  uint32_t len = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  uint8_t *data = (uint8_t *)malloc(len);
+  if (fread(data, 1, len, f) != len) {
+    return 1;
+  }
+  fclose(f);
+
+  uint32_t bytes, crcErrors;
+  uint32_t pkts = demux(data, len, &bytes, &crcErrors);
+  Serial.printf("%u packets, %u payload bytes, %u CRC errors\n", pkts, bytes, crcErrors);
+
+  const int loops = 200;
+  struct timespec a, b;
+  clock_gettime(CLOCK_MONOTONIC, &a);
+  for (int i = 0; i < loops; i++) {
+    demux(data, len, &bytes, &crcErrors);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &b);
+  double secs = (b.tv_sec - a.tv_sec) + (b.tv_nsec - a.tv_nsec) / 1e9;
+  Serial.printf("Demux rate: %.1f MB/s\n", (double)len * loops / secs / 1e6);
+
+  // A damaged page has to be dropped, and only that page
+  data[len / 2] ^= 0x55;
+  uint32_t badBytes, badErrors;
+  uint32_t badPkts = demux(data, len, &badBytes, &badErrors);
+  Serial.printf("Damaged: %u packets, %u CRC errors\n", badPkts, badErrors);
+  free(data);
+  bool ok = (crcErrors == 0) && (badErrors == 1) && (badPkts < pkts);
+
+  // A packet over the limit ends the stream instead of growing the buffer, unless it's raised
+  const uint32_t big = 200000;
+  data = bigPacket(big, &len);
+  for (int raised = 0; raised < 2; raised++) {
+    AudioFileSourcePROGMEM src(data, len);
+    AudioOggDemux *ogg = new AudioOggDemux();
+    const uint8_t *pkt;
+    uint32_t pktLen = 0;
+    if (raised) {
+      ogg->setMaxPacket(256 * 1024);
+    }
+    ogg->begin(&src);
+    bool got = ogg->nextPacket(&pkt, &pktLen);
+    bool right = raised ? (got && (pktLen == big) && (pkt[0] == 0) && (pkt[big - 1] == big / (255 * 255))) : (!got && ogg->packetTooLarge());
+    Serial.printf("%u byte packet, %s limit: %s\n", big, raised ? "raised" : "default", right ? "OK" : "WRONG");
+    ok &= right;
+    delete ogg;
+  }
+  free(data);
+
+  return ok ? 0 : 1;
+}
@@ -1,10 +1,473 @@
 #include <Arduino.h>
+#include <math.h>
+#include <time.h>
 #include "AudioFileSourceSTDIO.h"
+#include "AudioFileSourcePROGMEM.h"
 #include "AudioOutputSTDIO.h"
 #include "AudioGeneratorOpus.h"
+#include "AudioOggDemux.h"
+#include "fixtures.h"
 
 #define OPUS "../../examples/PlayOpusFromLittleFS/data/gs-16b-2c-44100hz.opus"
 
+void MDCallback(void *cbData, const char *type, bool isUnicode, const char *string)
+{
+  (void)cbData;
+  (void)isUnicode;
+  Serial.printf("Opus tag: %s = '%s'\n", type, string);
+}
+
+// A network source that sometimes has nothing ready
+class AudioFileSourceStall : public AudioFileSourcePROGMEM {
+public:
+  AudioFileSourceStall(const void *data, uint32_t len, int every) : AudioFileSourcePROGMEM(data, len), every(every), calls(0) { }
+  virtual uint32_t read(void *data, uint32_t len) override {
+    if (!(++calls % every)) {
+      return 0;
+    }
+    return AudioFileSourcePROGMEM::read(data, len);
+  }
+  // Network data can't be used in place
+  virtual const uint8_t *peek(uint32_t *avail) override {
+    *avail = 0;
+    return NULL;
+  }
+  int every;
+  int calls;
+};
+
+uint32_t PageLen(const uint8_t *p)
+{
+  uint32_t len = 27 + p[26];
+  for (int i = 0; i < p[26]; i++) {
+    len += p[27 + i];
+  }
+  return len;
+}
+
+// Recompute the CRC of the page at p after editing it
+void FixPageCRC(uint8_t *p)
+{
+  uint32_t len = PageLen(p);
+  memset(p + 22, 0, 4);
+  uint32_t c = AudioOggDemux::crc(0, p, len);
+  for (int i = 0; i < 4; i++) {
+    p[22 + i] = c >> (i * 8);
+  }
+}
+
+// One packet per page is plenty for a test stream
+uint32_t WritePage(uint8_t *out, const uint8_t *pkt, uint32_t len, uint32_t seq, uint64_t granule, uint8_t flags)
+{
+  uint32_t segs = len / 255 + 1;
+  memcpy(out, "OggS", 4);
+  out[4] = 0;
+  out[5] = flags;
+  for (int i = 0; i < 8; i++) {
+    out[6 + i] = granule >> (i * 8);
+  }
+  for (int i = 0; i < 4; i++) {
+    out[14 + i] = 0x5a >> (i * 8);
+    out[18 + i] = seq >> (i * 8);
+  }
+  out[26] = segs;
+  memset(out + 27, 255, segs - 1);
+  out[27 + segs - 1] = len % 255;
+  memcpy(out + 27 + segs, pkt, len);
+  FixPageCRC(out);
+  return 27 + segs + len;
+}
+
+// 5.1 file with the example's stereo packets as both front and rear pairs, centre and LFE muted
+uint32_t MakeSurround(const uint8_t *data, uint32_t len, uint8_t *out)
+{
+  AudioFileSourcePROGMEM *src = new AudioFileSourcePROGMEM(data, len);
+  AudioOggDemux *ogg = new AudioOggDemux();
+  const uint8_t *pkt;
+  uint32_t pktLen;
+  uint32_t o = 0;
+  uint32_t seq = 0;
+  uint64_t granule = 0;
+  static uint8_t ms[2048];
+  ogg->begin(src);
+  while (ogg->nextPacket(&pkt, &pktLen)) {
+    if (!memcmp(pkt, "OpusHead", 8)) {
+      const uint8_t mapping[6] = { 0, 255, 1, 2, 3, 255 };
+      memcpy(ms, pkt, 19);
+      ms[9] = 6; // Channels
+      ms[18] = 1; // Mapping family
+      ms[19] = 2; // Streams
+      ms[20] = 2; // Coupled
+      memcpy(ms + 21, mapping, 6);
+      o += WritePage(out + o, ms, 27, seq++, 0, 2);
+    } else if (!memcmp(pkt, "OpusTags", 8)) {
+      o += WritePage(out + o, pkt, pktLen, seq++, 0, 0);
+    } else {
+      // All but the last stream use self-delimited framing, for a 1-frame packet that's the TOC
+      // followed by the frame length
+      uint32_t l = pktLen - 1;
+      uint32_t n = 0;
+      ms[n++] = pkt[0];
+      if (l < 252) {
+        ms[n++] = l;
+      } else {
+        ms[n++] = 252 + (l & 3);
+        ms[n++] = (l - 252 - (l & 3)) >> 2;
+      }
+      memcpy(ms + n, pkt + 1, l);
+      n += l;
+      memcpy(ms + n, pkt, pktLen);
+      n += pktLen;
+      granule += opus_packet_get_nb_samples(pkt, pktLen, 48000);
+      o += WritePage(out + o, ms, n, seq++, granule, 0);
+    }
+  }
+  delete ogg;
+  delete src;
+  return o;
+}
+
+// The example's packets joined n to a packet (code 3, VBR), for 60 and 120 ms packets
+uint32_t MakeLong(const uint8_t *data, uint32_t len, uint8_t *out, int n)
+{
+  AudioFileSourcePROGMEM *src = new AudioFileSourcePROGMEM(data, len);
+  AudioOggDemux *ogg = new AudioOggDemux();
+  const uint8_t *pkt;
+  uint32_t pktLen;
+  uint32_t o = 0;
+  uint32_t seq = 0;
+  uint64_t granule = 0;
+  static uint8_t frames[6][1276];
+  uint32_t frameLen[6];
+  uint8_t toc = 0;
+  int count = 0;
+  bool more = true;
+  ogg->begin(src);
+  while (more) {
+    more = ogg->nextPacket(&pkt, &pktLen);
+    bool audio = more && memcmp(pkt, "OpusHead", 8) && memcmp(pkt, "OpusTags", 8);
+    // Only single frame packets of one configuration can be joined
+    if (count && (!audio || (count == n) || ((pkt[0] & ~3) != toc))) {
+      static uint8_t joined[6 * 1278 + 2];
+      uint32_t j = 0;
+      joined[j++] = toc | 3;
+      joined[j++] = 0x80 | count;
+      for (int i = 0; i < count - 1; i++) {
+        if (frameLen[i] < 252) {
+          joined[j++] = frameLen[i];
+        } else {
+          joined[j++] = 252 + (frameLen[i] & 3);
+          joined[j++] = (frameLen[i] - 252 - (frameLen[i] & 3)) >> 2;
+        }
+      }
+      for (int i = 0; i < count; i++) {
+        memcpy(joined + j, frames[i], frameLen[i]);
+        j += frameLen[i];
+      }
+      granule += count * opus_packet_get_nb_samples(&toc, 1, 48000);
+      o += WritePage(out + o, joined, j, seq++, granule, 0);
+      count = 0;
+    }
+    if (!more) {
+      break;
+    } else if (!audio) {
+      o += WritePage(out + o, pkt, pktLen, seq, 0, seq ? 0 : 2);
+      seq++;
+    } else if ((pkt[0] & 3) || (pktLen > 1276)) {
+      o = 0;
+      break;
+    } else {
+      toc = pkt[0] & ~3;
+      frameLen[count] = pktLen - 1;
+      memcpy(frames[count++], pkt + 1, pktLen - 1);
+    }
+  }
+  delete ogg;
+  delete src;
+  return o;
+}
+
+// Level of a gain-adjusted decode relative to the plain one
+double GainRatio(const uint8_t *data, uint32_t len, bool r128, const AudioOutputCapture *ref)
+{
+  AudioFileSourcePROGMEM *file = new AudioFileSourcePROGMEM(data, len);
+  AudioOutputCapture *cap = new AudioOutputCapture();
+  AudioGeneratorOpus *opus = new AudioGeneratorOpus();
+  opus->SetR128TrackGain(r128);
+  opus->begin(file, cap);
+  while (opus->loop()) { /*noop*/ }
+  opus->stop();
+  double a = 0, b = 0;
+  for (uint32_t i = 0; i < cap->len * 2 && i < ref->len * 2; i++) {
+    a += (double)ref->pcm[i] * ref->pcm[i];
+    b += (double)cap->pcm[i] * cap->pcm[i];
+  }
+  delete opus;
+  delete cap;
+  delete file;
+  return sqrt(b / a);
+}
+
+// The whole example file, to be reworked in memory
+static uint8_t *Load(uint32_t *len)
+{
+    FILE *f = fopen(OPUS, "rb");
+    fseek(f, 0, SEEK_END);
+    *len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint8_t *data = (uint8_t *)malloc(*len);
+    if (fread(data, 1, *len, f) != *len) {
+        *len = 0;
+    }
+    fclose(f);
+    return data;
+}
+
+// Seeks, checked against a full decode of the same file
+static int Seeks(const AudioOutputCapture *full)
+{
+    int fails = 0;
+    const uint32_t seeks[] = { 0, 1000, 2345, 7000, 15000 };
+    for (auto ms : seeks) {
+        AudioFileSourceSTDIO *file = new AudioFileSourceSTDIO(OPUS);
+        AudioOutputCapture *part = new AudioOutputCapture();
+        AudioGeneratorOpus *opus = new AudioGeneratorOpus();
+        part->limit = 1;
+        opus->begin(file, part);
+        opus->loop(); // Header and first packet
+        part->len = 0;
+        part->limit = 48000;
+        if (!opus->seek(ms)) {
+            printf("Seek to %u ms failed\n", ms);
+            fails++;
+        }
+        while (opus->loop() && (part->len < part->limit)) { /*noop*/ }
+        opus->stop();
+        // The pre-roll should bring the decoder back in step with the straight decode
+        int64_t sig = 0, err = 0;
+        uint32_t n = part->len ? part->len - 1 : 0; // Both captures start with a stale lastSample
+        for (uint32_t i = 0; i < n * 2; i++) {
+            int32_t a = full->pcm[(ms * 48 + 1) * 2 + i];
+            int32_t b = part->pcm[2 + i];
+            sig += a * a;
+            err += (a - b) * (a - b);
+        }
+        double snr = err ? 10.0 * log10((double)sig / err) : 99.0;
+        printf("Seek to %u ms: %.1f dB SNR against straight decode\n", ms, snr);
+        fails += (snr < 30.0) ? 1 : 0;
+        delete opus;
+        delete part;
+        delete file;
+    }
+    return fails;
+}
+
+// Reduced rate and mono decodes, for low end outputs
+static int Modes(const AudioOutputCapture *full)
+{
+    int fails = 0;
+    const struct { int hz; int ch; } modes[] = { { 48000, 2 }, { 24000, 2 }, { 16000, 1 }, { 8000, 1 } };
+    for (auto m : modes) {
+        AudioFileSourceSTDIO *file = new AudioFileSourceSTDIO(OPUS);
+        AudioOutputCapture *cap = new AudioOutputCapture();
+        AudioGeneratorOpus *opus = new AudioGeneratorOpus();
+        opus->SetSampleRate(m.hz);
+        opus->SetChannels(m.ch);
+        struct timespec a, b;
+        clock_gettime(CLOCK_MONOTONIC, &a);
+        opus->begin(file, cap);
+        while (opus->loop()) { /*noop*/ }
+        clock_gettime(CLOCK_MONOTONIC, &b);
+        opus->stop();
+        double t = (b.tv_sec - a.tv_sec) * 1000.0 + (b.tv_nsec - a.tv_nsec) / 1000000.0;
+        uint32_t ms = cap->len / (m.hz / 1000);
+        printf("Decode at %d Hz, %d ch: %u ms of audio in %.1f ms\n", m.hz, m.ch, ms, t);
+        fails += (abs((int)ms - (int)(full->len / 48)) > 20) ? 1 : 0;
+        delete opus;
+        delete cap;
+        delete file;
+    }
+    return fails;
+}
+
+// Output gain of -6dB in the OpusHead, and an R128_TRACK_GAIN of -3dB in place of the artist tag
+static int Gains(const AudioOutputCapture *full)
+{
+    int fails = 0;
+    uint32_t len;
+    uint8_t *data = Load(&len);
+    uint8_t *head = (uint8_t *)memmem(data, len, "OpusHead", 8);
+    uint8_t *artist = (uint8_t *)memmem(data, len, "artist=Kevin MacLeod", 20);
+    head[16] = (-6 * 256) & 0xff;
+    head[17] = ((-6 * 256) >> 8) & 0xff;
+    memcpy(artist, "R128_TRACK_GAIN=-768", 20);
+    FixPageCRC(data);
+    FixPageCRC(data + PageLen(data));
+    double head6 = GainRatio(data, len, false, full);
+    double r128 = GainRatio(data, len, true, full);
+    printf("Output gain -6dB: level %.3f, with R128 -3dB: level %.3f\n", head6, r128);
+    fails += (fabs(head6 - pow(10.0, -6.0 / 20)) > 0.01) ? 1 : 0;
+    fails += (fabs(r128 - pow(10.0, -9.0 / 20)) > 0.01) ? 1 : 0;
+    free(data);
+    return fails;
+}
+
+// Lose the 5th audio page (a second of packets), the gap should be concealed in place
+static int LostPage(const AudioOutputCapture *full)
+{
+    int fails = 0;
+    uint32_t len;
+    uint8_t *data = Load(&len);
+    uint32_t off = 0;
+    for (int i = 0; i < 2 + 4; i++) {
+        off += PageLen(data + off);
+    }
+    uint32_t cut = PageLen(data + off);
+    memmove(data + off, data + off + cut, len - off - cut);
+    AudioFileSourcePROGMEM *lossy = new AudioFileSourcePROGMEM(data, len - cut);
+    AudioOutputCapture *cap = new AudioOutputCapture();
+    AudioGeneratorOpus *opus = new AudioGeneratorOpus();
+    opus->begin(lossy, cap);
+    while (opus->loop()) { /*noop*/ }
+    opus->stop();
+    // Compare a second of audio that starts a second after the gap
+    int64_t sig = 0, err = 0;
+    for (uint32_t i = 6 * 48000 * 2; i < 7 * 48000 * 2; i++) {
+        int32_t a = full->pcm[i];
+        int32_t b = cap->pcm[i];
+        sig += a * a;
+        err += (a - b) * (a - b);
+    }
+    double snr = err ? 10.0 * log10((double)sig / err) : 99.0;
+    printf("Lost page: %u ms decoded, %u frames concealed, %u recovered, %.1f dB SNR after the gap\n", cap->len / 48, opus->concealedFrames(), opus->recoveredFrames(), snr);
+    fails += (abs((int)(cap->len / 48) - (int)(full->len / 48)) > 20) ? 1 : 0;
+    fails += (!opus->concealedFrames() || (snr < 30.0)) ? 1 : 0;
+    delete opus;
+    delete cap;
+    delete lossy;
+    free(data);
+    return fails;
+}
+
+// Streaming from a source that regularly comes up empty, late audio is dropped to stay in time
+static int Stalling(const AudioOutputCapture *full)
+{
+    int fails = 0;
+    uint32_t len;
+    uint8_t *data = Load(&len);
+    AudioFileSourceStall *stall = new AudioFileSourceStall(data, len, 4);
+    AudioOutputCapture *cap = new AudioOutputCapture();
+    AudioGeneratorOpus *opus = new AudioGeneratorOpus();
+    opus->SetStreaming(true);
+    opus->begin(stall, cap);
+    while (opus->loop()) { /*noop*/ }
+    opus->stop();
+    printf("Stalling stream: %u ms decoded, %u frames concealed\n", cap->len / 48, opus->concealedFrames());
+    fails += (abs((int)(cap->len / 48) - (int)(full->len / 48)) > 20) ? 1 : 0;
+    fails += !opus->concealedFrames() ? 1 : 0;
+    delete opus;
+    delete cap;
+    delete stall;
+    free(data);
+    return fails;
+}
+
+// 60 and 120 ms packets need the buffer to grow past 2048 frames, or are refused under a memory limit
+static int LongPackets(const AudioOutputCapture *full)
+{
+    int fails = 0;
+    const int joins[] = { 3, 6 };
+    for (auto n : joins) {
+        uint32_t len;
+        uint8_t *data = Load(&len);
+        uint8_t *joined = (uint8_t *)malloc(len + 65536);
+        uint32_t joinedLen = MakeLong(data, len, joined, n);
+        AudioFileSourcePROGMEM *jsrc = new AudioFileSourcePROGMEM(joined, joinedLen);
+        AudioOutputCapture *cap = new AudioOutputCapture();
+        AudioGeneratorOpus *opus = new AudioGeneratorOpus();
+        opus->begin(jsrc, cap);
+        while (opus->loop()) { /*noop*/ }
+        uint32_t mem = opus->memoryUsed();
+        opus->stop();
+        uint32_t mismatch = 0;
+        for (uint32_t i = 0; i < cap->len * 2 && i < full->len * 2; i++) {
+            mismatch += (cap->pcm[i] != full->pcm[i]);
+        }
+        printf("%d ms packets: %u ms decoded, %u mismatched samples, %u bytes of decoder and buffer\n", n * 20, cap->len / 48, mismatch, mem);
+        fails += (!joinedLen || (abs((int)(cap->len / 48) - (int)(full->len / 48)) > 20) || mismatch) ? 1 : 0;
+        delete opus;
+        delete cap;
+        delete jsrc;
+
+        jsrc = new AudioFileSourcePROGMEM(joined, joinedLen);
+        cap = new AudioOutputCapture();
+        opus = new AudioGeneratorOpus();
+        opus->SetMemoryLimit(mem - 1);
+        opus->begin(jsrc, cap);
+        while (opus->loop()) { /*noop*/ }
+        opus->stop();
+        printf("%d ms packets with a %u byte limit: %u ms decoded\n", n * 20, mem - 1, cap->len / 48);
+        fails += (cap->len > 1) ? 1 : 0;
+        delete opus;
+        delete cap;
+        delete jsrc;
+        free(joined);
+        free(data);
+    }
+    return fails;
+}
+
+// Surround file mixed down to stereo, and refused under a memory limit
+static int Surround(const AudioOutputCapture *full)
+{
+    int fails = 0;
+    uint32_t len;
+    uint8_t *data = Load(&len);
+    uint8_t *surround = (uint8_t *)malloc(len * 2 + 65536);
+    uint32_t surroundLen = MakeSurround(data, len, surround);
+    AudioFileSourcePROGMEM *ms = new AudioFileSourcePROGMEM(surround, surroundLen);
+    AudioOutputCapture *cap = new AudioOutputCapture();
+    AudioGeneratorOpus *opus = new AudioGeneratorOpus();
+    opus->begin(ms, cap);
+    while (opus->loop()) { /*noop*/ }
+    uint32_t mem = opus->memoryUsed();
+    opus->stop();
+    // Front and rear pairs carry the same audio, so each side is (FL + RL) and a bit of the other
+    uint32_t mismatch = 0;
+    for (uint32_t i = 0; i < cap->len && i < full->len; i++) {
+        int32_t l = full->pcm[i * 2];
+        int32_t r = full->pcm[i * 2 + 1];
+        int32_t el = ((8667 + 7507) * l + 4334 * r + 8192) >> 14;
+        int32_t er = (4334 * l + (8667 + 7507) * r + 8192) >> 14;
+        el = (el < -32768) ? -32768 : (el > 32767) ? 32767 : el;
+        er = (er < -32768) ? -32768 : (er > 32767) ? 32767 : er;
+        mismatch += (cap->pcm[i * 2] != el) || (cap->pcm[i * 2 + 1] != er);
+    }
+    printf("5.1 downmix: %u ms decoded, %u mismatched samples, %u bytes of decoder and buffer\n", cap->len / 48, mismatch, mem);
+    fails += (abs((int)(cap->len / 48) - (int)(full->len / 48)) > 20) ? 1 : 0;
+    fails += mismatch ? 1 : 0;
+    delete opus;
+    delete cap;
+    delete ms;
+
+    // The same file refused under a memory limit
+    ms = new AudioFileSourcePROGMEM(surround, surroundLen);
+    cap = new AudioOutputCapture();
+    opus = new AudioGeneratorOpus();
+    opus->SetMemoryLimit(mem - 1);
+    opus->begin(ms, cap);
+    while (opus->loop()) { /*noop*/ }
+    opus->stop();
+    printf("5.1 with a %u byte limit: %u ms decoded\n", mem - 1, cap->len / 48);
+    fails += (cap->len > 1) ? 1 : 0;
+    delete opus;
+    delete cap;
+    delete ms;
+    free(surround);
+    free(data);
+    return fails;
+}
+
 int main(int argc, char **argv)
 {
     (void) argc;
@@ -14,6 +477,7 @@ int main(int argc, char **argv)
     AudioOutputSTDIO *out = new AudioOutputSTDIO();
     out->SetFilename("opus.wav");
     AudioGeneratorOpus *opus = new AudioGeneratorOpus();
+    opus->RegisterMetadataCB(MDCallback, NULL);
 
     opus->begin(file, out);
     while (opus->loop()) { /*noop*/ }
@@ -22,4 +486,31 @@ int main(int argc, char **argv)
     delete out;
     delete opus;
     delete file;
+
+    // A straight decode, which everything else is checked against
+    file = new AudioFileSourceSTDIO(OPUS);
+    AudioOutputCapture *full = new AudioOutputCapture();
+    opus = new AudioGeneratorOpus();
+    opus->begin(file, full);
+    // Asked for mid-stream, finding the length mustn't disturb the decode the seeks are checked against
+    for (int i = 0; (i < 100) && opus->loop(); i++) { /*noop*/ }
+    uint32_t duration = opus->duration();
+    while (opus->loop()) { /*noop*/ }
+    opus->stop();
+    delete opus;
+    delete file;
+    printf("Duration: %u ms, decoded %u ms\n", duration, full->len / 48);
+
+    // No end trimming is applied to the decode, so allow for one partial frame
+    int fails = (abs((int)duration - (int)(full->len / 48)) > 20) ? 1 : 0;
+    fails += Seeks(full);
+    fails += Modes(full);
+    fails += Gains(full);
+    fails += LostPage(full);
+    fails += Stalling(full);
+    fails += LongPackets(full);
+    fails += Surround(full);
+
+    delete full;
+    return fails;
 }
@@ -1,8 +1,354 @@
 #include <Arduino.h>
+#include <time.h>
+#include <math.h>
 #include "AudioFileSourceSTDIO.h"
+#include "AudioFileSourcePROGMEM.h"
 #include "AudioOutputSTDIO.h"
 #include "AudioGeneratorWAV.h"
+#include "fixtures.h"
 
+// Decode in place from memory, or copy everything through read()
+static bool zeroCopy;
+
+static void PutU16(uint8_t *p, uint16_t v)
+{
+    p[0] = v & 0xff;
+    p[1] = v >> 8;
+}
+
+static void PutU32(uint8_t *p, uint32_t v)
+{
+    PutU16(p, v & 0xffff);
+    PutU16(p + 2, v >> 16);
+}
+
+// Wraps raw sample data in a RIFF header, optionally as WAVE_FORMAT_EXTENSIBLE
+static uint8_t *MakeWAV(uint16_t format, uint16_t ch, uint16_t bits, const uint8_t *data, uint32_t len, bool extensible, uint32_t *wavLen, uint16_t blockAlign = 0, uint32_t fact = 0)
+{
+    uint32_t fmtLen = extensible ? 40 : 16;
+    uint32_t factLen = fact ? 12 : 0;
+    *wavLen = 12 + 8 + fmtLen + factLen + 8 + len;
+    uint8_t *w = (uint8_t *)calloc(1, *wavLen);
+    memcpy(w, "RIFF", 4);
+    PutU32(w + 4, *wavLen - 8);
+    memcpy(w + 8, "WAVEfmt ", 8);
+    PutU32(w + 16, fmtLen);
+    PutU16(w + 20, extensible ? 0xfffe : format);
+    PutU16(w + 22, ch);
+    PutU32(w + 24, 44100);
+    PutU32(w + 28, 44100 * ch * bits / 8);
+    PutU16(w + 32, blockAlign ? blockAlign : ch * bits / 8);
+    PutU16(w + 34, bits);
+    if (extensible) {
+        PutU16(w + 36, 22);
+        PutU16(w + 38, bits);
+        PutU32(w + 40, ch == 2 ? 3 : 4);
+        PutU16(w + 44, format);
+        memcpy(w + 46, "\x00\x00\x00\x00\x10\x00\x80\x00\x00\xaa\x00\x38\x9b\x71", 14);
+    }
+    if (fact) {
+        memcpy(w + 20 + fmtLen, "fact", 4);
+        PutU32(w + 24 + fmtLen, 4);
+        PutU32(w + 28 + fmtLen, fact);
+    }
+    memcpy(w + 20 + fmtLen + factLen, "data", 4);
+    PutU32(w + 24 + fmtLen + factLen, len);
+    memcpy(w + 28 + fmtLen + factLen, data, len);
+    return w;
+}
+
+// ITU-T G.711 reference expansions, written independently of the decoder's tables
+static int16_t ULaw(uint8_t u)
+{
+    u = ~u;
+    int t = ((u & 0x0f) << 3) + 0x84;
+    t <<= (u & 0x70) >> 4;
+    return (u & 0x80) ? (0x84 - t) : (t - 0x84);
+}
+
+static int16_t ALaw(uint8_t a)
+{
+    a ^= 0x55;
+    int t = (a & 0x0f) << 4;
+    int seg = (a & 0x70) >> 4;
+    if (seg == 0) {
+        t += 8;
+    } else {
+        t += 0x108;
+        if (seg > 1) {
+            t <<= seg - 1;
+        }
+    }
+    return (a & 0x80) ? t : -t;
+}
+
+static int16_t Clip(int32_t v)
+{
+    return (v > 32767) ? 32767 : ((v < -32768) ? -32768 : v);
+}
+
+// IMA ADPCM encoder, also producing the samples a decoder has to reconstruct
+static uint8_t *EncodeIMA(const int16_t *ref, uint32_t frames, uint16_t ch, uint16_t blockAlign, uint32_t *len, int16_t *expect)
+{
+    static const int steps[89] = {
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+        130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060,
+        1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484,
+        7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+    };
+    static const int adjust[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+    uint32_t spb = 1 + ((blockAlign - 4 * ch) / (4 * ch)) * 8;
+    uint32_t blocks = (frames + spb - 1) / spb;
+    *len = blocks * blockAlign;
+    uint8_t *out = (uint8_t *)calloc(1, *len);
+    int index[2] = { 0, 0 };
+    for (uint32_t b = 0; b < blocks; b++) {
+        uint8_t *p = out + b * blockAlign;
+        for (uint32_t c = 0; c < ch; c++) {
+            int32_t pred = ref[b * spb * 2 + c];
+            PutU16(p + c * 4, pred);
+            p[c * 4 + 2] = index[c];
+            expect[b * spb * 2 + c] = pred;
+            for (uint32_t i = 1; i < spb; i++) {
+                uint32_t f = b * spb + i;
+                int32_t x = (f < frames) ? ref[f * 2 + c] : 0;
+                int step = steps[index[c]];
+                int32_t diff = x - pred;
+                uint8_t nib = 0;
+                if (diff < 0) {
+                    nib = 8;
+                    diff = -diff;
+                }
+                int32_t rec = step >> 3;
+                for (int bit = 4; bit; bit >>= 1, step >>= 1) {
+                    if (diff >= step) {
+                        nib |= bit;
+                        diff -= step;
+                        rec += step;
+                    }
+                }
+                pred = Clip((nib & 8) ? pred - rec : pred + rec);
+                index[c] += adjust[nib & 7];
+                index[c] = (index[c] < 0) ? 0 : ((index[c] > 88) ? 88 : index[c]);
+                expect[f * 2 + c] = pred;
+                uint32_t k = (i - 1) & 7;
+                uint8_t *q = p + 4 * ch + ((i - 1) / 8) * 4 * ch + c * 4 + k / 2;
+                *q |= (k & 1) ? (nib << 4) : nib;
+            }
+        }
+    }
+    return out;
+}
+
+// MS ADPCM encoder cycling through all 7 predictors, also producing the expected output
+static uint8_t *EncodeMS(const int16_t *ref, uint32_t frames, uint16_t ch, uint16_t blockAlign, uint32_t *len, int16_t *expect)
+{
+    static const int coef[7][2] = { { 256, 0 }, { 512, -256 }, { 0, 0 }, { 192, 64 }, { 240, 0 }, { 460, -208 }, { 392, -232 } };
+    static const int adapt[16] = { 230, 230, 230, 230, 307, 409, 512, 614, 768, 614, 512, 409, 307, 230, 230, 230 };
+    uint32_t spb = 2 + ((blockAlign - 7 * ch) * 2) / ch;
+    uint32_t blocks = (frames + spb - 1) / spb;
+    *len = blocks * blockAlign;
+    uint8_t *out = (uint8_t *)calloc(1, *len);
+    for (uint32_t b = 0; b < blocks; b++) {
+        uint8_t *p = out + b * blockAlign;
+        int32_t delta[2], s1[2], s2[2];
+        int pr = b % 7;
+        for (uint32_t c = 0; c < ch; c++) {
+            uint32_t f = b * spb;
+            delta[c] = 16 + 64 * c;
+            s2[c] = (f < frames) ? ref[f * 2 + c] : 0;
+            s1[c] = (f + 1 < frames) ? ref[(f + 1) * 2 + c] : 0;
+            p[c] = pr;
+            PutU16(p + ch + c * 2, delta[c]);
+            PutU16(p + ch * 3 + c * 2, s1[c]);
+            PutU16(p + ch * 5 + c * 2, s2[c]);
+            expect[f * 2 + c] = s2[c];
+            expect[(f + 1) * 2 + c] = s1[c];
+        }
+        uint32_t n = 0;
+        for (uint32_t i = 2; i < spb; i++) {
+            uint32_t f = b * spb + i;
+            for (uint32_t c = 0; c < ch; c++, n++) {
+                int32_t x = (f < frames) ? ref[f * 2 + c] : 0;
+                int32_t pred = (s1[c] * coef[pr][0] + s2[c] * coef[pr][1]) / 256;
+                int32_t e = (x - pred) / delta[c];
+                e = (e > 7) ? 7 : ((e < -8) ? -8 : e);
+                int32_t rec = Clip(pred + e * delta[c]);
+                s2[c] = s1[c];
+                s1[c] = rec;
+                delta[c] = (adapt[e & 15] * delta[c]) >> 8;
+                delta[c] = (delta[c] < 16) ? 16 : delta[c];
+                expect[f * 2 + c] = rec;
+                p[7 * ch + n / 2] |= (n & 1) ? (e & 15) : ((e & 15) << 4);
+            }
+        }
+    }
+    return out;
+}
+
+// Decodes from the given frame, or from the start when frame is 0
+static AudioOutputCapture *DecodeFrom(const uint8_t *w, uint32_t wavLen, uint32_t frame, uint32_t *total)
+{
+    AudioFileSourcePROGMEM *src = zeroCopy ? new AudioFileSourcePROGMEM(w, wavLen) : new AudioFileSourceCopy(w, wavLen);
+    AudioOutputCapture *out = new AudioOutputCapture();
+    AudioGeneratorWAV *wav = new AudioGeneratorWAV();
+    if (wav->begin(src, out) && (!frame || wav->seekFrame(frame))) {
+        *total = wav->frames();
+        while (wav->loop()) { /*noop*/ }
+    }
+    wav->stop();
+    delete wav;
+    delete src;
+    return out;
+}
+
+// Compresses the reference signal, then checks the full decode and seeks into the middle of blocks
+static bool CheckADPCM(const char *name, uint16_t format, uint16_t ch, uint16_t blockAlign, const int16_t *ref, uint32_t frames)
+{
+    int16_t *expect = (int16_t *)calloc(frames + 65536, 2 * sizeof(int16_t));
+    uint32_t len, wavLen;
+    uint8_t *raw = (format == 0x11) ? EncodeIMA(ref, frames, ch, blockAlign, &len, expect) : EncodeMS(ref, frames, ch, blockAlign, &len, expect);
+    if (ch == 1) {
+        for (uint32_t i = 0; i < frames; i++) {
+            expect[i * 2 + 1] = expect[i * 2];
+        }
+    }
+    uint8_t *w = MakeWAV(format, ch, 4, raw, len, false, &wavLen, blockAlign, frames);
+    uint32_t total = 0;
+    AudioOutputCapture *full = DecodeFrom(w, wavLen, 0, &total);
+    bool ok = (total == frames) && (full->len == frames) && !memcmp(full->pcm, expect, frames * 2 * sizeof(int16_t));
+    delete full;
+    const uint32_t seeks[] = { 1, 1000, 4567, frames - 3 };
+    for (uint32_t i = 0; i < sizeof(seeks) / sizeof(seeks[0]); i++) {
+        AudioOutputCapture *part = DecodeFrom(w, wavLen, seeks[i], &total);
+        ok &= (part->len == frames - seeks[i]) && !memcmp(part->pcm, expect + seeks[i] * 2, part->len * 2 * sizeof(int16_t));
+        delete part;
+    }
+    Serial.printf("%-12s %s %s: %u bytes for %u frames %s\n", name, ch == 2 ? "stereo" : "mono", zeroCopy ? "in place" : "copied", len, frames, ok ? "OK" : "FAIL");
+    free(w);
+    free(raw);
+    free(expect);
+    return ok;
+}
+
+// Encodes the reference stereo signal in the given format, decodes it and checks every sample
+static bool Check(const char *name, uint16_t format, uint16_t ch, uint16_t bits, bool extensible, const int16_t *ref, uint32_t frames)
+{
+    uint32_t bytes = bits / 8;
+    uint32_t len = frames * ch * bytes;
+    uint8_t *raw = (uint8_t *)malloc(len);
+    int16_t *expect = (int16_t *)malloc(frames * 2 * sizeof(int16_t));
+    for (uint32_t i = 0; i < frames; i++) {
+        for (uint32_t c = 0; c < ch; c++) {
+            int16_t s = ref[i * 2 + c];
+            uint8_t *p = raw + (i * ch + c) * bytes;
+            int16_t e = s;
+            if ((format == 1) && (bits == 8)) {
+                p[0] = (s >> 8) + 128;
+                e = (s >> 8) * 256;
+            } else if (format == 1) {
+                // Low bytes carry junk that has to be dropped
+                for (uint32_t b = 0; b < bytes - 2; b++) {
+                    p[b] = 0x5a + i;
+                }
+                PutU16(p + bytes - 2, s);
+            } else if (format == 3) {
+                float f = s / 32768.0f;
+                memcpy(p, &f, 4);
+            } else {
+                // G.711 is checked over every code instead of a signal
+                p[0] = (i * ch + c) & 0xff;
+                e = (format == 6) ? ALaw(p[0]) : ULaw(p[0]);
+            }
+            expect[i * 2 + c] = e;
+            if (ch == 1) {
+                expect[i * 2 + 1] = e;
+            }
+        }
+    }
+
+    uint32_t wavLen;
+    uint8_t *w = MakeWAV(format, ch, bits, raw, len, extensible, &wavLen);
+    AudioFileSourcePROGMEM *src = zeroCopy ? new AudioFileSourcePROGMEM(w, wavLen) : new AudioFileSourceCopy(w, wavLen);
+    AudioOutputCapture *out = new AudioOutputCapture();
+    AudioGeneratorWAV *wav = new AudioGeneratorWAV();
+    bool ok = wav->begin(src, out);
+    while (ok && wav->loop()) { /*noop*/ }
+    wav->stop();
+    ok = ok && (out->len == frames) && !memcmp(out->pcm, expect, frames * 2 * sizeof(int16_t));
+    Serial.printf("%-12s %s %s: %u frames %s\n", name, ch == 2 ? "stereo" : "mono", zeroCopy ? "in place" : "copied", out->len, ok ? "OK" : "FAIL");
+    delete wav;
+    delete out;
+    delete src;
+    free(w);
+    free(expect);
+    free(raw);
+    return ok;
+}
+
+// Float samples that can't be cast to int16 as they are, which must clamp and never be undefined
+static bool CheckFloatEdges()
+{
+    static const float in[] = { NAN, -NAN, INFINITY, -INFINITY, 2.0f, -2.0f, 1e30f, -1e30f, 1.0f, -1.0f, 0.5f, 0.0f };
+    static const int16_t expect[] = { 0, 0, 32767, -32768, 32767, -32768, 32767, -32768, 32767, -32768, 16384, 0 };
+    const uint32_t n = sizeof(in) / sizeof(in[0]);
+    uint32_t wavLen;
+    uint8_t *w = MakeWAV(3, 1, 32, (const uint8_t *)in, sizeof(in), false, &wavLen);
+    AudioFileSourcePROGMEM *mem = new AudioFileSourcePROGMEM(w, wavLen);
+    AudioOutputCapture *out = new AudioOutputCapture();
+    AudioGeneratorWAV *wav = new AudioGeneratorWAV();
+    bool ok = wav->begin(mem, out);
+    while (ok && wav->loop()) { /*noop*/ }
+    wav->stop();
+    ok = ok && (out->len == n);
+    for (uint32_t i = 0; ok && (i < n); i++) {
+        ok = (out->pcm[i * 2] == expect[i]) && (out->pcm[i * 2 + 1] == expect[i]);
+    }
+    Serial.printf("float32 NaN, infinities and out of range: %s\n", ok ? "OK" : "FAIL");
+    delete wav;
+    delete out;
+    delete mem;
+    free(w);
+    return ok;
+}
+
+// 16-bit stereo should cost about as much as copying the data
+static bool Bench()
+{
+    const uint32_t benchFrames = 44100 * 60;
+    uint8_t *raw = (uint8_t *)calloc(benchFrames, 4);
+    uint32_t wavLen;
+    uint8_t *w = MakeWAV(1, 2, 16, raw, benchFrames * 4, false, &wavLen);
+    const int loops = 10;
+    bool ok = true;
+    struct timespec a, b;
+    clock_gettime(CLOCK_MONOTONIC, &a);
+    for (int i = 0; i < loops; i++) {
+        AudioFileSourcePROGMEM *src = new AudioFileSourcePROGMEM(w, wavLen);
+        AudioOutputNull *sink = new AudioOutputNull();
+        AudioGeneratorWAV *gen = new AudioGeneratorWAV();
+        gen->begin(src, sink);
+        while (gen->loop()) { /*noop*/ }
+        gen->stop();
+        ok &= sink->frames == benchFrames;
+        delete gen;
+        delete sink;
+        delete src;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &b);
+    double decode = (b.tv_sec - a.tv_sec) + (b.tv_nsec - a.tv_nsec) / 1e9;
+    clock_gettime(CLOCK_MONOTONIC, &a);
+    for (int i = 0; i < loops; i++) {
+        memcpy(raw, w + 44, benchFrames * 4);
+        __asm__ __volatile__("" : : "r"(raw) : "memory");
+    }
+    clock_gettime(CLOCK_MONOTONIC, &b);
+    double copy = (b.tv_sec - a.tv_sec) + (b.tv_nsec - a.tv_nsec) / 1e9;
+    Serial.printf("16-bit stereo: %.0f MB/s decode, %.0f MB/s memcpy\n", benchFrames * 4.0 * loops / decode / 1e6, benchFrames * 4.0 * loops / copy / 1e6);
+    free(w);
+    free(raw);
+    return ok;
+}
 
 int main(int argc, char **argv)
 {
@@ -20,4 +366,38 @@ int main(int argc, char **argv)
     delete wav;
     delete out;
     delete in;
+
+    // A full-scale stereo sweep with different left and right channels, and a tone with
+    // some noise on top so the ADPCM predictors have something to track
+    const uint32_t frames = 10007;
+    int16_t *ref = (int16_t *)malloc(frames * 2 * sizeof(int16_t));
+    int16_t *tone = (int16_t *)malloc(frames * 2 * sizeof(int16_t));
+    for (uint32_t i = 0; i < frames; i++) {
+        ref[i * 2] = (int16_t)(i * 6553);
+        ref[i * 2 + 1] = (int16_t)(32767 - i * 13);
+        tone[i * 2] = (int16_t)(20000 * sin(i * 0.031) + (rand() % 2001) - 1000);
+        tone[i * 2 + 1] = (int16_t)(12000 * sin(i * 0.007 + 1) + (rand() % 401) - 200);
+    }
+    bool ok = true;
+    for (int z = 0; z < 2; z++) {
+        zeroCopy = z;
+        for (uint16_t ch = 1; ch <= 2; ch++) {
+            ok &= Check("u8", 1, ch, 8, false, ref, frames);
+            ok &= Check("s16", 1, ch, 16, false, ref, frames);
+            ok &= Check("s24", 1, ch, 24, false, ref, frames);
+            ok &= Check("s32", 1, ch, 32, true, ref, frames);
+            ok &= Check("float32", 3, ch, 32, false, ref, frames);
+            ok &= Check("A-law", 6, ch, 8, false, ref, frames);
+            ok &= Check("mu-law", 7, ch, 8, true, ref, frames);
+            ok &= CheckADPCM("IMA ADPCM", 0x11, ch, 256 * ch, tone, frames);
+            ok &= CheckADPCM("MS ADPCM", 0x02, ch, 256 * ch, tone, frames);
+        }
+    }
+    free(tone);
+    free(ref);
+    ok &= CheckFloatEdges();
+
+    ok &= Bench();
+
+    return ok ? 0 : 1;
 }